@@ -1,14 +1,20 @@
 #pragma once
 
-#include <boost/hana/ext/boost/mpl/vector.hpp>
+#include <iostream>
+#include <string>
+#include <variant>
+
+#include <boost/hana/equal.hpp>
+#include <boost/hana/index_if.hpp>
+#include <boost/hana/length.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/prepend.hpp>
 #include <boost/hana/second.hpp>
 #include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+#include <boost/hana/unpack.hpp>
 #include <boost/hana/zip.hpp>
-#include <boost/mpl/push_front.hpp>
-#include <boost/variant.hpp>
 
 #include <boost/preprocessor/seq/enum.hpp>
 #include <boost/preprocessor/seq/for_each.hpp>
@@ -57,11 +63,8 @@ struct to_pair {
 // Converts the tuples into pairs
 static constexpr auto data_types = hana::transform(data_types_as_tuples, to_pair{});  // NOLINT
 
-// Converts tuple to mpl vector
-using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(types_including_null));
-
-// Creates boost::variant from mpl vector
-using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVector>::type;
+// Creates std::variant<NullValue, int32_t, int64_t, ...> from the types
+using AllTypeVariant = typename decltype(hana::unpack(types_including_null, hana::template_<std::variant>))::type;
 
 }  // namespace detail
 
@@ -71,9 +74,37 @@ static constexpr auto data_types = detail::data_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+// The index of a type in AllTypeVariant, i.e., the value of AllTypeVariant::index() if the variant holds a T. NULL
+// values have the index 0.
+template <typename T>
+constexpr auto variant_index_of = std::decay_t<decltype(
+    hana::index_if(types_including_null, hana::equal.to(hana::type_c<T>)).value())>::value;
+
+// Identifies one of the data types at runtime, in the order of data_types_macro. Unlike the type strings, it is cheap
+// to store, compare, and switch on.
+enum class DataType : uint8_t { Int, Long, Float, Double, String };
+
+static_assert(decltype(hana::length(types))::value == 5, "DataType needs to list the same types as data_types_macro.");
+
+// The DataType of a given data type, e.g., data_type_of<float> is DataType::Float.
+template <typename T>
+constexpr auto data_type_of = static_cast<DataType>(variant_index_of<T> - 1);
+
 // Function to check if AllTypeVariant is NULL.
 inline bool variant_is_null(const AllTypeVariant& variant) {
-  return (variant.which() == 0);
+  return variant.index() == 0;
+}
+
+// std::variant compares NULL values with NullValue's operator!=, which returns false. Like all other comparisons
+// with NULL, equality returns false, so we define != as its negation.
+inline bool operator!=(const AllTypeVariant& lhs, const AllTypeVariant& rhs) {
+  return !(lhs == rhs);
+}
+
+// Prints the value held by the variant, or NULL.
+inline std::ostream& operator<<(std::ostream& stream, const AllTypeVariant& variant) {
+  std::visit([&](const auto& value) { stream << value; }, variant);
+  return stream;
 }
 
 /**
@@ -0,0 +1,71 @@
+#include "plan_cache.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+PlanCache::PlanCache(const size_t capacity) : _capacity{capacity} {
+  Assert(capacity > 0, "PlanCache needs to hold at least one plan.");
+}
+
+std::shared_ptr<const AbstractOperator> PlanCache::get(const std::string& key) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto iter = _entry_by_key.find(key);
+  if (iter == _entry_by_key.end()) {
+    return nullptr;
+  }
+
+  // Mark the entry as the most recently used one.
+  _entries.splice(_entries.begin(), _entries, iter->second);
+  return iter->second->second;
+}
+
+void PlanCache::set(const std::string& key, const std::shared_ptr<const AbstractOperator>& plan_template) {
+  Assert(plan_template, "Cannot cache an empty plan.");
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto iter = _entry_by_key.find(key);
+  if (iter != _entry_by_key.end()) {
+    iter->second->second = plan_template;
+    _entries.splice(_entries.begin(), _entries, iter->second);
+    return;
+  }
+
+  if (_entries.size() == _capacity) {
+    _entry_by_key.erase(_entries.back().first);
+    _entries.pop_back();
+  }
+  _entries.emplace_front(key, plan_template);
+  _entry_by_key.emplace(key, _entries.begin());
+}
+
+std::shared_ptr<AbstractOperator> PlanCache::instantiate(
+    const std::string& key, const std::function<std::shared_ptr<const AbstractOperator>()>& make_template,
+    const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  auto plan_template = get(key);
+  if (!plan_template) {
+    // Concurrent misses may create the template more than once, but the templates are equivalent.
+    plan_template = make_template();
+    set(key, plan_template);
+  }
+
+  const auto plan = plan_template->deep_copy();
+  plan->set_parameters(parameters);
+  return plan;
+}
+
+size_t PlanCache::size() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _entries.size();
+}
+
+size_t PlanCache::capacity() const {
+  return _capacity;
+}
+
+void PlanCache::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _entries.clear();
+  _entry_by_key.clear();
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "all_type_variant.hpp"
+#include "operators/abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Caches plan templates by a key that identifies the shape of a query, e.g., its text with placeholders for the
+// values. A query that is executed repeatedly is thus only planned once: Each execution gets a deep copy of the cached
+// template with the execution's parameters bound (see AbstractOperator::deep_copy and set_parameters). Once the cache
+// holds capacity templates, the least recently used one is evicted. The cache can be used by multiple threads.
+class PlanCache : private Noncopyable {
+ public:
+  explicit PlanCache(const size_t capacity);
+
+  // Returns the template cached for the key, or nullptr.
+  std::shared_ptr<const AbstractOperator> get(const std::string& key);
+
+  // Caches the template for the key. Replaces the template that was cached for the key before.
+  void set(const std::string& key, const std::shared_ptr<const AbstractOperator>& plan_template);
+
+  // Returns an executable copy of the template that is cached for the key, with the parameters bound. If no template is
+  // cached, it is created by make_template and cached first.
+  std::shared_ptr<AbstractOperator> instantiate(
+      const std::string& key, const std::function<std::shared_ptr<const AbstractOperator>()>& make_template,
+      const std::unordered_map<ParameterID, AllTypeVariant>& parameters = {});
+
+  size_t size() const;
+
+  size_t capacity() const;
+
+  void clear();
+
+ protected:
+  using Entry = std::pair<std::string, std::shared_ptr<const AbstractOperator>>;
+
+  const size_t _capacity;
+
+  // The entries from the most to the least recently used one.
+  std::list<Entry> _entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> _entry_by_key;
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
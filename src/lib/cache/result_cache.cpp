@@ -0,0 +1,162 @@
+#include "result_cache.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ResultCache::ResultCache(const size_t memory_budget) : _memory_budget{memory_budget} {}
+
+std::optional<std::string> ResultCache::cache_key(const AbstractOperator& op) {
+  auto keys_by_operator = KeysByOperator{};
+  return _cache_key(op, keys_by_operator);
+}
+
+std::shared_ptr<const Table> ResultCache::execute(const std::shared_ptr<AbstractOperator>& op) {
+  auto keys_by_operator = KeysByOperator{};
+  return _execute(op, keys_by_operator);
+}
+
+std::shared_ptr<const Table> ResultCache::get(const std::string& key) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto iter = _entries.find(key);
+  if (iter == _entries.end()) {
+    ++_statistics.miss_count;
+    return nullptr;
+  }
+
+  ++_statistics.hit_count;
+  auto& entry = iter->second;
+  _keys_by_priority.erase(entry.priority_iter);
+  _prioritize(entry, key);
+  return entry.table;
+}
+
+void ResultCache::set(const std::string& key, const std::shared_ptr<const Table>& table, const double cost) {
+  Assert(table, "Cannot cache an empty result.");
+  const auto memory_usage = table->estimate_memory_usage();
+  if (memory_usage > _memory_budget) {
+    return;
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto existing_iter = _entries.find(key);
+  if (existing_iter != _entries.end()) {
+    _erase(existing_iter);
+  }
+
+  while (_memory_usage + memory_usage > _memory_budget) {
+    const auto lowest_priority_iter = _keys_by_priority.begin();
+    _inflation = lowest_priority_iter->first;
+    _erase(_entries.find(lowest_priority_iter->second));
+    ++_statistics.eviction_count;
+  }
+
+  auto& entry = _entries.emplace(key, Entry{table, memory_usage, cost, {}}).first->second;
+  _prioritize(entry, key);
+  _memory_usage += memory_usage;
+}
+
+ResultCache::Statistics ResultCache::statistics() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _statistics;
+}
+
+size_t ResultCache::memory_usage() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _memory_usage;
+}
+
+size_t ResultCache::memory_budget() const {
+  return _memory_budget;
+}
+
+size_t ResultCache::size() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _entries.size();
+}
+
+void ResultCache::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _entries.clear();
+  _keys_by_priority.clear();
+  _memory_usage = 0;
+  _inflation = 0.0;
+}
+
+std::optional<std::string> ResultCache::_cache_key(const AbstractOperator& op, KeysByOperator& keys_by_operator) {
+  const auto iter = keys_by_operator.find(&op);
+  if (iter != keys_by_operator.end()) {
+    return iter->second;
+  }
+
+  auto key = op.description();
+  if (key && op.row_budget()) {
+    // Only the first rows are guaranteed to be complete with a row budget.
+    *key += " budget " + std::to_string(*op.row_budget());
+  }
+
+  for (const auto& input : {op.left_input(), op.right_input()}) {
+    if (!key || !input) {
+      continue;
+    }
+
+    const auto input_key = _cache_key(*input, keys_by_operator);
+    if (!input_key) {
+      key.reset();
+      continue;
+    }
+    *key += " (" + *input_key + ")";
+  }
+
+  keys_by_operator.emplace(&op, key);
+  return key;
+}
+
+std::shared_ptr<const Table> ResultCache::_execute(const std::shared_ptr<AbstractOperator>& op,
+                                                   KeysByOperator& keys_by_operator) {
+  if (op->was_executed()) {
+    return op->get_output();
+  }
+
+  const auto key = _cache_key(*op, keys_by_operator);
+  const auto is_cacheable = key && (op->left_input() || op->right_input());
+  if (is_cacheable) {
+    if (const auto table = get(*key)) {
+      op->_output = table;
+      op->_was_executed = true;
+      return table;
+    }
+  }
+
+  for (const auto& input : {op->left_input(), op->right_input()}) {
+    if (input && !input->was_executed()) {
+      _execute(std::const_pointer_cast<AbstractOperator>(input), keys_by_operator);
+    }
+  }
+
+  const auto begin = std::chrono::steady_clock::now();
+  op->execute();
+  const auto cost = std::chrono::duration<double, std::nano>{std::chrono::steady_clock::now() - begin}.count();
+
+  if (is_cacheable) {
+    set(*key, op->get_output(), cost);
+  }
+  return op->get_output();
+}
+
+void ResultCache::_prioritize(Entry& entry, const std::string& key) {
+  const auto priority = _inflation + entry.cost / static_cast<double>(std::max(entry.memory_usage, size_t{1}));
+  entry.priority_iter = _keys_by_priority.emplace(priority, key);
+}
+
+void ResultCache::_erase(const std::unordered_map<std::string, Entry>::iterator iter) {
+  _memory_usage -= iter->second.memory_usage;
+  _keys_by_priority.erase(iter->second.priority_iter);
+  _entries.erase(iter);
+}
+
+}  // namespace opossum
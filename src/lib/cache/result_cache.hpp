@@ -0,0 +1,98 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "operators/abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Caches the outputs of operators, so that identical subplans (e.g., the GetTable and TableScan of dashboard tiles that
+// filter the same table) are only computed once. Results are identified by the descriptions of the operator and its
+// (transitive) inputs (see AbstractOperator::description). These include the versions of the base tables, so results
+// on tables that were modified afterwards are not found anymore and are eventually evicted. The cache can be used by
+// multiple threads.
+//
+// The results are kept up to a memory budget. Tables referenced by cached outputs are kept alive, but not counted. When
+// the budget is exceeded, results are evicted according to the GreedyDual-Size policy: Each result has a priority of
+// L + cost / memory usage, where the cost is the time it took to compute the result and L is the priority of the last
+// evicted result. Results with the lowest priority are evicted first. Thus, cheap and large results go first, and
+// results that were not used for a long time fall behind those that were used recently. Results with the same costs
+// and sizes are evicted in LRU order.
+class ResultCache : private Noncopyable {
+ public:
+  struct Statistics {
+    uint64_t hit_count = 0;
+    uint64_t miss_count = 0;
+    uint64_t eviction_count = 0;
+  };
+
+  explicit ResultCache(const size_t memory_budget);
+
+  // Returns the key that identifies the operator's output, or std::nullopt if the operator or one of its inputs cannot
+  // be described.
+  static std::optional<std::string> cache_key(const AbstractOperator& op);
+
+  // Executes the operator and its inputs that were not executed yet. If the output of an operator is cached, the
+  // operator and its inputs are not executed and the cached output becomes the operator's output. Otherwise, the
+  // output is cached after the operator was executed. Operators without inputs only pass on tables and are not cached.
+  std::shared_ptr<const Table> execute(const std::shared_ptr<AbstractOperator>& op);
+
+  // Returns the cached output for the key, or nullptr.
+  std::shared_ptr<const Table> get(const std::string& key);
+
+  // Caches the output for the key. cost is the time (in nanoseconds) it took to compute it. Outputs that are larger
+  // than the memory budget are not cached.
+  void set(const std::string& key, const std::shared_ptr<const Table>& table, const double cost);
+
+  Statistics statistics() const;
+
+  // Returns the number of bytes used by the cached outputs.
+  size_t memory_usage() const;
+
+  size_t memory_budget() const;
+
+  // Returns the number of cached outputs.
+  size_t size() const;
+
+  void clear();
+
+ protected:
+  using KeysByOperator = std::unordered_map<const AbstractOperator*, std::optional<std::string>>;
+
+  static std::optional<std::string> _cache_key(const AbstractOperator& op, KeysByOperator& keys_by_operator);
+
+  std::shared_ptr<const Table> _execute(const std::shared_ptr<AbstractOperator>& op, KeysByOperator& keys_by_operator);
+
+  struct Entry {
+    std::shared_ptr<const Table> table;
+    size_t memory_usage;
+    double cost;
+    std::multimap<double, std::string>::iterator priority_iter;
+  };
+
+  // Sets the entry's priority. Needs to be called with the mutex held.
+  void _prioritize(Entry& entry, const std::string& key);
+
+  // Removes the entry. Needs to be called with the mutex held.
+  void _erase(const std::unordered_map<std::string, Entry>::iterator iter);
+
+  const size_t _memory_budget;
+  size_t _memory_usage = 0;
+
+  std::unordered_map<std::string, Entry> _entries;
+  std::multimap<double, std::string> _keys_by_priority;
+
+  // The priority of the last evicted result (L).
+  double _inflation = 0.0;
+
+  Statistics _statistics;
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,109 @@
+#include "abstract_join_operator.hpp"
+
+#include <algorithm>
+
+#include "reference_output.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+AbstractJoinOperator::AbstractJoinOperator(const std::shared_ptr<const AbstractOperator>& left,
+                                           const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                                           const ColumnID left_column_id, const ScanType scan_type,
+                                           const ColumnID right_column_id)
+    : AbstractOperator{left, right},
+      _mode{mode},
+      _left_column_id{left_column_id},
+      _scan_type{scan_type},
+      _right_column_id{right_column_id} {}
+
+JoinMode AbstractJoinOperator::mode() const {
+  return _mode;
+}
+
+ColumnID AbstractJoinOperator::left_column_id() const {
+  return _left_column_id;
+}
+
+ScanType AbstractJoinOperator::scan_type() const {
+  return _scan_type;
+}
+
+ColumnID AbstractJoinOperator::right_column_id() const {
+  return _right_column_id;
+}
+
+std::shared_ptr<const Table> AbstractJoinOperator::_build_output_table(
+    const std::vector<OutputChunk>& output_chunks) const {
+  const auto left_input_table = _left_input_table();
+  const auto right_input_table = _right_input_table();
+  const auto outputs_right_columns = _mode == JoinMode::Inner || _mode == JoinMode::Left;
+
+  // Joins can output far more rows than their inputs contain (e.g., for non-equi predicates or duplicate keys). Output
+  // chunks are therefore limited to the target chunk size of the left input, which also keeps them addressable by
+  // ChunkOffset.
+  const auto target_chunk_size = left_input_table->target_chunk_size();
+  auto output_table = std::make_shared<Table>(target_chunk_size);
+  for (auto column_id = ColumnID{0}; column_id < left_input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(left_input_table->column_name(column_id),
+                                        left_input_table->column_type(column_id),
+                                        left_input_table->column_nullable(column_id));
+  }
+  if (outputs_right_columns) {
+    for (auto column_id = ColumnID{0}; column_id < right_input_table->column_count(); ++column_id) {
+      output_table->add_column_definition(right_input_table->column_name(column_id),
+                                          right_input_table->column_type(column_id),
+                                          right_input_table->column_nullable(column_id) || _mode == JoinMode::Left);
+    }
+  }
+
+  const auto left_pos_lists = pos_lists_by_column(*left_input_table);
+  const auto right_pos_lists = outputs_right_columns ? pos_lists_by_column(*right_input_table)
+                                                     : std::vector<PosListsByChunk>{};
+
+  const auto append_chunk = [&](const std::shared_ptr<const PosList>& left_pos_list,
+                                const std::shared_ptr<const PosList>& right_pos_list) {
+    auto chunk = std::make_shared<Chunk>();
+    add_reference_segments(*chunk, left_input_table, left_pos_list, left_pos_lists);
+    if (outputs_right_columns) {
+      add_reference_segments(*chunk, right_input_table, right_pos_list, right_pos_lists);
+    }
+    output_table->append_chunk(chunk);
+  };
+
+  auto appended_chunk = false;
+  for (const auto& output_chunk : output_chunks) {
+    if (!output_chunk.left_pos_list || output_chunk.left_pos_list->empty()) {
+      continue;
+    }
+
+    const auto& left_pos_list = *output_chunk.left_pos_list;
+    const auto row_count = left_pos_list.size();
+    DebugAssert(!outputs_right_columns || output_chunk.right_pos_list->size() == row_count,
+                "Position lists of an output chunk must have the same size.");
+    appended_chunk = true;
+    if (row_count <= target_chunk_size) {
+      append_chunk(output_chunk.left_pos_list, output_chunk.right_pos_list);
+      continue;
+    }
+
+    for (auto begin_index = size_t{0}; begin_index < row_count; begin_index += target_chunk_size) {
+      const auto end_index = std::min(begin_index + target_chunk_size, row_count);
+      const auto left_slice = std::make_shared<const PosList>(left_pos_list.cbegin() + begin_index,
+                                                              left_pos_list.cbegin() + end_index);
+      const auto right_slice =
+          outputs_right_columns ? std::make_shared<const PosList>(output_chunk.right_pos_list->cbegin() + begin_index,
+                                                                  output_chunk.right_pos_list->cbegin() + end_index)
+                                : nullptr;
+      append_chunk(left_slice, right_slice);
+    }
+  }
+
+  if (!appended_chunk) {
+    append_empty_chunk(*output_table);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
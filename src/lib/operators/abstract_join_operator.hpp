@@ -0,0 +1,51 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// Super class of all join operators. A join compares the values of a column of the left input with the values of a
+// column of the right input and returns the qualifying pairs of rows (see JoinMode). The output consists of the
+// columns of the left input followed by the columns of the right input (the latter are omitted for Semi and Anti
+// joins). NULL values never match.
+class AbstractJoinOperator : public AbstractOperator {
+ public:
+  AbstractJoinOperator(const std::shared_ptr<const AbstractOperator>& left,
+                       const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                       const ColumnID left_column_id, const ScanType scan_type, const ColumnID right_column_id);
+
+  JoinMode mode() const;
+
+  ColumnID left_column_id() const;
+
+  ScanType scan_type() const;
+
+  ColumnID right_column_id() const;
+
+  // Position lists of the rows that form one output chunk. The i-th positions of both lists form an output row. The
+  // right list is ignored for Semi and Anti joins and may contain NULL_ROW_IDs for Left joins.
+  struct OutputChunk {
+    std::shared_ptr<const PosList> left_pos_list;
+    std::shared_ptr<const PosList> right_pos_list;
+  };
+
+ protected:
+  // Creates the output table from the given chunks. Chunks with more rows than the left input's target chunk size are
+  // split. The positions reference the input tables. If an input table consists of reference segments itself, the
+  // positions are resolved so that the output references the underlying data tables.
+  std::shared_ptr<const Table> _build_output_table(const std::vector<OutputChunk>& output_chunks) const;
+
+  const JoinMode _mode;
+  const ColumnID _left_column_id;
+  const ScanType _scan_type;
+  const ColumnID _right_column_id;
+};
+
+}  // namespace opossum
@@ -1,16 +1,56 @@
 #include "abstract_operator.hpp"
+
+#include <array>
+
+#include "pipeline.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
 #include "utils/assert.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/timer.hpp"
 
 namespace opossum {
 
 AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
                                    const std::shared_ptr<const AbstractOperator> right)
-    : _left_input(left), _right_input(right) {}
+    : _left_input(left), _right_input(right), _max_parallelism{default_max_parallelism()} {}
 
 void AbstractOperator::execute() {
-  _output = _on_execute();
+  _worker_thread_recorder = std::make_unique<WorkerThreadRecorder>();
+  auto timer = Timer{};
+  {
+    const auto worker_thread_scope = WorkerThreadRecorder::Scope{*_worker_thread_recorder};
+    _output = _on_execute();
+  }
+  const auto walltime = timer.lap();
   Assert(_output, "No output Table was returned after operator execution.");
   _was_executed = true;
+  _finish_performance_data(walltime);
+}
+
+AsyncTask<std::shared_ptr<const Table>> AbstractOperator::execute_async(const CancellationToken token) {
+  const auto inputs = std::array{_left_input, _right_input};
+  for (const auto& input : inputs) {
+    if (input && !input->was_executed()) {
+      // Inputs are const to their consumers, but they need to be executed before them.
+      co_await std::const_pointer_cast<AbstractOperator>(input)->execute_async(token);
+    }
+  }
+
+  token.throw_if_cancelled();
+  // The walltime includes the time in which the operator yielded to other tasks.
+  _worker_thread_recorder = std::make_unique<WorkerThreadRecorder>();
+  auto timer = Timer{};
+  _output = co_await _on_execute_async(token);
+  const auto walltime = timer.lap();
+  Assert(_output, "No output Table was returned after operator execution.");
+  _was_executed = true;
+  _finish_performance_data(walltime);
+  co_return _output;
+}
+
+bool AbstractOperator::was_executed() const {
+  return _was_executed;
 }
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
@@ -18,6 +58,90 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+const OperatorPerformanceData& AbstractOperator::performance_data() const {
+  return _performance_data;
+}
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::left_input() const {
+  return _left_input;
+}
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::right_input() const {
+  return _right_input;
+}
+
+void AbstractOperator::set_row_budget(const uint64_t row_budget) {
+  _row_budget = row_budget;
+}
+
+std::optional<uint64_t> AbstractOperator::row_budget() const {
+  return _row_budget;
+}
+
+void AbstractOperator::set_max_parallelism(const size_t max_thread_count) {
+  Assert(max_thread_count > 0, "Operators need at least one thread.");
+  _max_parallelism = max_thread_count;
+}
+
+size_t AbstractOperator::max_parallelism() const {
+  return _max_parallelism;
+}
+
+std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy() const {
+  auto copied_operators = CopiedOperators{};
+  return _deep_copy(copied_operators);
+}
+
+void AbstractOperator::set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  _on_set_parameters(parameters);
+  for (const auto& input : {_left_input, _right_input}) {
+    if (input) {
+      std::const_pointer_cast<AbstractOperator>(input)->set_parameters(parameters);
+    }
+  }
+}
+
+std::optional<std::string> AbstractOperator::description() const {
+  return std::nullopt;
+}
+
+std::unique_ptr<AbstractPipelineStage> AbstractOperator::create_pipeline_stage() const {
+  return nullptr;
+}
+
+AsyncTask<std::shared_ptr<const Table>> AbstractOperator::_on_execute_async(const CancellationToken /*token*/) {
+  const auto worker_thread_scope = WorkerThreadRecorder::Scope{*_worker_thread_recorder};
+  co_return _on_execute();
+}
+
+std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy(CopiedOperators& copied_operators) const {
+  const auto iter = copied_operators.find(this);
+  if (iter != copied_operators.end()) {
+    return iter->second;
+  }
+
+  const auto copied_left_input = _left_input ? _left_input->_deep_copy(copied_operators) : nullptr;
+  const auto copied_right_input = _right_input ? _right_input->_deep_copy(copied_operators) : nullptr;
+  const auto copy = _on_deep_copy(copied_left_input, copied_right_input);
+  if (_row_budget) {
+    copy->set_row_budget(*_row_budget);
+  }
+  copy->_max_parallelism = _max_parallelism;
+  copied_operators.emplace(this, copy);
+  return copy;
+}
+
+std::string AbstractOperator::_describe_value(const AllTypeVariant& value) {
+  if (variant_is_null(value)) {
+    return "NULL";
+  }
+
+  const auto string_value = type_cast<std::string>(value);
+  return std::to_string(value.index()) + ":" + std::to_string(string_value.size()) + ":" + string_value;
+}
+
+void AbstractOperator::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& /*parameters*/) {}
+
 std::shared_ptr<const Table> AbstractOperator::_left_input_table() const {
   return _left_input->get_output();
 }
@@ -26,4 +150,25 @@ std::shared_ptr<const Table> AbstractOperator::_right_input_table() const {
   return _right_input->get_output();
 }
 
+void AbstractOperator::_finish_performance_data(const std::chrono::nanoseconds walltime) {
+  _performance_data.walltime = walltime;
+
+  // Operators without inputs pass on stored tables, others may pass on an input table (e.g., Print). Such outputs are
+  // not created by the operator, so their memory usage is not estimated, which would traverse the whole table.
+  auto passes_on_table = !_left_input && !_right_input;
+  for (const auto& input : {_left_input, _right_input}) {
+    if (input && input->get_output()) {
+      _performance_data.input_row_count += input->get_output()->row_count();
+      _performance_data.input_chunk_count += input->get_output()->chunk_count();
+      passes_on_table |= input->get_output() == _output;
+    }
+  }
+
+  _performance_data.output_row_count = _output->row_count();
+  _performance_data.output_chunk_count = _output->chunk_count();
+  _performance_data.output_bytes = passes_on_table ? 0 : _output->estimate_memory_usage();
+  _performance_data.worker_thread_count = _worker_thread_recorder->thread_count();
+  _worker_thread_recorder.reset();
+}
+
 }  // namespace opossum
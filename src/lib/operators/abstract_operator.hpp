@@ -1,23 +1,33 @@
 #pragma once
 
 #include <memory>
-
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "all_type_variant.hpp"
+#include "operator_performance_data.hpp"
+#include "scheduler/async_task.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "scheduler/worker_thread_recorder.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class AbstractPipelineStage;
 class Table;
 
 // AbstractOperator is the abstract super class for all operators. All operators have up to two input tables and one
 // output table. Their lifecycle has three phases:
 // 1. The operator is constructed. Previous operators are not guaranteed to have already executed, so operators must not
 // call get_output in their execute method
-// 2. The execute method is called from the outside (usually by the scheduler). This is where the heavy lifting is done.
-// By now, the input operators have already executed.
+// 2. The execute method is called from the outside (usually by the Scheduler, see OperatorTask). This is where the
+// heavy lifting is done. By now, the input operators have already executed.
 // 3. The consumer (usually another operator) calls get_output. This should be very cheap. It is only guaranteed to
 // succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
 //
-// Operators shall not be executed twice.
+// Operators shall not be executed twice. To execute a plan again, e.g., with different parameters, execute a deep_copy
+// of it.
 
 class AbstractOperator : private Noncopyable {
  public:
@@ -32,21 +42,98 @@ class AbstractOperator : private Noncopyable {
 
   void execute();
 
+  // Executes the operator and, before it, its inputs that were not executed yet as coroutines on the Scheduler.
+  // Returns at once; the output can be awaited with co_await or get(). The token is checked before each operator and,
+  // by operators that support it (e.g., TableScan), between chunks, where long-running operators also yield to other
+  // tasks. If it was cancelled, the output rethrows OperationCancelled. The operator and its inputs need to be kept
+  // alive until the output is available.
+  AsyncTask<std::shared_ptr<const Table>> execute_async(const CancellationToken token = {});
+
+  bool was_executed() const;
+
   // Returns the result of the operator.
   std::shared_ptr<const Table> get_output() const;
 
+  // Returns what the operator did during its execution (e.g., its walltime and output row count). Is empty until the
+  // operator was executed. Outputs that the ResultCache set do not have performance data.
+  const OperatorPerformanceData& performance_data() const;
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> left_input() const;
   std::shared_ptr<const AbstractOperator> right_input() const;
 
+  // Informs the operator that its consumer only needs the first row_budget rows of its output (e.g., because of a
+  // Limit, see Limit::propagate_row_budgets). Operators that support this (e.g., TableScan) may then skip work. Only
+  // the first row_budget rows of their output are guaranteed to be the same as without the budget. Has no effect once
+  // the operator was executed.
+  void set_row_budget(const uint64_t row_budget);
+
+  std::optional<uint64_t> row_budget() const;
+
+  // Limits the number of threads that execute the operator in parallel (e.g., that scan the input's chunks).
+  // Defaults to the number of hardware threads. Setting it to 1 executes the operator on the calling thread. Operators
+  // that are not parallelized ignore it.
+  void set_max_parallelism(const size_t max_thread_count);
+
+  size_t max_parallelism() const;
+
+  // Returns a copy of the operator and its inputs that was not executed yet. The copies share the immutable parts of
+  // the plan (e.g., a TableWrapper's table), so that copying a plan is cheap. An input that is used by several
+  // operators is copied once. Executed plans can be copied as well.
+  std::shared_ptr<AbstractOperator> deep_copy() const;
+
+  // Binds values to the placeholders (e.g., of a TableScan) in the operator and its inputs. Afterwards, the
+  // placeholders are regular values, so that the plan can be executed. Parameters that do not occur in the plan are
+  // ignored. Plan templates with placeholders are not executed themselves. Instead, deep copies are bound and executed.
+  void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
+
+  // Returns a description of what the operator computes from its inputs, i.e., of all settings that influence its
+  // output (but not, e.g., of its parallelism), or std::nullopt if the operator cannot be described (e.g., because it
+  // has side effects or unbound placeholders). Operators without inputs include the id and the version of their table
+  // (see Table::id), so that their description changes when the table is modified. Used by the ResultCache.
+  virtual std::optional<std::string> description() const;
+
+  // Returns the stage that executes the operator batch by batch in a Pipeline, or nullptr if the operator does not
+  // support pipelined execution (e.g., because it needs its complete input). Operators that do return a stage need to
+  // have a single input and output the columns of their input.
+  virtual std::unique_ptr<AbstractPipelineStage> create_pipeline_stage() const;
+
  protected:
   // Abstract method to actually execute the operator execute and get_output are split into two methods to allow for
   // easier asynchronous execution.
   virtual std::shared_ptr<const Table> _on_execute() = 0;
 
+  // The coroutine that execute_async uses to execute the operator itself. By default, it calls _on_execute.
+  virtual AsyncTask<std::shared_ptr<const Table>> _on_execute_async(const CancellationToken token);
+
+  // Pipelines copy the operators they fuse. The ResultCache sets the outputs of operators whose result is cached.
+  friend class Pipeline;
+  friend class ResultCache;
+
+  // Describes the value including its type and, for strings, their length, so that different values are never
+  // described the same way.
+  static std::string _describe_value(const AllTypeVariant& value);
+
+  // Maps the copied operators to their copies.
+  using CopiedOperators = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>;
+
+  std::shared_ptr<AbstractOperator> _deep_copy(CopiedOperators& copied_operators) const;
+
+  // Returns a new operator with the same settings (e.g., the radix bits of a JoinHash) and the given inputs. The row
+  // budget and the max parallelism are copied by _deep_copy.
+  virtual std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const = 0;
+
+  // Binds the operator's own placeholders. The default does nothing.
+  virtual void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
+
   std::shared_ptr<const Table> _left_input_table() const;
   std::shared_ptr<const Table> _right_input_table() const;
 
+  // Records the input and output sizes and the worker threads once the operator was executed.
+  void _finish_performance_data(const std::chrono::nanoseconds walltime);
+
   // Shared pointers to input operators. Can be nullptr, for example, if an operator is the leaf operator in the query
   // plan or if the operator has only one input operator.
   std::shared_ptr<const AbstractOperator> _left_input;
@@ -57,6 +144,16 @@ class AbstractOperator : private Noncopyable {
 
   // Is false until execute() is called
   bool _was_executed = false;
+
+  std::optional<uint64_t> _row_budget;
+
+  size_t _max_parallelism;
+
+  // Operators record their phases and pruned chunks, everything else is recorded by execute and execute_async.
+  OperatorPerformanceData _performance_data;
+
+  // Exists while the operator is executed.
+  std::unique_ptr<WorkerThreadRecorder> _worker_thread_recorder;
 };
 
 }  // namespace opossum
@@ -0,0 +1,726 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "resolve_type.hpp"
+#include "storage/segment_values.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+constexpr auto NO_GROUP = std::numeric_limits<uint32_t>::max();
+
+// Combinations of groups and codes are mapped to new groups with a dense array if there are at most this many of them,
+// and with a hash map otherwise.
+constexpr auto MAX_DENSE_GROUP_KEY_COUNT = uint64_t{1} << 16;
+
+// Dense codes for the values of a group-by column within one chunk. Codes [0, values.size()) stand for the values,
+// the code values.size() stands for NULL.
+struct BaseChunkCodes {
+  virtual ~BaseChunkCodes() = default;
+
+  std::vector<uint32_t> row_codes;
+  // Number of codes, including the one for NULL.
+  size_t code_count = 0;
+};
+
+template <typename T>
+struct ChunkCodes : public BaseChunkCodes {
+  // Values by code. Points to the dictionary for dictionary segments and to owned_values otherwise.
+  const std::vector<T>* values = nullptr;
+  std::vector<T> owned_values;
+};
+
+// Maps the values of a group-by column to chunk-local codes and the chunk-local codes to global codes.
+class BaseGroupByColumn {
+ public:
+  virtual ~BaseGroupByColumn() = default;
+
+  // Returns the chunk-local codes of the segment's rows. May be called concurrently.
+  virtual std::unique_ptr<BaseChunkCodes> encode(const AbstractSegment& segment) const = 0;
+
+  // Returns the global code of a chunk-local code. Values that were not seen before get a new global code.
+  virtual uint32_t global_code(const BaseChunkCodes& chunk_codes, const uint32_t code) = 0;
+
+  // Returns a segment that holds the values of the given global codes.
+  virtual std::shared_ptr<AbstractSegment> output_segment(const std::vector<uint32_t>& codes) const = 0;
+};
+
+template <typename T>
+class GroupByColumn final : public BaseGroupByColumn {
+ public:
+  explicit GroupByColumn(const bool nullable) : _nullable{nullable} {}
+
+  std::unique_ptr<BaseChunkCodes> encode(const AbstractSegment& segment) const final {
+    auto chunk_codes = std::make_unique<ChunkCodes<T>>();
+    auto& row_codes = chunk_codes->row_codes;
+    row_codes.resize(segment.size());
+
+    // The value ids are dense codes already, and the NULL value id (i.e., the dictionary size) is the code for NULL.
+    if (const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(&segment)) {
+      chunk_codes->values = &dictionary_segment->dictionary();
+      chunk_codes->code_count = chunk_codes->values->size() + 1;
+      resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.values();
+        std::copy(value_ids.cbegin(), value_ids.cbegin() + row_codes.size(), row_codes.begin());
+      });
+      return chunk_codes;
+    }
+
+    auto& values = chunk_codes->owned_values;
+    auto codes = std::unordered_map<T, uint32_t>{};
+    auto null_chunk_offsets = std::vector<ChunkOffset>{};
+    for_each_segment_value<T>(
+        segment,
+        [&](const ChunkOffset chunk_offset, const T& value) {
+          const auto [code_it, inserted] = codes.try_emplace(value, static_cast<uint32_t>(values.size()));
+          if (inserted) {
+            values.push_back(value);
+          }
+          row_codes[chunk_offset] = code_it->second;
+        },
+        [&](const ChunkOffset chunk_offset) { null_chunk_offsets.push_back(chunk_offset); });
+
+    // The code for NULL is only known once all values have been seen.
+    for (const auto chunk_offset : null_chunk_offsets) {
+      row_codes[chunk_offset] = static_cast<uint32_t>(values.size());
+    }
+    chunk_codes->values = &values;
+    chunk_codes->code_count = values.size() + 1;
+    return chunk_codes;
+  }
+
+  uint32_t global_code(const BaseChunkCodes& base_chunk_codes, const uint32_t code) final {
+    const auto& chunk_codes = static_cast<const ChunkCodes<T>&>(base_chunk_codes);
+    if (code == chunk_codes.values->size()) {
+      if (!_null_code) {
+        _null_code = static_cast<uint32_t>(_values.size());
+        _values.emplace_back();
+        _null_values.push_back(true);
+      }
+      return *_null_code;
+    }
+
+    const auto& value = (*chunk_codes.values)[code];
+    const auto [code_it, inserted] = _codes.try_emplace(value, static_cast<uint32_t>(_values.size()));
+    if (inserted) {
+      _values.push_back(value);
+      _null_values.push_back(false);
+    }
+    return code_it->second;
+  }
+
+  std::shared_ptr<AbstractSegment> output_segment(const std::vector<uint32_t>& codes) const final {
+    auto values = std::vector<T>(codes.size());
+    auto null_values = std::vector<bool>(codes.size());
+    for (auto index = size_t{0}; index < codes.size(); ++index) {
+      values[index] = _values[codes[index]];
+      null_values[index] = _null_values[codes[index]];
+    }
+
+    if (!_nullable) {
+      return std::make_shared<ValueSegment<T>>(std::move(values));
+    }
+    return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  }
+
+ protected:
+  const bool _nullable;
+  std::unordered_map<T, uint32_t> _codes;
+  std::optional<uint32_t> _null_code;
+  std::vector<T> _values;
+  std::vector<bool> _null_values;
+};
+
+// The states of one aggregate for all groups, e.g., the sums and counts for Avg.
+class BaseAggregateStates {
+ public:
+  virtual ~BaseAggregateStates() = default;
+
+  // Returns states of the same aggregate for the given number of groups.
+  virtual std::unique_ptr<BaseAggregateStates> create(const size_t group_count) const = 0;
+
+  // Adds the values of the segment to the states of the rows' groups. The segment is nullptr for COUNT(*).
+  virtual void aggregate(const AbstractSegment* segment, const std::vector<uint32_t>& row_groups) = 0;
+
+  virtual void resize(const size_t group_count) = 0;
+
+  // Adds the states of other, which were created by create(), to these states. Group i of other is group
+  // group_mapping[i] of these states.
+  virtual void merge(const BaseAggregateStates& other, const std::vector<uint32_t>& group_mapping) = 0;
+
+  // Returns a segment with the result of each group.
+  virtual std::shared_ptr<AbstractSegment> output_segment() const = 0;
+};
+
+template <typename T>
+class CountStates final : public BaseAggregateStates {
+ public:
+  explicit CountStates(const size_t group_count) : _counts(group_count) {}
+
+  std::unique_ptr<BaseAggregateStates> create(const size_t group_count) const final {
+    return std::make_unique<CountStates>(group_count);
+  }
+
+  void aggregate(const AbstractSegment* segment, const std::vector<uint32_t>& row_groups) final {
+    if (_counts.size() == 1) {
+      if (!segment) {
+        _counts[0] += static_cast<int64_t>(row_groups.size());
+        return;
+      }
+      if (const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(segment)) {
+        _counts[0] += dictionary_segment->size() - dictionary_segment->null_count();
+        return;
+      }
+    }
+
+    if (!segment) {
+      for (const auto group : row_groups) {
+        ++_counts[group];
+      }
+      return;
+    }
+
+    for_each_segment_value<T>(
+        *segment, [&](const ChunkOffset chunk_offset, const T& /*value*/) { ++_counts[row_groups[chunk_offset]]; },
+        [](const ChunkOffset /*chunk_offset*/) {});
+  }
+
+  void resize(const size_t group_count) final {
+    _counts.resize(group_count);
+  }
+
+  void merge(const BaseAggregateStates& base_other, const std::vector<uint32_t>& group_mapping) final {
+    const auto& other = static_cast<const CountStates&>(base_other);
+    for (auto group = size_t{0}; group < group_mapping.size(); ++group) {
+      _counts[group_mapping[group]] += other._counts[group];
+    }
+  }
+
+  std::shared_ptr<AbstractSegment> output_segment() const final {
+    return std::make_shared<ValueSegment<int64_t>>(std::vector<int64_t>(_counts));
+  }
+
+ protected:
+  std::vector<int64_t> _counts;
+};
+
+template <typename T>
+class CountDistinctStates final : public BaseAggregateStates {
+ public:
+  explicit CountDistinctStates(const size_t group_count) : _distinct_values(group_count) {}
+
+  std::unique_ptr<BaseAggregateStates> create(const size_t group_count) const final {
+    return std::make_unique<CountDistinctStates>(group_count);
+  }
+
+  void aggregate(const AbstractSegment* segment, const std::vector<uint32_t>& row_groups) final {
+    // For dictionary segments, each distinct pair of group and value id is looked up in the dictionary only once. If
+    // all rows belong to the same group, the distinct values are the dictionary.
+    if (const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(segment)) {
+      const auto& dictionary = dictionary_segment->dictionary();
+      if (_distinct_values.size() == 1) {
+        _distinct_values[0].insert(dictionary.cbegin(), dictionary.cend());
+        return;
+      }
+
+      const auto null_value_id = dictionary_segment->null_value_id();
+      auto group_value_ids = std::unordered_set<uint64_t>{};
+      resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.values();
+        for (auto chunk_offset = size_t{0}; chunk_offset < row_groups.size(); ++chunk_offset) {
+          const auto value_id = static_cast<uint32_t>(value_ids[chunk_offset]);
+          const auto group = row_groups[chunk_offset];
+          if (value_id != null_value_id && group_value_ids.insert((uint64_t{group} << 32) | value_id).second) {
+            _distinct_values[group].insert(dictionary[value_id]);
+          }
+        }
+      });
+      return;
+    }
+
+    for_each_segment_value<T>(
+        *segment,
+        [&](const ChunkOffset chunk_offset, const T& value) {
+          _distinct_values[row_groups[chunk_offset]].insert(value);
+        },
+        [](const ChunkOffset /*chunk_offset*/) {});
+  }
+
+  void resize(const size_t group_count) final {
+    _distinct_values.resize(group_count);
+  }
+
+  void merge(const BaseAggregateStates& base_other, const std::vector<uint32_t>& group_mapping) final {
+    const auto& other = static_cast<const CountDistinctStates&>(base_other);
+    for (auto group = size_t{0}; group < group_mapping.size(); ++group) {
+      const auto& other_values = other._distinct_values[group];
+      _distinct_values[group_mapping[group]].insert(other_values.cbegin(), other_values.cend());
+    }
+  }
+
+  std::shared_ptr<AbstractSegment> output_segment() const final {
+    auto counts = std::vector<int64_t>(_distinct_values.size());
+    for (auto group = size_t{0}; group < counts.size(); ++group) {
+      counts[group] = static_cast<int64_t>(_distinct_values[group].size());
+    }
+    return std::make_shared<ValueSegment<int64_t>>(std::move(counts));
+  }
+
+ protected:
+  std::vector<std::unordered_set<T>> _distinct_values;
+};
+
+// States of Sum and Avg. Integral values are summed up as longs, floating-point values as doubles.
+template <typename T, AggregateFunction function>
+class SumStates final : public BaseAggregateStates {
+ public:
+  using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+
+  explicit SumStates(const size_t group_count) : _sums(group_count), _counts(group_count) {}
+
+  std::unique_ptr<BaseAggregateStates> create(const size_t group_count) const final {
+    return std::make_unique<SumStates>(group_count);
+  }
+
+  void aggregate(const AbstractSegment* segment, const std::vector<uint32_t>& row_groups) final {
+    // If all rows belong to the same group, dictionary segments are summed up from the number of occurrences of each
+    // dictionary entry.
+    const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(segment);
+    if (dictionary_segment && _sums.size() == 1) {
+      const auto& dictionary = dictionary_segment->dictionary();
+      const auto value_id_counts = dictionary_segment->value_id_counts();
+      for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+        _sums[0] += static_cast<SumType>(dictionary[value_id]) * static_cast<SumType>(value_id_counts[value_id]);
+      }
+      _counts[0] += dictionary_segment->size() - dictionary_segment->null_count();
+      return;
+    }
+
+    for_each_segment_value<T>(
+        *segment,
+        [&](const ChunkOffset chunk_offset, const T& value) {
+          const auto group = row_groups[chunk_offset];
+          _sums[group] += value;
+          ++_counts[group];
+        },
+        [](const ChunkOffset /*chunk_offset*/) {});
+  }
+
+  void resize(const size_t group_count) final {
+    _sums.resize(group_count);
+    _counts.resize(group_count);
+  }
+
+  void merge(const BaseAggregateStates& base_other, const std::vector<uint32_t>& group_mapping) final {
+    const auto& other = static_cast<const SumStates&>(base_other);
+    for (auto group = size_t{0}; group < group_mapping.size(); ++group) {
+      _sums[group_mapping[group]] += other._sums[group];
+      _counts[group_mapping[group]] += other._counts[group];
+    }
+  }
+
+  std::shared_ptr<AbstractSegment> output_segment() const final {
+    const auto group_count = _sums.size();
+    auto null_values = std::vector<bool>(group_count);
+    for (auto group = size_t{0}; group < group_count; ++group) {
+      null_values[group] = !_counts[group];
+    }
+
+    if constexpr (function == AggregateFunction::Sum) {
+      return std::make_shared<ValueSegment<SumType>>(std::vector<SumType>(_sums), std::move(null_values));
+    } else {
+      auto averages = std::vector<double>(group_count);
+      for (auto group = size_t{0}; group < group_count; ++group) {
+        averages[group] = _counts[group] ? static_cast<double>(_sums[group]) / static_cast<double>(_counts[group]) : 0;
+      }
+      return std::make_shared<ValueSegment<double>>(std::move(averages), std::move(null_values));
+    }
+  }
+
+ protected:
+  std::vector<SumType> _sums;
+  std::vector<int64_t> _counts;
+};
+
+template <typename T, AggregateFunction function>
+class MinMaxStates final : public BaseAggregateStates {
+ public:
+  explicit MinMaxStates(const size_t group_count) : _values(group_count), _has_values(group_count) {}
+
+  std::unique_ptr<BaseAggregateStates> create(const size_t group_count) const final {
+    return std::make_unique<MinMaxStates>(group_count);
+  }
+
+  void aggregate(const AbstractSegment* segment, const std::vector<uint32_t>& row_groups) final {
+    // As the dictionary is sorted, dictionary segments are aggregated on the value ids, and only the resulting value
+    // ids are looked up.
+    if (const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(segment)) {
+      // If all rows belong to the same group, the result is the first or last dictionary entry.
+      if (_values.size() == 1) {
+        const auto value = function == AggregateFunction::Min ? dictionary_segment->min() : dictionary_segment->max();
+        if (value) {
+          _update(0, *value);
+        }
+        return;
+      }
+
+      const auto null_value_id = dictionary_segment->null_value_id();
+      auto group_value_ids = std::vector<ValueID>(_values.size(), null_value_id);
+      resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.values();
+        for (auto chunk_offset = size_t{0}; chunk_offset < row_groups.size(); ++chunk_offset) {
+          const auto value_id = static_cast<ValueID>(value_ids[chunk_offset]);
+          auto& group_value_id = group_value_ids[row_groups[chunk_offset]];
+          if (value_id != null_value_id && (group_value_id == null_value_id || _is_better(value_id, group_value_id))) {
+            group_value_id = value_id;
+          }
+        }
+      });
+
+      const auto& dictionary = dictionary_segment->dictionary();
+      for (auto group = size_t{0}; group < group_value_ids.size(); ++group) {
+        if (group_value_ids[group] != null_value_id) {
+          _update(group, dictionary[group_value_ids[group]]);
+        }
+      }
+      return;
+    }
+
+    for_each_segment_value<T>(
+        *segment, [&](const ChunkOffset chunk_offset, const T& value) { _update(row_groups[chunk_offset], value); },
+        [](const ChunkOffset /*chunk_offset*/) {});
+  }
+
+  void resize(const size_t group_count) final {
+    _values.resize(group_count);
+    _has_values.resize(group_count);
+  }
+
+  void merge(const BaseAggregateStates& base_other, const std::vector<uint32_t>& group_mapping) final {
+    const auto& other = static_cast<const MinMaxStates&>(base_other);
+    for (auto group = size_t{0}; group < group_mapping.size(); ++group) {
+      if (other._has_values[group]) {
+        _update(group_mapping[group], other._values[group]);
+      }
+    }
+  }
+
+  std::shared_ptr<AbstractSegment> output_segment() const final {
+    auto null_values = std::vector<bool>(_has_values.size());
+    for (auto group = size_t{0}; group < null_values.size(); ++group) {
+      null_values[group] = !_has_values[group];
+    }
+    return std::make_shared<ValueSegment<T>>(std::vector<T>(_values), std::move(null_values));
+  }
+
+ protected:
+  template <typename V>
+  static bool _is_better(const V& value, const V& current_value) {
+    if constexpr (function == AggregateFunction::Min) {
+      return value < current_value;
+    } else {
+      return current_value < value;
+    }
+  }
+
+  void _update(const size_t group, const T& value) {
+    if (!_has_values[group] || _is_better(value, _values[group])) {
+      _values[group] = value;
+      _has_values[group] = true;
+    }
+  }
+
+  std::vector<T> _values;
+  std::vector<bool> _has_values;
+};
+
+// Returns empty states for the aggregate. column_data_type is std::nullopt for COUNT(*).
+std::unique_ptr<BaseAggregateStates> make_aggregate_states(const AggregateFunction function,
+                                                           const std::optional<DataType> column_data_type) {
+  if (!column_data_type) {
+    return std::make_unique<CountStates<int32_t>>(0);
+  }
+
+  auto states = std::unique_ptr<BaseAggregateStates>{};
+  resolve_data_type(*column_data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    switch (function) {
+      case AggregateFunction::Count:
+        states = std::make_unique<CountStates<Type>>(0);
+        return;
+      case AggregateFunction::CountDistinct:
+        states = std::make_unique<CountDistinctStates<Type>>(0);
+        return;
+      case AggregateFunction::Min:
+        states = std::make_unique<MinMaxStates<Type, AggregateFunction::Min>>(0);
+        return;
+      case AggregateFunction::Max:
+        states = std::make_unique<MinMaxStates<Type, AggregateFunction::Max>>(0);
+        return;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (std::is_same_v<Type, std::string>) {
+          Fail("Sum and Avg are not supported on strings.");
+        } else if (function == AggregateFunction::Sum) {
+          states = std::make_unique<SumStates<Type, AggregateFunction::Sum>>(0);
+        } else {
+          states = std::make_unique<SumStates<Type, AggregateFunction::Avg>>(0);
+        }
+        return;
+    }
+  });
+  return states;
+}
+
+std::string output_column_type(const AggregateFunction function, const std::string& column_type) {
+  switch (function) {
+    case AggregateFunction::Count:
+    case AggregateFunction::CountDistinct:
+      return "long";
+    case AggregateFunction::Sum:
+      return column_type == "int" || column_type == "long" ? "long" : "double";
+    case AggregateFunction::Avg:
+      return "double";
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+      return column_type;
+  }
+  Fail("Unknown aggregate function.");
+}
+
+std::string output_column_name(const AggregateFunction function, const std::string& column_name) {
+  switch (function) {
+    case AggregateFunction::Count:
+      return "COUNT(" + column_name + ")";
+    case AggregateFunction::CountDistinct:
+      return "COUNT(DISTINCT " + column_name + ")";
+    case AggregateFunction::Sum:
+      return "SUM(" + column_name + ")";
+    case AggregateFunction::Min:
+      return "MIN(" + column_name + ")";
+    case AggregateFunction::Max:
+      return "MAX(" + column_name + ")";
+    case AggregateFunction::Avg:
+      return "AVG(" + column_name + ")";
+  }
+  Fail("Unknown aggregate function.");
+}
+
+// The chunk-local groups of a chunk and the chunk-local aggregate states.
+struct ChunkGroups {
+  // The group of each row of the chunk.
+  std::vector<uint32_t> row_groups;
+  size_t group_count = 0;
+  // Per group-by column, the codes of the chunk's values and the code of each group.
+  std::vector<std::unique_ptr<BaseChunkCodes>> column_codes;
+  std::vector<std::vector<uint32_t>> group_codes;
+  std::vector<std::unique_ptr<BaseAggregateStates>> aggregate_states;
+};
+
+// Refines the groups by another group-by column: each combination of a previous group and a code of the column forms
+// a new group. Group ids are assigned in the order of the groups' first rows.
+void add_group_by_column(ChunkGroups& groups, const BaseChunkCodes& codes) {
+  auto& row_groups = groups.row_groups;
+  const auto code_count = codes.code_count;
+  auto new_group_parents = std::vector<uint32_t>{};
+  auto new_group_codes = std::vector<uint32_t>{};
+
+  // new_group_of_key returns a reference to the new group of a key, which is NO_GROUP for keys that were not seen yet.
+  const auto assign_new_groups = [&](const auto& new_group_of_key) {
+    for (auto row_index = size_t{0}; row_index < row_groups.size(); ++row_index) {
+      const auto code = codes.row_codes[row_index];
+      auto& new_group = new_group_of_key(uint64_t{row_groups[row_index]} * code_count + code);
+      if (new_group == NO_GROUP) {
+        new_group = static_cast<uint32_t>(new_group_parents.size());
+        new_group_parents.push_back(row_groups[row_index]);
+        new_group_codes.push_back(code);
+      }
+      row_groups[row_index] = new_group;
+    }
+  };
+
+  if (groups.group_count * code_count <= MAX_DENSE_GROUP_KEY_COUNT) {
+    auto new_group_by_key = std::vector<uint32_t>(groups.group_count * code_count, NO_GROUP);
+    assign_new_groups([&](const uint64_t key) -> uint32_t& { return new_group_by_key[key]; });
+  } else {
+    auto new_group_by_key = std::unordered_map<uint64_t, uint32_t>{};
+    assign_new_groups(
+        [&](const uint64_t key) -> uint32_t& { return new_group_by_key.try_emplace(key, NO_GROUP).first->second; });
+  }
+
+  for (auto& column_group_codes : groups.group_codes) {
+    auto refined_group_codes = std::vector<uint32_t>(new_group_parents.size());
+    for (auto group = size_t{0}; group < new_group_parents.size(); ++group) {
+      refined_group_codes[group] = column_group_codes[new_group_parents[group]];
+    }
+    column_group_codes = std::move(refined_group_codes);
+  }
+  groups.group_codes.push_back(std::move(new_group_codes));
+  groups.group_count = new_group_parents.size();
+}
+
+}  // namespace
+
+namespace opossum {
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator>& in,
+                     const std::vector<AggregateDefinition>& aggregates,
+                     const std::vector<ColumnID>& group_by_column_ids)
+    : AbstractOperator{in}, _aggregates{aggregates}, _group_by_column_ids{group_by_column_ids} {}
+
+const std::vector<AggregateDefinition>& Aggregate::aggregates() const {
+  return _aggregates;
+}
+
+const std::vector<ColumnID>& Aggregate::group_by_column_ids() const {
+  return _group_by_column_ids;
+}
+
+std::optional<std::string> Aggregate::description() const {
+  auto description = std::string{"Aggregate"};
+  for (const auto& aggregate : _aggregates) {
+    description += " " + std::to_string(static_cast<int>(aggregate.function)) + ":" +
+                   (aggregate.column_id ? std::to_string(*aggregate.column_id) : "*");
+  }
+  description += " BY";
+  for (const auto column_id : _group_by_column_ids) {
+    description += " " + std::to_string(column_id);
+  }
+  return description;
+}
+
+std::shared_ptr<AbstractOperator> Aggregate::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  return std::make_shared<Aggregate>(copied_left_input, _aggregates, _group_by_column_ids);
+}
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(input_table, "Aggregate requires an input.");
+  const auto column_count = input_table->column_count();
+
+  auto group_by_columns = std::vector<std::unique_ptr<BaseGroupByColumn>>{};
+  for (const auto column_id : _group_by_column_ids) {
+    Assert(column_id < column_count, "Group-by column does not exist.");
+    resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      group_by_columns.push_back(std::make_unique<GroupByColumn<Type>>(input_table->column_nullable(column_id)));
+    });
+  }
+
+  auto global_states = std::vector<std::unique_ptr<BaseAggregateStates>>{};
+  for (const auto& aggregate : _aggregates) {
+    Assert(aggregate.column_id || aggregate.function == AggregateFunction::Count,
+           "Only Count can be applied to all rows.");
+    Assert(!aggregate.column_id || *aggregate.column_id < column_count, "Aggregate column does not exist.");
+    const auto column_data_type =
+        aggregate.column_id ? std::optional{input_table->column_data_type(*aggregate.column_id)} : std::nullopt;
+    global_states.push_back(make_aggregate_states(aggregate.function, column_data_type));
+  }
+
+  // Aggregate each chunk into chunk-local groups.
+  auto timer = Timer{};
+  const auto chunk_count = input_table->chunk_count();
+  auto chunk_groups = std::vector<ChunkGroups>(chunk_count);
+  parallel_for(chunk_count, _max_parallelism, [&](const size_t chunk_index) {
+    const auto chunk = input_table->get_chunk(static_cast<ChunkID>(chunk_index));
+    auto& groups = chunk_groups[chunk_index];
+    groups.row_groups.resize(chunk->size());
+    groups.group_count = 1;
+
+    for (auto column_index = size_t{0}; column_index < group_by_columns.size(); ++column_index) {
+      auto codes = group_by_columns[column_index]->encode(*chunk->get_segment(_group_by_column_ids[column_index]));
+      add_group_by_column(groups, *codes);
+      codes->row_codes = {};
+      groups.column_codes.push_back(std::move(codes));
+    }
+
+    for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+      const auto& column_id = _aggregates[aggregate_index].column_id;
+      const auto segment = column_id ? chunk->get_segment(*column_id) : nullptr;
+      auto states = global_states[aggregate_index]->create(groups.group_count);
+      states->aggregate(segment.get(), groups.row_groups);
+      groups.aggregate_states.push_back(std::move(states));
+    }
+    groups.row_groups = {};
+  });
+  _performance_data.add_phase("Chunk aggregation", timer.lap());
+
+  // Merge the chunk-local groups in chunk order. As within a chunk, the group-by columns are added one at a time: the
+  // group of the previous columns and the global code of the next column are mapped to the group of both. Without
+  // group-by columns, all rows belong to a single group.
+  const auto group_by_column_count = group_by_columns.size();
+  auto groups_by_key = std::vector<std::unordered_map<uint64_t, uint32_t>>(group_by_column_count);
+  auto group_codes = std::vector<std::vector<uint32_t>>(group_by_column_count);
+  auto group_count = size_t{group_by_column_count ? 0u : 1u};
+  auto codes = std::vector<uint32_t>(group_by_column_count);
+  for (auto& groups : chunk_groups) {
+    auto group_mapping = std::vector<uint32_t>(groups.group_count);
+    for (auto chunk_group = size_t{0}; chunk_group < groups.group_count; ++chunk_group) {
+      auto group = uint32_t{0};
+      for (auto column_index = size_t{0}; column_index < group_by_column_count; ++column_index) {
+        const auto& chunk_codes = *groups.column_codes[column_index];
+        const auto chunk_code = groups.group_codes[column_index][chunk_group];
+        codes[column_index] = group_by_columns[column_index]->global_code(chunk_codes, chunk_code);
+        auto& column_groups = groups_by_key[column_index];
+        const auto key = (uint64_t{group} << 32) | codes[column_index];
+        group = column_groups.try_emplace(key, static_cast<uint32_t>(column_groups.size())).first->second;
+      }
+
+      if (group == group_count) {
+        for (auto column_index = size_t{0}; column_index < group_by_column_count; ++column_index) {
+          group_codes[column_index].push_back(codes[column_index]);
+        }
+        ++group_count;
+      }
+      group_mapping[chunk_group] = group;
+    }
+
+    for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+      global_states[aggregate_index]->resize(group_count);
+      global_states[aggregate_index]->merge(*groups.aggregate_states[aggregate_index], group_mapping);
+    }
+    groups = ChunkGroups{};
+  }
+  _performance_data.add_phase("Merge", timer.lap());
+
+  // Create the output table.
+  auto output_table = std::make_shared<Table>();
+  auto output_chunk = std::make_shared<Chunk>();
+  for (auto column_index = size_t{0}; column_index < group_by_column_count; ++column_index) {
+    const auto column_id = _group_by_column_ids[column_index];
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_nullable(column_id));
+    output_chunk->add_segment(group_by_columns[column_index]->output_segment(group_codes[column_index]));
+  }
+
+  for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+    const auto& aggregate = _aggregates[aggregate_index];
+    const auto is_count =
+        aggregate.function == AggregateFunction::Count || aggregate.function == AggregateFunction::CountDistinct;
+    if (!aggregate.column_id) {
+      output_table->add_column_definition("COUNT(*)", "long", false);
+    } else {
+      output_table->add_column_definition(
+          output_column_name(aggregate.function, input_table->column_name(*aggregate.column_id)),
+          output_column_type(aggregate.function, input_table->column_type(*aggregate.column_id)), !is_count);
+    }
+    global_states[aggregate_index]->resize(group_count);
+    output_chunk->add_segment(global_states[aggregate_index]->output_segment());
+  }
+
+  output_table->append_chunk(output_chunk);
+  _performance_data.add_phase("Output", timer.lap());
+  return output_table;
+}
+
+}  // namespace opossum
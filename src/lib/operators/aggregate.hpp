@@ -0,0 +1,56 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// An aggregate function applied to a column of the input. Only Count may omit the column, which counts all rows
+// (COUNT(*)).
+struct AggregateDefinition {
+  AggregateFunction function;
+  std::optional<ColumnID> column_id;
+};
+
+// Groups the rows of the input by the values of the group-by columns and computes the aggregates per group. The output
+// consists of the group-by columns followed by one column per aggregate (e.g., "SUM(a)", "COUNT(*)", or
+// "COUNT(DISTINCT a)"). As in SQL, NULL values form a group of their own, and without group-by columns, the output
+// consists of exactly one row, even if the input is empty.
+//
+// Count and CountDistinct return longs, Sum returns longs for integral inputs and doubles otherwise, Avg returns
+// doubles, and Min and Max return the input type. Sum and Avg are not supported on strings.
+//
+// The chunks are aggregated in parallel into chunk-local groups, which are merged afterwards. Within a chunk, each
+// group-by column is mapped to dense codes first: dictionary segments use their value ids directly, other segments are
+// hashed. The groups are then identified by the combination of the codes, which uses dense arrays for small code
+// ranges. Thus, grouping by dictionary-encoded columns with few distinct values does not hash any value.
+//
+// If all rows of a chunk belong to the same group (e.g., without group-by columns), aggregates on dictionary segments
+// are answered from the segment as a whole: Min and Max from the dictionary's first and last entries, Count from the
+// number of NULLs, and Sum and Avg from the number of occurrences of each dictionary entry.
+class Aggregate : public AbstractOperator {
+ public:
+  Aggregate(const std::shared_ptr<const AbstractOperator>& in, const std::vector<AggregateDefinition>& aggregates,
+            const std::vector<ColumnID>& group_by_column_ids);
+
+  const std::vector<AggregateDefinition>& aggregates() const;
+
+  const std::vector<ColumnID>& group_by_column_ids() const;
+
+  std::optional<std::string> description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  const std::vector<AggregateDefinition> _aggregates;
+  const std::vector<ColumnID> _group_by_column_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,359 @@
+#include "column_comparison_scan.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "reference_output.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_values.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Calls the functor with a getter that returns the value at a given chunk offset. The getter does not detect NULLs
+// (it returns an arbitrary value for them), these are removed by apply_null_mask afterwards. This keeps the comparison
+// loop free of branches.
+template <typename T, typename Functor>
+void resolve_value_getter(const AbstractSegment& segment, const Functor& functor) {
+  if (const auto* value_segment = segment_cast<ValueSegment<T>>(&segment)) {
+    const auto& values = value_segment->values();
+    functor([&values](const ChunkOffset offset) -> const T& { return values[offset]; });
+    return;
+  }
+
+  const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(&segment);
+  Assert(dictionary_segment, "ColumnComparisonScan was called on unsupported segment type.");
+
+  const auto& dictionary = dictionary_segment->dictionary();
+  if (dictionary.empty()) {
+    // All values are NULL.
+    static const auto default_value = T{};
+    functor([](const ChunkOffset /*offset*/) -> const T& { return default_value; });
+    return;
+  }
+
+  // The NULL value id is one past the last dictionary entry. Clamping keeps the access in bounds.
+  const auto max_value_id = dictionary.size() - 1;
+  resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.values();
+    functor([&](const ChunkOffset offset) -> const T& {
+      return dictionary[std::min(static_cast<size_t>(value_ids[offset]), max_value_id)];
+    });
+  });
+}
+
+// Calls the functor with a getter that returns the value id at a given chunk offset.
+template <typename T, typename Functor>
+void resolve_value_id_getter(const DictionarySegment<T>& segment, const Functor& functor) {
+  resolve_attribute_vector(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.values();
+    functor([&value_ids](const ChunkOffset offset) { return value_ids[offset]; });
+  });
+}
+
+// Unsets all matches where the segment holds a NULL value.
+template <typename T, typename RowIterator>
+void apply_null_mask(const AbstractSegment& segment, const RowIterator rows_begin, const RowIterator rows_end,
+                     std::vector<uint8_t>& matches) {
+  if (const auto* value_segment = segment_cast<ValueSegment<T>>(&segment)) {
+    if (!value_segment->is_nullable()) {
+      return;
+    }
+
+    const auto& null_values = value_segment->null_values();
+    auto position = size_t{0};
+    for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++position) {
+      matches[position] &= !null_values[(*row_it).chunk_offset];
+    }
+    return;
+  }
+
+  const auto& dictionary_segment = static_cast<const DictionarySegment<T>&>(segment);
+  const auto null_value_id = dictionary_segment.null_value_id();
+  resolve_value_id_getter(dictionary_segment, [&](const auto& value_id_getter) {
+    auto position = size_t{0};
+    for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++position) {
+      matches[position] &= value_id_getter((*row_it).chunk_offset) != null_value_id;
+    }
+  });
+}
+
+// Calls the functor with a comparator for the scan type. To reduce the number of template instantiations, > and >=
+// are expressed as < and <= with swapped operands (signaled by the second argument).
+template <typename Functor>
+void resolve_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      functor(std::equal_to<>{}, false);
+      break;
+    case ScanType::OpNotEquals:
+      functor(std::not_equal_to<>{}, false);
+      break;
+    case ScanType::OpLessThan:
+      functor(std::less<>{}, false);
+      break;
+    case ScanType::OpLessThanEquals:
+      functor(std::less_equal<>{}, false);
+      break;
+    case ScanType::OpGreaterThan:
+      functor(std::less<>{}, true);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      functor(std::less_equal<>{}, true);
+      break;
+    default:
+      Fail("ColumnComparisonScan only supports comparison scan types.");
+  }
+}
+
+template <typename RowIterator, typename LeftGetter, typename RightGetter, typename Comparator>
+void compare(const RowIterator rows_begin, const RowIterator rows_end, const LeftGetter& left_getter,
+             const RightGetter& right_getter, const Comparator& comparator, std::vector<uint8_t>& matches) {
+  auto position = size_t{0};
+  for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++position) {
+    const auto offset = (*row_it).chunk_offset;
+    matches[position] = comparator(left_getter(offset), right_getter(offset));
+  }
+}
+
+// Returns whether both segments are dictionary segments with equal dictionaries. Value ids are then order-preserving
+// across both segments and we do not need to look at the actual values. This is common for columns that are filled
+// from the same domain. The check compares the dictionaries, so callers do it once per chunk.
+template <typename T>
+bool share_dictionary(const AbstractSegment& left_segment, const AbstractSegment& right_segment) {
+  const auto* left_dictionary_segment = segment_cast<DictionarySegment<T>>(&left_segment);
+  const auto* right_dictionary_segment = segment_cast<DictionarySegment<T>>(&right_segment);
+  return left_dictionary_segment && right_dictionary_segment &&
+         (left_dictionary_segment == right_dictionary_segment ||
+          left_dictionary_segment->dictionary() == right_dictionary_segment->dictionary());
+}
+
+// Compares the values of two segments of the same chunk at the chunk offsets of the rows [rows_begin, rows_end).
+// Returns one entry per row which is 1 if the values match and neither of them is NULL. If the segments share their
+// dictionary (see share_dictionary), value ids are compared instead of values.
+template <typename T, typename RowIterator>
+std::vector<uint8_t> compare_segments(const AbstractSegment& left_segment, const AbstractSegment& right_segment,
+                                      const bool shares_dictionary, const RowIterator rows_begin,
+                                      const RowIterator rows_end, const ScanType scan_type) {
+  auto matches = std::vector<uint8_t>(std::distance(rows_begin, rows_end));
+
+  resolve_comparator(scan_type, [&](const auto& comparator, const bool swap_operands) {
+    if (shares_dictionary) {
+      const auto& left_dictionary_segment = static_cast<const DictionarySegment<T>&>(left_segment);
+      const auto& right_dictionary_segment = static_cast<const DictionarySegment<T>&>(right_segment);
+      resolve_value_id_getter(left_dictionary_segment, [&](const auto& left_getter) {
+        resolve_value_id_getter(right_dictionary_segment, [&](const auto& right_getter) {
+          if (swap_operands) {
+            compare(rows_begin, rows_end, right_getter, left_getter, comparator, matches);
+          } else {
+            compare(rows_begin, rows_end, left_getter, right_getter, comparator, matches);
+          }
+        });
+      });
+    } else {
+      resolve_value_getter<T>(left_segment, [&](const auto& left_getter) {
+        resolve_value_getter<T>(right_segment, [&](const auto& right_getter) {
+          if (swap_operands) {
+            compare(rows_begin, rows_end, right_getter, left_getter, comparator, matches);
+          } else {
+            compare(rows_begin, rows_end, left_getter, right_getter, comparator, matches);
+          }
+        });
+      });
+    }
+  });
+
+  apply_null_mask<T>(left_segment, rows_begin, rows_end, matches);
+  apply_null_mask<T>(right_segment, rows_begin, rows_end, matches);
+  return matches;
+}
+
+// Compares the values of two segments of the same chunk and returns the offsets of the matching rows. Unlike
+// compare_segments, this supports reference segments with different position lists (e.g., the two sides of a join
+// output), at the cost of resolving each value individually.
+template <typename T>
+std::vector<ChunkOffset> compare_segment_values(const AbstractSegment& left_segment,
+                                                const AbstractSegment& right_segment, const ScanType scan_type) {
+  // The left values are referenced where they are stored. NULLs remain nullptr and never match.
+  auto left_values = std::vector<const T*>(left_segment.size());
+  for_each_segment_value<T>(
+      left_segment, [&](const ChunkOffset chunk_offset, const T& value) { left_values[chunk_offset] = &value; },
+      [](const ChunkOffset /*chunk_offset*/) {});
+
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  resolve_comparator(scan_type, [&](const auto& comparator, const bool swap_operands) {
+    for_each_segment_value<T>(
+        right_segment,
+        [&](const ChunkOffset chunk_offset, const T& right_value) {
+          const auto* left_value = left_values[chunk_offset];
+          if (left_value &&
+              (swap_operands ? comparator(right_value, *left_value) : comparator(*left_value, right_value))) {
+            chunk_offsets.push_back(chunk_offset);
+          }
+        },
+        [](const ChunkOffset /*chunk_offset*/) {});
+  });
+  return chunk_offsets;
+}
+
+}  // namespace
+
+namespace opossum {
+
+ColumnComparisonScan::ColumnComparisonScan(const std::shared_ptr<const AbstractOperator>& in,
+                                           const ColumnID left_column_id, const ScanType scan_type,
+                                           const ColumnID right_column_id)
+    : AbstractOperator{in},
+      _left_column_id{left_column_id},
+      _scan_type{scan_type},
+      _right_column_id{right_column_id} {}
+
+ColumnID ColumnComparisonScan::left_column_id() const {
+  return _left_column_id;
+}
+
+ScanType ColumnComparisonScan::scan_type() const {
+  return _scan_type;
+}
+
+ColumnID ColumnComparisonScan::right_column_id() const {
+  return _right_column_id;
+}
+
+std::optional<std::string> ColumnComparisonScan::description() const {
+  return "ColumnComparisonScan " + std::to_string(_left_column_id) + " " +
+         std::to_string(static_cast<int>(_scan_type)) + " " + std::to_string(_right_column_id);
+}
+
+std::shared_ptr<AbstractOperator> ColumnComparisonScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  return std::make_shared<ColumnComparisonScan>(copied_left_input, _left_column_id, _scan_type, _right_column_id);
+}
+
+std::shared_ptr<const Table> ColumnComparisonScan::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(input_table, "Performing a column comparison scan without input does not work.");
+
+  const auto column_data_type = input_table->column_data_type(_left_column_id);
+  Assert(column_data_type == input_table->column_data_type(_right_column_id),
+         "ColumnComparisonScan requires both columns to have the same data type.");
+  Assert(_scan_type != ScanType::OpLike && _scan_type != ScanType::OpNotLike && _scan_type != ScanType::OpIsNull &&
+             _scan_type != ScanType::OpIsNotNull,
+         "ColumnComparisonScan only supports comparison scan types.");
+
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size());
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_nullable(column_id));
+  }
+
+  const auto input_pos_lists = pos_lists_by_column(*input_table);
+  const auto chunk_count = input_table->chunk_count();
+  resolve_data_type(column_data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    // Whether the two columns share the dictionary in a chunk of the referenced table, which is checked once per
+    // referenced chunk.
+    enum class SharedDictionary : uint8_t { Unknown, Yes, No };
+    auto shared_dictionaries = std::vector<SharedDictionary>{};
+    auto shared_dictionaries_table = std::shared_ptr<const Table>{};
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      const auto chunk_size = chunk->size();
+      if (!chunk_size) {
+        continue;
+      }
+
+      const auto left_segment = chunk->get_segment(_left_column_id);
+      const auto right_segment = chunk->get_segment(_right_column_id);
+      const auto* left_reference_segment = segment_cast<ReferenceSegment>(left_segment.get());
+      const auto* right_reference_segment = segment_cast<ReferenceSegment>(right_segment.get());
+
+      // The offsets of the matching rows in the input chunk.
+      auto chunk_offsets = std::vector<ChunkOffset>{};
+      if (!left_reference_segment) {
+        const auto all_rows = ChunkRangePosList{chunk_id, 0, chunk_size};
+        const auto matches =
+            compare_segments<Type>(*left_segment, *right_segment, share_dictionary<Type>(*left_segment, *right_segment),
+                                   all_rows.begin(), all_rows.end(), _scan_type);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          if (matches[chunk_offset]) {
+            chunk_offsets.push_back(chunk_offset);
+          }
+        }
+      } else if (right_reference_segment->pos_list() != left_reference_segment->pos_list() ||
+                 right_reference_segment->referenced_table() != left_reference_segment->referenced_table()) {
+        // The columns reference different rows, e.g., when comparing columns of both inputs of a join.
+        chunk_offsets = compare_segment_values<Type>(*left_segment, *right_segment, _scan_type);
+      } else {
+        // Process the position list in runs of rows from the same referenced chunk so that the referenced segments
+        // are resolved once per run and not once per row.
+        const auto& referenced_table = left_reference_segment->referenced_table();
+        if (referenced_table != shared_dictionaries_table) {
+          shared_dictionaries.assign(referenced_table->chunk_count(), SharedDictionary::Unknown);
+          shared_dictionaries_table = referenced_table;
+        }
+        for_each_chunk_run(*left_reference_segment->pos_list(), [&](const ChunkID referenced_chunk_id,
+                                                                    const auto rows_begin, const auto rows_end,
+                                                                    const size_t first_index) {
+          // NULL_ROW_IDs form runs of INVALID_CHUNK_IDs and never match.
+          if (referenced_chunk_id == INVALID_CHUNK_ID) {
+            return;
+          }
+
+          const auto referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
+          const auto& referenced_left_segment =
+              *referenced_chunk->get_segment(left_reference_segment->referenced_column_id());
+          const auto& referenced_right_segment =
+              *referenced_chunk->get_segment(right_reference_segment->referenced_column_id());
+          auto& shared_dictionary = shared_dictionaries[referenced_chunk_id];
+          if (shared_dictionary == SharedDictionary::Unknown) {
+            shared_dictionary = share_dictionary<Type>(referenced_left_segment, referenced_right_segment)
+                                    ? SharedDictionary::Yes
+                                    : SharedDictionary::No;
+          }
+
+          const auto matches =
+              compare_segments<Type>(referenced_left_segment, referenced_right_segment,
+                                     shared_dictionary == SharedDictionary::Yes, rows_begin, rows_end, _scan_type);
+          auto chunk_offset = static_cast<ChunkOffset>(first_index);
+          for (const auto match : matches) {
+            if (match) {
+              chunk_offsets.push_back(chunk_offset);
+            }
+            ++chunk_offset;
+          }
+        });
+      }
+
+      if (chunk_offsets.empty()) {
+        continue;
+      }
+
+      // The columns of reference tables may reference different tables with different position lists (e.g., the
+      // output of a join), so the matching rows are resolved per column.
+      auto output_chunk = std::make_shared<Chunk>();
+      add_reference_segments(*output_chunk, input_table,
+                             make_single_chunk_pos_list(chunk_id, std::move(chunk_offsets), chunk_size),
+                             input_pos_lists);
+      output_table->append_chunk(output_chunk);
+    }
+  });
+
+  if (!output_table->row_count()) {
+    append_empty_chunk(*output_table);
+  }
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that compares two columns of the same input table row by row (e.g., `shipdate > commitdate`) and returns
+// the matching rows as reference segments. Both columns need to have the same data type. As for the TableScan, rows
+// where one of the values is NULL never match. Only the comparison scan types (OpEquals to OpGreaterThanEquals) are
+// supported. The columns of a reference table may reference different rows (e.g., columns from both inputs of a join),
+// but comparing columns that share their position list is faster.
+class ColumnComparisonScan : public AbstractOperator {
+ public:
+  ColumnComparisonScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID left_column_id,
+                       const ScanType scan_type, const ColumnID right_column_id);
+
+  ColumnID left_column_id() const;
+
+  ScanType scan_type() const;
+
+  ColumnID right_column_id() const;
+
+  std::optional<std::string> description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  const ColumnID _left_column_id;
+  const ScanType _scan_type;
+  const ColumnID _right_column_id;
+};
+
+}  // namespace opossum
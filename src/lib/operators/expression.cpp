@@ -0,0 +1,293 @@
+#include "expression.hpp"
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include <string_view>
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Numeric types from the narrowest to the widest.
+constexpr auto NUMERIC_TYPES = std::array<std::string_view, 4>{"int", "long", "float", "double"};
+
+// Multiplications and divisions bind stronger than additions and subtractions.
+int precedence(const ArithmeticOperator arithmetic_operator) {
+  switch (arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+    case ArithmeticOperator::Subtraction:
+      return 1;
+    case ArithmeticOperator::Multiplication:
+    case ArithmeticOperator::Division:
+      return 2;
+  }
+  Fail("Unknown arithmetic operator.");
+}
+
+// Describes values as in SQL, i.e., strings in quotes.
+std::string sql_value_description(const AllTypeVariant& value) {
+  auto description = std::stringstream{};
+  if (std::holds_alternative<std::string>(value)) {
+    description << "'" << value << "'";
+  } else {
+    description << value;
+  }
+  return description.str();
+}
+
+// Returns the description of an argument of an arithmetic expression, in parentheses if they are needed.
+std::string argument_description(const AbstractExpression& argument,
+                                 const AbstractExpression::ColumnDescriber& describe_column,
+                                 const AbstractExpression::ValueDescriber& describe_value,
+                                 const ArithmeticOperator parent_operator, const bool is_right_argument) {
+  auto needs_parentheses = dynamic_cast<const ComparisonExpression*>(&argument) != nullptr;
+  if (const auto* arithmetic_argument = dynamic_cast<const ArithmeticExpression*>(&argument)) {
+    const auto argument_precedence = precedence(arithmetic_argument->arithmetic_operator());
+    // a - (b - c) and a / (b * c) need parentheses, a - b - c and a * b * c do not.
+    needs_parentheses = argument_precedence < precedence(parent_operator) ||
+                        (is_right_argument && argument_precedence == precedence(parent_operator) &&
+                         (parent_operator == ArithmeticOperator::Subtraction ||
+                          parent_operator == ArithmeticOperator::Division));
+  }
+
+  const auto description = argument.describe(describe_column, describe_value);
+  return needs_parentheses ? "(" + description + ")" : description;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string AbstractExpression::description(const Table& table) const {
+  return describe([&](const ColumnID column_id) { return table.column_name(column_id); }, sql_value_description);
+}
+
+ColumnExpression::ColumnExpression(const ColumnID column_id) : _column_id{column_id} {}
+
+ColumnID ColumnExpression::column_id() const {
+  return _column_id;
+}
+
+std::string ColumnExpression::data_type(const Table& table) const {
+  return table.column_type(_column_id);
+}
+
+bool ColumnExpression::is_nullable(const Table& table) const {
+  return table.column_nullable(_column_id);
+}
+
+std::string ColumnExpression::describe(const ColumnDescriber& describe_column,
+                                      const ValueDescriber& /*describe_value*/) const {
+  return describe_column(_column_id);
+}
+
+ValueExpression::ValueExpression(const AllTypeVariant& value) : _value{value} {
+  Assert(!variant_is_null(value), "Value expressions must not be NULL.");
+}
+
+const AllTypeVariant& ValueExpression::value() const {
+  return _value;
+}
+
+std::string ValueExpression::data_type(const Table& /*table*/) const {
+  auto data_type = std::string{};
+  hana::for_each(data_types, [&](auto data_type_pair) {
+    using Type = typename decltype(+hana::second(data_type_pair))::type;
+    if (_value.index() == variant_index_of<Type>) {
+      data_type = hana::first(data_type_pair);
+    }
+  });
+  return data_type;
+}
+
+bool ValueExpression::is_nullable(const Table& /*table*/) const {
+  return false;
+}
+
+std::string ValueExpression::describe(const ColumnDescriber& /*describe_column*/,
+                                     const ValueDescriber& describe_value) const {
+  return describe_value(_value);
+}
+
+ArithmeticExpression::ArithmeticExpression(const ArithmeticOperator arithmetic_operator,
+                                           const std::shared_ptr<const AbstractExpression>& left,
+                                           const std::shared_ptr<const AbstractExpression>& right)
+    : _arithmetic_operator{arithmetic_operator}, _left{left}, _right{right} {
+  Assert(left && right, "Arithmetic expressions need two arguments.");
+}
+
+ArithmeticOperator ArithmeticExpression::arithmetic_operator() const {
+  return _arithmetic_operator;
+}
+
+const std::shared_ptr<const AbstractExpression>& ArithmeticExpression::left() const {
+  return _left;
+}
+
+const std::shared_ptr<const AbstractExpression>& ArithmeticExpression::right() const {
+  return _right;
+}
+
+std::string ArithmeticExpression::data_type(const Table& table) const {
+  const auto data_type = common_data_type(_left->data_type(table), _right->data_type(table));
+  Assert(data_type != "string", "Arithmetic expressions are not supported on strings.");
+  return data_type;
+}
+
+bool ArithmeticExpression::is_nullable(const Table& table) const {
+  return _arithmetic_operator == ArithmeticOperator::Division || _left->is_nullable(table) ||
+         _right->is_nullable(table);
+}
+
+std::string ArithmeticExpression::describe(const ColumnDescriber& describe_column,
+                                          const ValueDescriber& describe_value) const {
+  auto operator_string = std::string{};
+  switch (_arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      operator_string = " + ";
+      break;
+    case ArithmeticOperator::Subtraction:
+      operator_string = " - ";
+      break;
+    case ArithmeticOperator::Multiplication:
+      operator_string = " * ";
+      break;
+    case ArithmeticOperator::Division:
+      operator_string = " / ";
+      break;
+  }
+  return argument_description(*_left, describe_column, describe_value, _arithmetic_operator, false) +
+         operator_string + argument_description(*_right, describe_column, describe_value, _arithmetic_operator, true);
+}
+
+ComparisonExpression::ComparisonExpression(const ScanType scan_type,
+                                           const std::shared_ptr<const AbstractExpression>& left,
+                                           const std::shared_ptr<const AbstractExpression>& right)
+    : _scan_type{scan_type}, _left{left}, _right{right} {
+  Assert(left && right, "Comparison expressions need two arguments.");
+  Assert(scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals || scan_type == ScanType::OpLessThan ||
+             scan_type == ScanType::OpLessThanEquals || scan_type == ScanType::OpGreaterThan ||
+             scan_type == ScanType::OpGreaterThanEquals,
+         "Unsupported scan type for comparison expressions.");
+}
+
+ScanType ComparisonExpression::scan_type() const {
+  return _scan_type;
+}
+
+const std::shared_ptr<const AbstractExpression>& ComparisonExpression::left() const {
+  return _left;
+}
+
+const std::shared_ptr<const AbstractExpression>& ComparisonExpression::right() const {
+  return _right;
+}
+
+std::string ComparisonExpression::data_type(const Table& table) const {
+  // Checks that the arguments can be compared.
+  common_data_type(_left->data_type(table), _right->data_type(table));
+  return "int";
+}
+
+bool ComparisonExpression::is_nullable(const Table& table) const {
+  return _left->is_nullable(table) || _right->is_nullable(table);
+}
+
+std::string ComparisonExpression::describe(const ColumnDescriber& describe_column,
+                                          const ValueDescriber& describe_value) const {
+  auto operator_string = std::string{};
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      operator_string = " = ";
+      break;
+    case ScanType::OpNotEquals:
+      operator_string = " != ";
+      break;
+    case ScanType::OpLessThan:
+      operator_string = " < ";
+      break;
+    case ScanType::OpLessThanEquals:
+      operator_string = " <= ";
+      break;
+    case ScanType::OpGreaterThan:
+      operator_string = " > ";
+      break;
+    case ScanType::OpGreaterThanEquals:
+      operator_string = " >= ";
+      break;
+    default:
+      Fail("Unsupported scan type for comparison expressions.");
+  }
+
+  // Arithmetic binds stronger than comparisons, so only nested comparisons need parentheses.
+  const auto describe_argument = [&](const AbstractExpression& argument) {
+    const auto description = argument.describe(describe_column, describe_value);
+    return dynamic_cast<const ComparisonExpression*>(&argument) ? "(" + description + ")" : description;
+  };
+  return describe_argument(*_left) + operator_string + describe_argument(*_right);
+}
+
+CaseExpression::CaseExpression(const std::vector<Branch>& branches,
+                               const std::shared_ptr<const AbstractExpression>& else_expression)
+    : _branches{branches}, _else_expression{else_expression} {
+  Assert(!branches.empty(), "Case expressions need at least one branch.");
+  for (const auto& [condition, value] : branches) {
+    Assert(condition && value, "Case branches need a condition and a value.");
+  }
+}
+
+const std::vector<CaseExpression::Branch>& CaseExpression::branches() const {
+  return _branches;
+}
+
+const std::shared_ptr<const AbstractExpression>& CaseExpression::else_expression() const {
+  return _else_expression;
+}
+
+std::string CaseExpression::data_type(const Table& table) const {
+  auto data_type = _else_expression ? _else_expression->data_type(table) : _branches.front().second->data_type(table);
+  for (const auto& [condition, value] : _branches) {
+    Assert(condition->data_type(table) == "int", "Case conditions must be of type int.");
+    data_type = common_data_type(data_type, value->data_type(table));
+  }
+  return data_type;
+}
+
+bool CaseExpression::is_nullable(const Table& table) const {
+  return !_else_expression || _else_expression->is_nullable(table) ||
+         std::any_of(_branches.cbegin(), _branches.cend(),
+                     [&](const auto& branch) { return branch.second->is_nullable(table); });
+}
+
+std::string CaseExpression::describe(const ColumnDescriber& describe_column,
+                                    const ValueDescriber& describe_value) const {
+  auto description = std::string{"CASE"};
+  for (const auto& [condition, value] : _branches) {
+    description += " WHEN " + condition->describe(describe_column, describe_value) + " THEN " +
+                   value->describe(describe_column, describe_value);
+  }
+  if (_else_expression) {
+    description += " ELSE " + _else_expression->describe(describe_column, describe_value);
+  }
+  return description + " END";
+}
+
+std::string common_data_type(const std::string& left_type, const std::string& right_type) {
+  if (left_type == right_type) {
+    return left_type;
+  }
+
+  const auto left_it = std::find(NUMERIC_TYPES.cbegin(), NUMERIC_TYPES.cend(), left_type);
+  const auto right_it = std::find(NUMERIC_TYPES.cbegin(), NUMERIC_TYPES.cend(), right_type);
+  Assert(left_it != NUMERIC_TYPES.cend() && right_it != NUMERIC_TYPES.cend(),
+         "Cannot combine values of type " + left_type + " and " + right_type + ".");
+  return std::string{*std::max(left_it, right_it)};
+}
+
+}  // namespace opossum
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class ArithmeticOperator { Addition, Subtraction, Multiplication, Division };
+
+// Expressions compute a value for each row of a table (e.g., in a Projection). As in SQL, numeric arguments of
+// different types are converted to the wider type (int < long < float < double) and NULL arguments lead to NULL
+// results. Comparisons return 1 or 0 as int values.
+class AbstractExpression {
+ public:
+  // Describe the columns and the values of an expression in its description.
+  using ColumnDescriber = std::function<std::string(const ColumnID)>;
+  using ValueDescriber = std::function<std::string(const AllTypeVariant&)>;
+
+  virtual ~AbstractExpression() = default;
+
+  // Returns the type of the values ("int", "long", ...) if the expression is evaluated on the rows of the table.
+  virtual std::string data_type(const Table& table) const = 0;
+
+  // Returns whether the expression may be NULL for rows of the table.
+  virtual bool is_nullable(const Table& table) const = 0;
+
+  // Returns a SQL-like representation, e.g., "price * (1 - discount)", which Projections use as column name.
+  std::string description(const Table& table) const;
+
+  // Returns the same representation, but with columns and values described by the given functions. Operators use it
+  // to describe their expressions without a table, e.g., by column ids instead of names (see Projection::description).
+  virtual std::string describe(const ColumnDescriber& describe_column, const ValueDescriber& describe_value) const = 0;
+};
+
+// The value of a column of the table.
+class ColumnExpression : public AbstractExpression {
+ public:
+  explicit ColumnExpression(const ColumnID column_id);
+
+  ColumnID column_id() const;
+
+  std::string data_type(const Table& table) const override;
+  bool is_nullable(const Table& table) const override;
+  std::string describe(const ColumnDescriber& describe_column, const ValueDescriber& describe_value) const override;
+
+ protected:
+  const ColumnID _column_id;
+};
+
+// A constant value, which must not be NULL.
+class ValueExpression : public AbstractExpression {
+ public:
+  explicit ValueExpression(const AllTypeVariant& value);
+
+  const AllTypeVariant& value() const;
+
+  std::string data_type(const Table& table) const override;
+  bool is_nullable(const Table& table) const override;
+  std::string describe(const ColumnDescriber& describe_column, const ValueDescriber& describe_value) const override;
+
+ protected:
+  const AllTypeVariant _value;
+};
+
+// Arithmetic on numeric values. Divisions by zero return NULL.
+class ArithmeticExpression : public AbstractExpression {
+ public:
+  ArithmeticExpression(const ArithmeticOperator arithmetic_operator,
+                       const std::shared_ptr<const AbstractExpression>& left,
+                       const std::shared_ptr<const AbstractExpression>& right);
+
+  ArithmeticOperator arithmetic_operator() const;
+  const std::shared_ptr<const AbstractExpression>& left() const;
+  const std::shared_ptr<const AbstractExpression>& right() const;
+
+  std::string data_type(const Table& table) const override;
+  bool is_nullable(const Table& table) const override;
+  std::string describe(const ColumnDescriber& describe_column, const ValueDescriber& describe_value) const override;
+
+ protected:
+  const ArithmeticOperator _arithmetic_operator;
+  const std::shared_ptr<const AbstractExpression> _left;
+  const std::shared_ptr<const AbstractExpression> _right;
+};
+
+// Compares two numeric or two string values. Only OpEquals to OpGreaterThanEquals are supported as scan type.
+class ComparisonExpression : public AbstractExpression {
+ public:
+  ComparisonExpression(const ScanType scan_type, const std::shared_ptr<const AbstractExpression>& left,
+                       const std::shared_ptr<const AbstractExpression>& right);
+
+  ScanType scan_type() const;
+  const std::shared_ptr<const AbstractExpression>& left() const;
+  const std::shared_ptr<const AbstractExpression>& right() const;
+
+  std::string data_type(const Table& table) const override;
+  bool is_nullable(const Table& table) const override;
+  std::string describe(const ColumnDescriber& describe_column, const ValueDescriber& describe_value) const override;
+
+ protected:
+  const ScanType _scan_type;
+  const std::shared_ptr<const AbstractExpression> _left;
+  const std::shared_ptr<const AbstractExpression> _right;
+};
+
+// CASE WHEN condition THEN value ... ELSE value END. Returns the value of the first branch whose condition is neither
+// 0 nor NULL. Conditions must be of type int. Without an else expression, rows without a matching branch are NULL.
+class CaseExpression : public AbstractExpression {
+ public:
+  using Branch = std::pair<std::shared_ptr<const AbstractExpression>, std::shared_ptr<const AbstractExpression>>;
+
+  explicit CaseExpression(const std::vector<Branch>& branches,
+                          const std::shared_ptr<const AbstractExpression>& else_expression = nullptr);
+
+  const std::vector<Branch>& branches() const;
+  const std::shared_ptr<const AbstractExpression>& else_expression() const;
+
+  std::string data_type(const Table& table) const override;
+  bool is_nullable(const Table& table) const override;
+  std::string describe(const ColumnDescriber& describe_column, const ValueDescriber& describe_value) const override;
+
+ protected:
+  const std::vector<Branch> _branches;
+  const std::shared_ptr<const AbstractExpression> _else_expression;
+};
+
+// Returns the type that values of both types are converted to if they are combined in an expression. Fails if a
+// string is combined with a number.
+std::string common_data_type(const std::string& left_type, const std::string& right_type);
+
+}  // namespace opossum
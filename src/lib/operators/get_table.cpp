@@ -8,6 +8,22 @@ const std::string& GetTable::table_name() const {
   return _table_name;
 }
 
+std::optional<std::string> GetTable::description() const {
+  // The id and the version identify the table, so the name is not needed.
+  auto& storage_manager = StorageManager::get();
+  if (!storage_manager.has_table(_table_name)) {
+    return std::nullopt;
+  }
+  const auto table = storage_manager.get_table(_table_name);
+  return "GetTable " + std::to_string(table->id()) + "." + std::to_string(table->version());
+}
+
+std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  return std::make_shared<GetTable>(_table_name);
+}
+
 std::shared_ptr<const Table> GetTable::_on_execute() {
   auto storageManager = &StorageManager::get();
   Assert(storageManager->has_table(_table_name), "Table " + _table_name + " does not exist");
@@ -12,9 +12,15 @@ class GetTable : public AbstractOperator {
 
   const std::string& table_name() const;
 
+  std::optional<std::string> description() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
   const std::string _table_name;
 };
 
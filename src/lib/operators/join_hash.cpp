@@ -0,0 +1,686 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <string_view>
+
+#include "resolve_type.hpp"
+#include "storage/segment_values.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Each radix partitioning pass uses at most this many bits. With more partitions, a pass would write to more memory
+// pages at the same time than there are TLB entries.
+constexpr auto MAX_RADIX_BITS_PER_PASS = uint8_t{8};
+
+// After the first pass, partitions are split into units of at most this many rows, which are partitioned in parallel.
+constexpr auto PARTITIONING_UNIT_ROW_COUNT = size_t{16'384};
+
+// Size of the per-partition buffers used for software write-combining. Rows are first collected in these buffers,
+// which stay in the cache, and only then copied to their partitions as whole cache lines.
+constexpr auto WRITE_COMBINING_BUFFER_BYTES = size_t{256};
+
+// Strings are referenced in the hash tables instead of being copied. The referenced segments outlive the join.
+template <typename T>
+using HashKey = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+// std::hash is the identity for integers in common standard libraries. As the hash table uses the lowest bits of the
+// hash to find a slot, we mix all bits into them (using the finalizer of MurmurHash3).
+template <typename T>
+size_t join_hash_value(const T& value) {
+  auto hash = uint64_t{std::hash<T>{}(value)};
+  hash ^= hash >> 33;
+  hash *= uint64_t{0xff51afd7ed558ccd};
+  hash ^= hash >> 33;
+  hash *= uint64_t{0xc4ceb9fe1a85ec53};
+  hash ^= hash >> 33;
+  return hash;
+}
+
+// Open-addressing hash table that maps the join values of the build side to the rows holding them. The slots only store
+// 32-bit indexes into the densely stored keys, so that the linear probing (at a load factor of at most 50%) touches
+// few cache lines. The full hash of each key is stored as well and compared before the key itself, which avoids most
+// string comparisons. The rows are stored grouped by key in a single vector.
+//
+// Rows are added in two passes: first, all keys are inserted and their rows are counted (add_row_count), then, after
+// finalize_row_counts, the rows are written (add_row).
+template <typename Key>
+class JoinHashTable {
+ public:
+  static constexpr auto NO_KEY = std::numeric_limits<uint32_t>::max();
+
+  explicit JoinHashTable(const size_t max_key_count)
+      : _slots(std::bit_ceil(std::max(size_t{2} * max_key_count, size_t{2})), NO_KEY),
+        _slot_mask{_slots.size() - 1},
+        _row_offsets{0} {
+    Assert(max_key_count < NO_KEY, "Too many distinct values for the hash join.");
+  }
+
+  // Returns the index of the key and inserts it if it is not yet contained.
+  uint32_t insert(const Key& key, const size_t hash) {
+    for (auto slot = hash & _slot_mask;; slot = (slot + 1) & _slot_mask) {
+      const auto key_index = _slots[slot];
+      if (key_index == NO_KEY) {
+        const auto new_key_index = static_cast<uint32_t>(_keys.size());
+        _slots[slot] = new_key_index;
+        _keys.push_back(key);
+        _hashes.push_back(hash);
+        _row_offsets.push_back(0);
+        return new_key_index;
+      }
+
+      if (_hashes[key_index] == hash && _keys[key_index] == key) {
+        return key_index;
+      }
+    }
+  }
+
+  // Returns the index of the key or NO_KEY if the key is not contained.
+  uint32_t find(const Key& key, const size_t hash) const {
+    for (auto slot = hash & _slot_mask;; slot = (slot + 1) & _slot_mask) {
+      const auto key_index = _slots[slot];
+      if (key_index == NO_KEY || (_hashes[key_index] == hash && _keys[key_index] == key)) {
+        return key_index;
+      }
+    }
+  }
+
+  void add_row_count(const uint32_t key_index, const size_t row_count) {
+    _row_offsets[key_index + 1] += row_count;
+  }
+
+  void finalize_row_counts() {
+    std::partial_sum(_row_offsets.cbegin(), _row_offsets.cend(), _row_offsets.begin());
+    _rows.resize(_row_offsets.back());
+    _write_offsets.assign(_row_offsets.cbegin(), _row_offsets.cend() - 1);
+  }
+
+  void add_row(const uint32_t key_index, const RowID row_id) {
+    _rows[_write_offsets[key_index]++] = row_id;
+  }
+
+  // Returns the range [begin, end) of the key's rows in rows().
+  std::pair<size_t, size_t> row_range(const uint32_t key_index) const {
+    return {_row_offsets[key_index], _row_offsets[key_index + 1]};
+  }
+
+  const std::vector<RowID>& rows() const {
+    return _rows;
+  }
+
+ protected:
+  std::vector<uint32_t> _slots;
+  const size_t _slot_mask;
+  std::vector<Key> _keys;
+  std::vector<size_t> _hashes;
+  // _row_offsets[i] is the index of the first row of key i in _rows. It has an additional entry for the end.
+  std::vector<size_t> _row_offsets;
+  std::vector<size_t> _write_offsets;
+  std::vector<RowID> _rows;
+};
+
+// Collects the output rows of probing a hash table with the rows of one chunk or partition.
+class ProbeResultWriter {
+ public:
+  // If the rows of the left input are on the build side, Left, Semi, and Anti joins mark the matched build rows in
+  // build_row_matched. Their output is added once all rows have been probed (see build_side_left_rows).
+  ProbeResultWriter(const JoinMode mode, const bool build_left, const std::vector<RowID>& build_rows,
+                    std::vector<uint8_t>& build_row_matched)
+      : _mode{mode},
+        _build_left{build_left},
+        _tracks_build_matches{build_left && mode != JoinMode::Inner},
+        _build_rows{build_rows},
+        _build_row_matched{build_row_matched} {}
+
+  // Adds the output for a probe row whose value is held by the build rows [rows_begin, rows_end). The range is empty if
+  // the value is NULL or has no join partner.
+  void add(const RowID probe_row_id, const size_t rows_begin, const size_t rows_end) {
+    if (rows_begin == rows_end) {
+      if (!_build_left && _mode == JoinMode::Left) {
+        _build_pos_list->push_back(NULL_ROW_ID);
+        _probe_pos_list->push_back(probe_row_id);
+      } else if (!_build_left && _mode == JoinMode::Anti) {
+        _probe_pos_list->push_back(probe_row_id);
+      }
+      return;
+    }
+
+    if (_tracks_build_matches) {
+      for (auto row_index = rows_begin; row_index < rows_end; ++row_index) {
+        // Several threads may mark the same row, so we need an atomic access. Checking the flag first avoids
+        // invalidating the cache line in other cores if the row is already marked.
+        auto matched = std::atomic_ref<uint8_t>{_build_row_matched[row_index]};
+        if (!matched.load(std::memory_order_relaxed)) {
+          matched.store(1, std::memory_order_relaxed);
+        }
+      }
+      if (_mode != JoinMode::Left) {
+        return;
+      }
+    } else if (_mode == JoinMode::Semi) {
+      _probe_pos_list->push_back(probe_row_id);
+      return;
+    } else if (_mode == JoinMode::Anti) {
+      return;
+    }
+
+    for (auto row_index = rows_begin; row_index < rows_end; ++row_index) {
+      _build_pos_list->push_back(_build_rows[row_index]);
+      _probe_pos_list->push_back(probe_row_id);
+    }
+  }
+
+  AbstractJoinOperator::OutputChunk output_chunk() const {
+    return _build_left ? AbstractJoinOperator::OutputChunk{_build_pos_list, _probe_pos_list}
+                       : AbstractJoinOperator::OutputChunk{_probe_pos_list, _build_pos_list};
+  }
+
+ protected:
+  const JoinMode _mode;
+  const bool _build_left;
+  const bool _tracks_build_matches;
+  const std::vector<RowID>& _build_rows;
+  std::vector<uint8_t>& _build_row_matched;
+  std::shared_ptr<PosList> _build_pos_list = std::make_shared<PosList>();
+  std::shared_ptr<PosList> _probe_pos_list = std::make_shared<PosList>();
+};
+
+// Returns the output for rows of the left input that only depend on whether they found a join partner, i.e., the
+// matched build rows for Semi joins and the unmatched build rows as well as the left_null_rows otherwise. For Left
+// joins, the right side consists of NULL_ROW_IDs.
+AbstractJoinOperator::OutputChunk build_side_left_rows(const JoinMode mode, const std::vector<RowID>& build_rows,
+                                                       const std::vector<uint8_t>& build_row_matched,
+                                                       const PosList& left_null_rows) {
+  const auto emits_matched_rows = mode == JoinMode::Semi;
+  auto left_pos_list = std::make_shared<PosList>();
+  for (auto row_index = size_t{0}; row_index < build_row_matched.size(); ++row_index) {
+    if (static_cast<bool>(build_row_matched[row_index]) == emits_matched_rows) {
+      left_pos_list->push_back(build_rows[row_index]);
+    }
+  }
+  if (!emits_matched_rows) {
+    left_pos_list->insert(left_pos_list->end(), left_null_rows.cbegin(), left_null_rows.cend());
+  }
+
+  auto right_pos_list = std::shared_ptr<PosList>{};
+  if (mode == JoinMode::Left) {
+    right_pos_list = std::make_shared<PosList>(left_pos_list->size(), NULL_ROW_ID);
+  }
+  return {left_pos_list, right_pos_list};
+}
+
+// A row of an input of the radix-partitioned join together with its join value and the value's hash.
+template <typename Key>
+struct MaterializedRow {
+  size_t hash;
+  Key key;
+  RowID row_id;
+};
+
+// Rows of an input, partitioned by the upper bits of their hashes. Partition i consists of the rows
+// [offsets[i], offsets[i + 1]).
+template <typename Key>
+struct RadixPartitions {
+  std::vector<MaterializedRow<Key>> rows;
+  std::vector<size_t> offsets;
+};
+
+// Consecutive rows of the same partition that are partitioned further by a single thread.
+template <typename Key>
+struct PartitioningUnit {
+  std::span<const MaterializedRow<Key>> rows;
+  size_t partition;
+};
+
+// Materializes the non-NULL join values of each chunk of the table and adds the rows with NULL values to null_rows.
+template <typename T>
+std::vector<std::vector<MaterializedRow<HashKey<T>>>> materialize(const Table& table, const ColumnID column_id,
+                                                                  PosList& null_rows, const size_t max_parallelism) {
+  const auto chunk_count = table.chunk_count();
+  auto materialized_chunks = std::vector<std::vector<MaterializedRow<HashKey<T>>>>(chunk_count);
+  auto null_rows_by_chunk = std::vector<std::vector<RowID>>(chunk_count);
+
+  parallel_for(chunk_count, max_parallelism, [&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    const auto segment = table.get_chunk(chunk_id)->get_segment(column_id);
+    auto& materialized_rows = materialized_chunks[chunk_id];
+    materialized_rows.reserve(segment->size());
+    for_each_segment_value<T>(
+        *segment,
+        [&](const ChunkOffset chunk_offset, const T& value) {
+          materialized_rows.push_back({join_hash_value(value), HashKey<T>{value}, RowID{chunk_id, chunk_offset}});
+        },
+        [&](const ChunkOffset chunk_offset) { null_rows_by_chunk[chunk_id].push_back(RowID{chunk_id, chunk_offset}); });
+  });
+
+  for (const auto& chunk_null_rows : null_rows_by_chunk) {
+    null_rows.insert(null_rows.end(), chunk_null_rows.cbegin(), chunk_null_rows.cend());
+  }
+  return materialized_chunks;
+}
+
+// Splits each of the input_partition_count partitions by bit_count bits of the hash, starting at bit shift: the rows
+// of input partition p end up in the partitions [p * 2^bit_count, (p + 1) * 2^bit_count). The units of a partition
+// need to be consecutive.
+template <typename Key>
+RadixPartitions<Key> radix_partition_pass(const std::vector<PartitioningUnit<Key>>& units,
+                                          const size_t input_partition_count, const uint8_t bit_count,
+                                          const uint8_t shift, const size_t max_parallelism) {
+  using Row = MaterializedRow<Key>;
+  constexpr auto BUFFER_ROW_COUNT = std::max(size_t{2}, WRITE_COMBINING_BUFFER_BYTES / sizeof(Row));
+
+  const auto fan_out = size_t{1} << bit_count;
+  const auto mask = fan_out - 1;
+  const auto unit_count = units.size();
+
+  // Count the rows per unit and output partition.
+  auto histograms = std::vector<std::vector<size_t>>(unit_count, std::vector<size_t>(fan_out));
+  parallel_for(unit_count, max_parallelism, [&](const size_t unit_index) {
+    auto& histogram = histograms[unit_index];
+    for (const auto& row : units[unit_index].rows) {
+      ++histogram[(row.hash >> shift) & mask];
+    }
+  });
+
+  // Within an output partition, each unit writes its rows behind those of the previous units.
+  auto partitions = RadixPartitions<Key>{};
+  partitions.offsets.resize(input_partition_count * fan_out + 1);
+  auto write_offsets = std::vector<std::vector<size_t>>(unit_count, std::vector<size_t>(fan_out));
+  auto offset = size_t{0};
+  auto unit_begin = size_t{0};
+  for (auto input_partition = size_t{0}; input_partition < input_partition_count; ++input_partition) {
+    auto unit_end = unit_begin;
+    while (unit_end < unit_count && units[unit_end].partition == input_partition) {
+      ++unit_end;
+    }
+
+    for (auto sub_partition = size_t{0}; sub_partition < fan_out; ++sub_partition) {
+      partitions.offsets[input_partition * fan_out + sub_partition] = offset;
+      for (auto unit_index = unit_begin; unit_index < unit_end; ++unit_index) {
+        write_offsets[unit_index][sub_partition] = offset;
+        offset += histograms[unit_index][sub_partition];
+      }
+    }
+    unit_begin = unit_end;
+  }
+  partitions.offsets.back() = offset;
+  partitions.rows.resize(offset);
+
+  // Scatter the rows via the write-combining buffers.
+  parallel_for(unit_count, max_parallelism, [&](const size_t unit_index) {
+    auto buffers = std::vector<std::array<Row, BUFFER_ROW_COUNT>>(fan_out);
+    auto buffer_sizes = std::vector<size_t>(fan_out);
+    auto& unit_write_offsets = write_offsets[unit_index];
+
+    const auto flush = [&](const size_t partition) {
+      const auto buffer_begin = buffers[partition].cbegin();
+      std::copy(buffer_begin, buffer_begin + buffer_sizes[partition],
+                partitions.rows.begin() + unit_write_offsets[partition]);
+      unit_write_offsets[partition] += buffer_sizes[partition];
+      buffer_sizes[partition] = 0;
+    };
+
+    for (const auto& row : units[unit_index].rows) {
+      const auto partition = (row.hash >> shift) & mask;
+      buffers[partition][buffer_sizes[partition]++] = row;
+      if (buffer_sizes[partition] == BUFFER_ROW_COUNT) {
+        flush(partition);
+      }
+    }
+
+    for (auto partition = size_t{0}; partition < fan_out; ++partition) {
+      flush(partition);
+    }
+  });
+
+  return partitions;
+}
+
+// Partitions the materialized chunks by the radix_bits upper bits of the hashes. The hash tables use the lower bits, so
+// that the rows of a partition are still spread over all slots.
+template <typename Key>
+RadixPartitions<Key> radix_partition(const std::vector<std::vector<MaterializedRow<Key>>>& materialized_chunks,
+                                     const uint8_t radix_bits, const size_t max_parallelism) {
+  const auto pass_count = (radix_bits + MAX_RADIX_BITS_PER_PASS - 1) / MAX_RADIX_BITS_PER_PASS;
+
+  // The first pass partitions the chunks as they are.
+  auto units = std::vector<PartitioningUnit<Key>>{};
+  for (const auto& materialized_rows : materialized_chunks) {
+    units.push_back({materialized_rows, 0});
+  }
+
+  auto partitions = RadixPartitions<Key>{};
+  auto partition_count = size_t{1};
+  auto remaining_bits = radix_bits;
+  for (auto pass = 0; pass < pass_count; ++pass) {
+    const auto bit_count = static_cast<uint8_t>(remaining_bits / (pass_count - pass));
+    remaining_bits = static_cast<uint8_t>(remaining_bits - bit_count);
+    const auto shift = static_cast<uint8_t>(std::numeric_limits<size_t>::digits - radix_bits + remaining_bits);
+
+    auto next_partitions = radix_partition_pass(units, partition_count, bit_count, shift, max_parallelism);
+    partition_count <<= bit_count;
+
+    units.clear();
+    for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+      const auto partition_end = next_partitions.offsets[partition + 1];
+      for (auto begin = next_partitions.offsets[partition]; begin < partition_end;
+           begin += PARTITIONING_UNIT_ROW_COUNT) {
+        const auto end = std::min(begin + PARTITIONING_UNIT_ROW_COUNT, partition_end);
+        units.push_back({std::span{next_partitions.rows.data() + begin, end - begin}, partition});
+      }
+    }
+    partitions = std::move(next_partitions);
+  }
+
+  return partitions;
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
+                   const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                   const ColumnID left_column_id, const ColumnID right_column_id)
+    : AbstractJoinOperator{left, right, mode, left_column_id, ScanType::OpEquals, right_column_id} {}
+
+void JoinHash::set_radix_bits(const std::optional<uint8_t> radix_bits) {
+  Assert(!radix_bits || *radix_bits <= MAX_RADIX_BITS, "JoinHash supports at most 16 radix bits.");
+  _radix_bits = radix_bits;
+}
+
+std::optional<uint8_t> JoinHash::radix_bits() const {
+  return _radix_bits;
+}
+
+uint8_t JoinHash::determine_radix_bits(const uint64_t build_row_count, const uint64_t probe_row_count) {
+  const auto build_bytes = build_row_count * MATERIALIZED_ROW_BYTES;
+  const auto probe_bytes = probe_row_count * MATERIALIZED_ROW_BYTES;
+  if (build_bytes <= RADIX_PARTITIONING_THRESHOLD_BYTES || probe_bytes <= RADIX_PARTITIONING_THRESHOLD_BYTES) {
+    return 0;
+  }
+
+  const auto partition_count = (build_bytes + RADIX_PARTITION_BYTES - 1) / RADIX_PARTITION_BYTES;
+  const auto radix_bits = static_cast<uint64_t>(std::bit_width(partition_count - 1));
+  return static_cast<uint8_t>(std::min(radix_bits, uint64_t{MAX_RADIX_BITS}));
+}
+
+std::optional<std::string> JoinHash::description() const {
+  // The partitioning changes the order of the output rows.
+  return "JoinHash " + std::to_string(static_cast<int>(_mode)) + " " + std::to_string(_left_column_id) + " " +
+         std::to_string(_right_column_id) + " " + (_radix_bits ? std::to_string(*_radix_bits) : "auto");
+}
+
+std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  const auto copy = std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode, _left_column_id,
+                                               _right_column_id);
+  copy->set_radix_bits(_radix_bits);
+  return copy;
+}
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto left_input_table = _left_input_table();
+  const auto right_input_table = _right_input_table();
+  Assert(left_input_table && right_input_table, "JoinHash requires two inputs.");
+
+  const auto column_data_type = left_input_table->column_data_type(_left_column_id);
+  Assert(column_data_type == right_input_table->column_data_type(_right_column_id),
+         "JoinHash requires both join columns to have the same data type.");
+
+  // Building the hash table is more expensive per row than probing it, so we build it on the smaller input.
+  const auto left_row_count = left_input_table->row_count();
+  const auto right_row_count = right_input_table->row_count();
+  const auto build_left = left_row_count < right_row_count;
+  const auto radix_bits = _radix_bits ? *_radix_bits
+                                      : determine_radix_bits(std::min(left_row_count, right_row_count),
+                                                             std::max(left_row_count, right_row_count));
+
+  auto output_chunks = std::vector<OutputChunk>{};
+  resolve_data_type(column_data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    output_chunks = radix_bits ? _join_radix_partitioned<Type>(build_left, radix_bits) : _join<Type>(build_left);
+  });
+
+  auto timer = Timer{};
+  auto output_table = _build_output_table(output_chunks);
+  _performance_data.add_phase("Output", timer.lap());
+  return output_table;
+}
+
+template <typename T>
+std::vector<AbstractJoinOperator::OutputChunk> JoinHash::_join(const bool build_left) {
+  using Key = HashKey<T>;
+  constexpr auto NO_KEY = JoinHashTable<Key>::NO_KEY;
+
+  const auto& build_table = build_left ? *_left_input_table() : *_right_input_table();
+  const auto& probe_table = build_left ? *_right_input_table() : *_left_input_table();
+  const auto build_column_id = build_left ? _left_column_id : _right_column_id;
+  const auto probe_column_id = build_left ? _right_column_id : _left_column_id;
+
+  // If the rows of the left input are on the build side, Left, Semi, and Anti joins need to know which build rows
+  // found a join partner. For Left and Anti joins, the build rows with NULLs are part of the result as well.
+  const auto tracks_build_matches = build_left && _mode != JoinMode::Inner;
+  const auto collects_build_nulls = build_left && (_mode == JoinMode::Left || _mode == JoinMode::Anti);
+  auto build_null_rows = PosList{};
+  auto timer = Timer{};
+
+  // Build phase, first pass: insert all distinct values and count their rows. For dictionary segments, each
+  // dictionary entry is hashed and inserted only once and rows are mapped to keys via their value ids.
+  const auto build_chunk_count = build_table.chunk_count();
+  auto max_key_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < build_chunk_count; ++chunk_id) {
+    const auto segment = build_table.get_chunk(chunk_id)->get_segment(build_column_id);
+    const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(segment.get());
+    max_key_count += dictionary_segment ? dictionary_segment->unique_values_count() : segment->size();
+  }
+
+  auto hash_table = JoinHashTable<Key>{max_key_count};
+  // Per chunk, the key indexes by value id for dictionary segments and by chunk offset for all other segments.
+  auto key_indexes = std::vector<std::vector<uint32_t>>(build_chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < build_chunk_count; ++chunk_id) {
+    const auto segment = build_table.get_chunk(chunk_id)->get_segment(build_column_id);
+    auto& chunk_key_indexes = key_indexes[chunk_id];
+
+    if (const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(segment.get())) {
+      const auto& dictionary = dictionary_segment->dictionary();
+      const auto dictionary_size = dictionary.size();
+      // The additional entry for the NULL value id maps to NO_KEY.
+      chunk_key_indexes.resize(dictionary_size + 1, NO_KEY);
+      for (auto value_id = size_t{0}; value_id < dictionary_size; ++value_id) {
+        chunk_key_indexes[value_id] = hash_table.insert(dictionary[value_id], join_hash_value(dictionary[value_id]));
+      }
+
+      const auto segment_size = segment->size();
+      resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.values();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+          const auto key_index = chunk_key_indexes[value_ids[chunk_offset]];
+          if (key_index != NO_KEY) {
+            hash_table.add_row_count(key_index, 1);
+          } else if (collects_build_nulls) {
+            build_null_rows.push_back(RowID{chunk_id, chunk_offset});
+          }
+        }
+      });
+    } else {
+      chunk_key_indexes.resize(segment->size(), NO_KEY);
+      for_each_segment_value<T>(
+          *segment,
+          [&](const ChunkOffset chunk_offset, const T& value) {
+            const auto key_index = hash_table.insert(value, join_hash_value(value));
+            chunk_key_indexes[chunk_offset] = key_index;
+            hash_table.add_row_count(key_index, 1);
+          },
+          [&](const ChunkOffset chunk_offset) {
+            if (collects_build_nulls) {
+              build_null_rows.push_back(RowID{chunk_id, chunk_offset});
+            }
+          });
+    }
+  }
+
+  // Build phase, second pass: write the rows grouped by their keys.
+  hash_table.finalize_row_counts();
+  for (auto chunk_id = ChunkID{0}; chunk_id < build_chunk_count; ++chunk_id) {
+    const auto segment = build_table.get_chunk(chunk_id)->get_segment(build_column_id);
+    const auto& chunk_key_indexes = key_indexes[chunk_id];
+    const auto segment_size = segment->size();
+
+    const auto add_rows = [&](const auto& key_index_at) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+        const auto key_index = key_index_at(chunk_offset);
+        if (key_index != NO_KEY) {
+          hash_table.add_row(key_index, RowID{chunk_id, chunk_offset});
+        }
+      }
+    };
+
+    if (const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(segment.get())) {
+      resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.values();
+        add_rows([&](const ChunkOffset chunk_offset) { return chunk_key_indexes[value_ids[chunk_offset]]; });
+      });
+    } else {
+      add_rows([&](const ChunkOffset chunk_offset) { return chunk_key_indexes[chunk_offset]; });
+    }
+  }
+  key_indexes.clear();
+  _performance_data.add_phase("Build", timer.lap());
+
+  // Probe phase: each chunk of the probe side is processed independently and results in one output chunk.
+  const auto& build_rows = hash_table.rows();
+  auto build_row_matched = std::vector<uint8_t>(tracks_build_matches ? build_rows.size() : 0);
+  const auto probe_chunk_count = probe_table.chunk_count();
+  auto output_chunks = std::vector<OutputChunk>(probe_chunk_count);
+
+  parallel_for(probe_chunk_count, _max_parallelism, [&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    const auto segment = probe_table.get_chunk(chunk_id)->get_segment(probe_column_id);
+    auto writer = ProbeResultWriter{_mode, build_left, build_rows, build_row_matched};
+
+    // Handles a probe row whose value belongs to the given key (NO_KEY if the value is NULL or not contained).
+    const auto probe_row = [&](const ChunkOffset chunk_offset, const uint32_t key_index) {
+      const auto [rows_begin, rows_end] = key_index == NO_KEY ? std::pair<size_t, size_t>{0, 0}
+                                                              : hash_table.row_range(key_index);
+      writer.add(RowID{chunk_id, chunk_offset}, rows_begin, rows_end);
+    };
+
+    if (const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(segment.get())) {
+      // Look up each dictionary entry only once.
+      const auto& dictionary = dictionary_segment->dictionary();
+      const auto dictionary_size = dictionary.size();
+      auto key_index_by_value_id = std::vector<uint32_t>(dictionary_size + 1, NO_KEY);
+      for (auto value_id = size_t{0}; value_id < dictionary_size; ++value_id) {
+        key_index_by_value_id[value_id] = hash_table.find(dictionary[value_id], join_hash_value(dictionary[value_id]));
+      }
+
+      const auto segment_size = segment->size();
+      resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.values();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+          probe_row(chunk_offset, key_index_by_value_id[value_ids[chunk_offset]]);
+        }
+      });
+    } else {
+      for_each_segment_value<T>(
+          *segment,
+          [&](const ChunkOffset chunk_offset, const T& value) {
+            probe_row(chunk_offset, hash_table.find(value, join_hash_value(value)));
+          },
+          [&](const ChunkOffset chunk_offset) { probe_row(chunk_offset, NO_KEY); });
+    }
+
+    output_chunks[chunk_id] = writer.output_chunk();
+  });
+
+  if (tracks_build_matches) {
+    output_chunks.push_back(build_side_left_rows(_mode, build_rows, build_row_matched, build_null_rows));
+  }
+  _performance_data.add_phase("Probe", timer.lap());
+
+  return output_chunks;
+}
+
+template <typename T>
+std::vector<AbstractJoinOperator::OutputChunk> JoinHash::_join_radix_partitioned(const bool build_left,
+                                                                                 const uint8_t radix_bits) {
+  using Key = HashKey<T>;
+
+  const auto& build_table = build_left ? *_left_input_table() : *_right_input_table();
+  const auto& probe_table = build_left ? *_right_input_table() : *_left_input_table();
+  const auto build_column_id = build_left ? _left_column_id : _right_column_id;
+  const auto probe_column_id = build_left ? _right_column_id : _left_column_id;
+  const auto tracks_build_matches = build_left && _mode != JoinMode::Inner;
+
+  // Both inputs are partitioned by the same hash bits, so that matching rows end up in partitions with the same index.
+  // The rows with NULL values are not partitioned as they never match.
+  auto build_null_rows = PosList{};
+  auto probe_null_rows = PosList{};
+  auto timer = Timer{};
+  const auto build_partitions = radix_partition(
+      materialize<T>(build_table, build_column_id, build_null_rows, _max_parallelism), radix_bits, _max_parallelism);
+  const auto probe_partitions = radix_partition(
+      materialize<T>(probe_table, probe_column_id, probe_null_rows, _max_parallelism), radix_bits, _max_parallelism);
+  _performance_data.add_phase("Partition", timer.lap());
+
+  // Each pair of partitions is joined by a single thread with a hash table that fits into the cache. It results in one
+  // output chunk for the probe rows and, if needed, one for the build rows.
+  const auto partition_count = size_t{1} << radix_bits;
+  auto output_chunks = std::vector<OutputChunk>(2 * partition_count);
+  parallel_for(partition_count, _max_parallelism, [&](const size_t partition) {
+    const auto build_begin = build_partitions.rows.cbegin() + build_partitions.offsets[partition];
+    const auto build_row_count = build_partitions.offsets[partition + 1] - build_partitions.offsets[partition];
+
+    auto hash_table = JoinHashTable<Key>{build_row_count};
+    auto key_indexes = std::vector<uint32_t>(build_row_count);
+    for (auto row_index = size_t{0}; row_index < build_row_count; ++row_index) {
+      const auto& row = build_begin[row_index];
+      key_indexes[row_index] = hash_table.insert(row.key, row.hash);
+      hash_table.add_row_count(key_indexes[row_index], 1);
+    }
+    hash_table.finalize_row_counts();
+    for (auto row_index = size_t{0}; row_index < build_row_count; ++row_index) {
+      hash_table.add_row(key_indexes[row_index], build_begin[row_index].row_id);
+    }
+
+    const auto& build_rows = hash_table.rows();
+    auto build_row_matched = std::vector<uint8_t>(tracks_build_matches ? build_rows.size() : 0);
+    auto writer = ProbeResultWriter{_mode, build_left, build_rows, build_row_matched};
+    const auto probe_end = probe_partitions.rows.cbegin() + probe_partitions.offsets[partition + 1];
+    for (auto row_it = probe_partitions.rows.cbegin() + probe_partitions.offsets[partition]; row_it != probe_end;
+         ++row_it) {
+      const auto key_index = hash_table.find(row_it->key, row_it->hash);
+      const auto [rows_begin, rows_end] = key_index == JoinHashTable<Key>::NO_KEY ? std::pair<size_t, size_t>{0, 0}
+                                                                                  : hash_table.row_range(key_index);
+      writer.add(row_it->row_id, rows_begin, rows_end);
+    }
+
+    output_chunks[2 * partition] = writer.output_chunk();
+    if (tracks_build_matches) {
+      output_chunks[2 * partition + 1] = build_side_left_rows(_mode, build_rows, build_row_matched, PosList{});
+    }
+  });
+  _performance_data.add_phase("Build and probe", timer.lap());
+
+  // The rows of the left input with NULL values are only part of the result of Left and Anti joins.
+  if (_mode == JoinMode::Left || _mode == JoinMode::Anti) {
+    const auto& left_null_rows = build_left ? build_null_rows : probe_null_rows;
+    output_chunks.push_back(build_side_left_rows(_mode, {}, {}, left_null_rows));
+  }
+
+  return output_chunks;
+}
+
+}  // namespace opossum
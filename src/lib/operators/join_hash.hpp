@@ -0,0 +1,57 @@
+#pragma once
+
+#include <optional>
+
+#include "abstract_join_operator.hpp"
+
+namespace opossum {
+
+// Equi-join that builds a hash table on the join column of the smaller input and probes it with the rows of the other
+// input. The probe side is processed chunk by chunk in parallel.
+//
+// If both inputs are large, the hash table would not fit into the CPU caches and almost every access would be a cache
+// miss. In this case, both inputs are radix-partitioned by the upper bits of the join values' hashes first (in
+// multiple passes if there are many partitions). Each pair of partitions with the same index is then joined
+// independently and in parallel with a small hash table.
+class JoinHash : public AbstractJoinOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+           const JoinMode mode, const ColumnID left_column_id, const ColumnID right_column_id);
+
+  // Sets the number of bits by which the inputs are radix-partitioned, i.e., 2^radix_bits partitions are created. 0
+  // disables the partitioning, std::nullopt (the default) chooses the number based on the input sizes.
+  void set_radix_bits(const std::optional<uint8_t> radix_bits);
+
+  std::optional<uint8_t> radix_bits() const;
+
+  // Returns the number of radix bits so that the hash table of a partition of the build side fits into the L2 cache,
+  // or 0 if partitioning does not pay off because one of the inputs is small.
+  static uint8_t determine_radix_bits(const uint64_t build_row_count, const uint64_t probe_row_count);
+
+  // Approximate size of a row in the hash table or in a partition.
+  static constexpr auto MATERIALIZED_ROW_BYTES = uint64_t{32};
+  // The inputs are partitioned if both of them are at least this large (in materialized form).
+  static constexpr auto RADIX_PARTITIONING_THRESHOLD_BYTES = uint64_t{64} * 1024 * 1024;
+  // Targeted size of a partition of the build side.
+  static constexpr auto RADIX_PARTITION_BYTES = uint64_t{256} * 1024;
+  static constexpr auto MAX_RADIX_BITS = uint8_t{16};
+
+  std::optional<std::string> description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  template <typename T>
+  std::vector<OutputChunk> _join(const bool build_left);
+
+  template <typename T>
+  std::vector<OutputChunk> _join_radix_partitioned(const bool build_left, const uint8_t radix_bits);
+
+  std::optional<uint8_t> _radix_bits;
+};
+
+}  // namespace opossum
@@ -0,0 +1,235 @@
+#include "join_sort_merge.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+#include "resolve_type.hpp"
+#include "storage/segment_values.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/parallel_merge.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Strings are referenced instead of being copied. The referenced segments outlive the join.
+template <typename T>
+using SortKey = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+template <typename Key>
+struct SortedRow {
+  Key value;
+  RowID row_id;
+};
+
+template <typename Key>
+bool value_less(const SortedRow<Key>& lhs, const SortedRow<Key>& rhs) {
+  return lhs.value < rhs.value;
+}
+
+// Returns the rows of the table with non-NULL join values, sorted by these values. The rows with NULL values are added
+// to null_rows. Each chunk is materialized and, unless its values are already sorted, sorted by one thread. The
+// sorted chunks are then merged pairwise in parallel, which is skipped if the chunks are in order already.
+template <typename T>
+std::vector<SortedRow<SortKey<T>>> materialize_sorted(const Table& table, const ColumnID column_id, PosList& null_rows,
+                                                      const size_t max_parallelism) {
+  using Row = SortedRow<SortKey<T>>;
+
+  const auto chunk_count = table.chunk_count();
+  auto sorted_chunks = std::vector<std::vector<Row>>(chunk_count);
+  auto null_rows_by_chunk = std::vector<std::vector<RowID>>(chunk_count);
+  parallel_for(chunk_count, max_parallelism, [&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    const auto segment = table.get_chunk(chunk_id)->get_segment(column_id);
+    auto& rows = sorted_chunks[chunk_id];
+    rows.reserve(segment->size());
+    for_each_segment_value<T>(
+        *segment,
+        [&](const ChunkOffset chunk_offset, const T& value) {
+          rows.push_back({SortKey<T>{value}, RowID{chunk_id, chunk_offset}});
+        },
+        [&](const ChunkOffset chunk_offset) { null_rows_by_chunk[chunk_id].push_back(RowID{chunk_id, chunk_offset}); });
+
+    if (!std::is_sorted(rows.cbegin(), rows.cend(), value_less<SortKey<T>>)) {
+      std::sort(rows.begin(), rows.end(), value_less<SortKey<T>>);
+    }
+  });
+
+  for (const auto& chunk_null_rows : null_rows_by_chunk) {
+    null_rows.insert(null_rows.end(), chunk_null_rows.cbegin(), chunk_null_rows.cend());
+  }
+
+  // Concatenate the sorted chunks. run_offsets[i] is the index of the first row of the i-th sorted run.
+  auto rows = std::vector<Row>{};
+  auto run_offsets = std::vector<size_t>{0};
+  auto runs_are_ordered = true;
+  for (const auto& chunk_rows : sorted_chunks) {
+    if (chunk_rows.empty()) {
+      continue;
+    }
+    if (!rows.empty() && value_less(chunk_rows.front(), rows.back())) {
+      runs_are_ordered = false;
+    }
+    rows.insert(rows.end(), chunk_rows.cbegin(), chunk_rows.cend());
+    run_offsets.push_back(rows.size());
+  }
+  sorted_chunks.clear();
+
+  if (runs_are_ordered) {
+    return rows;
+  }
+
+  parallel_merge_runs(rows, std::move(run_offsets), value_less<SortKey<T>>, max_parallelism);
+  return rows;
+}
+
+// Returns the ranges of the sorted right rows that match a left value for the scan type, given the range
+// [equal_begin, equal_end) of right rows with the same value. The second range is only used for OpNotEquals.
+std::array<std::pair<size_t, size_t>, 2> matching_ranges(const ScanType scan_type, const size_t equal_begin,
+                                                         const size_t equal_end, const size_t right_row_count) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return {{{equal_begin, equal_end}, {0, 0}}};
+    case ScanType::OpNotEquals:
+      return {{{0, equal_begin}, {equal_end, right_row_count}}};
+    case ScanType::OpLessThan:
+      return {{{equal_end, right_row_count}, {0, 0}}};
+    case ScanType::OpLessThanEquals:
+      return {{{equal_begin, right_row_count}, {0, 0}}};
+    case ScanType::OpGreaterThan:
+      return {{{0, equal_begin}, {0, 0}}};
+    case ScanType::OpGreaterThanEquals:
+      return {{{0, equal_end}, {0, 0}}};
+    default:
+      Fail("JoinSortMerge only supports comparison scan types.");
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator>& left,
+                             const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                             const ColumnID left_column_id, const ScanType scan_type,
+                             const ColumnID right_column_id)
+    : AbstractJoinOperator{left, right, mode, left_column_id, scan_type, right_column_id} {}
+
+std::optional<std::string> JoinSortMerge::description() const {
+  return "JoinSortMerge " + std::to_string(static_cast<int>(_mode)) + " " + std::to_string(_left_column_id) + " " +
+         std::to_string(static_cast<int>(_scan_type)) + " " + std::to_string(_right_column_id);
+}
+
+std::shared_ptr<AbstractOperator> JoinSortMerge::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<JoinSortMerge>(copied_left_input, copied_right_input, _mode, _left_column_id, _scan_type,
+                                         _right_column_id);
+}
+
+std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
+  const auto left_input_table = _left_input_table();
+  const auto right_input_table = _right_input_table();
+  Assert(left_input_table && right_input_table, "JoinSortMerge requires two inputs.");
+
+  const auto column_data_type = left_input_table->column_data_type(_left_column_id);
+  Assert(column_data_type == right_input_table->column_data_type(_right_column_id),
+         "JoinSortMerge requires both join columns to have the same data type.");
+  Assert(_scan_type != ScanType::OpLike && _scan_type != ScanType::OpNotLike && _scan_type != ScanType::OpIsNull &&
+             _scan_type != ScanType::OpIsNotNull,
+         "JoinSortMerge only supports comparison scan types.");
+
+  auto output_chunks = std::vector<OutputChunk>{};
+  resolve_data_type(column_data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    output_chunks = _join<Type>();
+  });
+
+  auto timer = Timer{};
+  auto output_table = _build_output_table(output_chunks);
+  _performance_data.add_phase("Output", timer.lap());
+  return output_table;
+}
+
+template <typename T>
+std::vector<AbstractJoinOperator::OutputChunk> JoinSortMerge::_join() {
+  auto timer = Timer{};
+  auto left_null_rows = PosList{};
+  auto right_null_rows = PosList{};
+  const auto left_rows = materialize_sorted<T>(*_left_input_table(), _left_column_id, left_null_rows, _max_parallelism);
+  const auto right_rows =
+      materialize_sorted<T>(*_right_input_table(), _right_column_id, right_null_rows, _max_parallelism);
+  const auto right_row_count = right_rows.size();
+  _performance_data.add_phase("Sort", timer.lap());
+
+  // Merge phase: each morsel of the left rows finds the range of equal right values for its first value by binary
+  // search and then advances the range along with its (ascending) values.
+  const auto morsel_count = (left_rows.size() + MORSEL_ROW_COUNT - 1) / MORSEL_ROW_COUNT;
+  auto output_chunks = std::vector<OutputChunk>(morsel_count);
+  parallel_for(morsel_count, _max_parallelism, [&](const size_t morsel_index) {
+    const auto morsel_begin = left_rows.cbegin() + morsel_index * MORSEL_ROW_COUNT;
+    const auto morsel_end = left_rows.cbegin() + std::min((morsel_index + 1) * MORSEL_ROW_COUNT, left_rows.size());
+    auto left_pos_list = std::make_shared<PosList>();
+    auto right_pos_list = std::make_shared<PosList>();
+
+    const auto [first_equal_begin, first_equal_end] =
+        std::equal_range(right_rows.cbegin(), right_rows.cend(), *morsel_begin, value_less<SortKey<T>>);
+    auto equal_begin = static_cast<size_t>(std::distance(right_rows.cbegin(), first_equal_begin));
+    auto equal_end = static_cast<size_t>(std::distance(right_rows.cbegin(), first_equal_end));
+
+    for (auto left_it = morsel_begin; left_it != morsel_end; ++left_it) {
+      const auto& left_value = left_it->value;
+      while (equal_begin < right_row_count && right_rows[equal_begin].value < left_value) {
+        ++equal_begin;
+      }
+      equal_end = std::max(equal_end, equal_begin);
+      while (equal_end < right_row_count && !(left_value < right_rows[equal_end].value)) {
+        ++equal_end;
+      }
+
+      const auto ranges = matching_ranges(_scan_type, equal_begin, equal_end, right_row_count);
+      const auto match_count = (ranges[0].second - ranges[0].first) + (ranges[1].second - ranges[1].first);
+      switch (_mode) {
+        case JoinMode::Inner:
+        case JoinMode::Left:
+          if (!match_count && _mode == JoinMode::Left) {
+            left_pos_list->push_back(left_it->row_id);
+            right_pos_list->push_back(NULL_ROW_ID);
+          }
+          left_pos_list->insert(left_pos_list->end(), match_count, left_it->row_id);
+          for (const auto& [range_begin, range_end] : ranges) {
+            for (auto right_index = range_begin; right_index < range_end; ++right_index) {
+              right_pos_list->push_back(right_rows[right_index].row_id);
+            }
+          }
+          break;
+        case JoinMode::Semi:
+          if (match_count) {
+            left_pos_list->push_back(left_it->row_id);
+          }
+          break;
+        case JoinMode::Anti:
+          if (!match_count) {
+            left_pos_list->push_back(left_it->row_id);
+          }
+          break;
+      }
+    }
+
+    output_chunks[morsel_index] = OutputChunk{left_pos_list, right_pos_list};
+  });
+
+  // Rows with NULL values never match, but they are part of the result of Left and Anti joins.
+  if (_mode == JoinMode::Left || _mode == JoinMode::Anti) {
+    auto left_pos_list = std::make_shared<PosList>(left_null_rows.cbegin(), left_null_rows.cend());
+    auto right_pos_list = std::make_shared<PosList>(_mode == JoinMode::Left ? left_pos_list->size() : 0, NULL_ROW_ID);
+    output_chunks.push_back(OutputChunk{left_pos_list, right_pos_list});
+  }
+  _performance_data.add_phase("Merge", timer.lap());
+
+  return output_chunks;
+}
+
+}  // namespace opossum
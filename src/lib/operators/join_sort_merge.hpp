@@ -0,0 +1,40 @@
+#pragma once
+
+#include "abstract_join_operator.hpp"
+
+namespace opossum {
+
+// Join that sorts both inputs by their join values and merges them. Besides equi-joins, it supports the comparison
+// scan types OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, and OpGreaterThanEquals, which compare the
+// left value with the right value (e.g., OpLessThan joins the rows where left < right). For each left value, the
+// matching rows of the sorted right input form at most two contiguous ranges, so the output is generated range by
+// range without comparing the individual pairs.
+//
+// Chunks whose join values are already sorted are not sorted again, and if the chunks are ordered as well, the input
+// is not merged either. Thus, inputs that were loaded sorted by the join column are only read once. Band joins (e.g.,
+// a.time BETWEEN b.time - x AND b.time + x) can be executed as a JoinSortMerge on one bound followed by a
+// ColumnComparisonScan on the other.
+class JoinSortMerge : public AbstractJoinOperator {
+ public:
+  JoinSortMerge(const std::shared_ptr<const AbstractOperator>& left,
+                const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                const ColumnID left_column_id, const ScanType scan_type, const ColumnID right_column_id);
+
+  // The sorted left input is split into morsels of this many rows, which are merged with the right input in parallel.
+  // Each morsel results in one output chunk, which AbstractJoinOperator splits if it exceeds the target chunk size.
+  static constexpr auto MORSEL_ROW_COUNT = size_t{16'384};
+
+  std::optional<std::string> description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  template <typename T>
+  std::vector<OutputChunk> _join();
+};
+
+}  // namespace opossum
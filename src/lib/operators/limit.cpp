@@ -0,0 +1,110 @@
+#include "limit.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "pipeline.hpp"
+#include "reference_output.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+Limit::Limit(const std::shared_ptr<const AbstractOperator>& in, const uint64_t row_count)
+    : AbstractOperator{in}, _row_count{row_count} {}
+
+void Limit::propagate_row_budgets(const std::shared_ptr<const AbstractOperator>& root) {
+  // Counts the consumers of each operator in the plan. Operators with several consumers are visited once.
+  auto consumer_counts = std::unordered_map<const AbstractOperator*, size_t>{};
+  auto limits = std::vector<std::shared_ptr<const Limit>>{};
+  const std::function<void(const std::shared_ptr<const AbstractOperator>&)> visit =
+      [&](const std::shared_ptr<const AbstractOperator>& op) {
+        if (const auto limit = std::dynamic_pointer_cast<const Limit>(op)) {
+          limits.push_back(limit);
+        }
+        for (const auto& input : {op->left_input(), op->right_input()}) {
+          if (input && consumer_counts[input.get()]++ == 0) {
+            visit(input);
+          }
+        }
+      };
+  visit(root);
+
+  for (const auto& limit : limits) {
+    const auto& input = limit->left_input();
+    if (!input || consumer_counts[input.get()] > 1 || input->was_executed()) {
+      continue;
+    }
+
+    // The plan holds const pointers to the inputs, but their budget needs to be set.
+    const auto row_budget = input->row_budget() ? std::min(*input->row_budget(), limit->_row_count) : limit->_row_count;
+    std::const_pointer_cast<AbstractOperator>(input)->set_row_budget(row_budget);
+  }
+}
+
+uint64_t Limit::row_count() const {
+  return _row_count;
+}
+
+std::unique_ptr<AbstractPipelineStage> Limit::create_pipeline_stage() const {
+  return std::make_unique<LimitStage>(_row_count);
+}
+
+std::optional<std::string> Limit::description() const {
+  return "Limit " + std::to_string(_row_count);
+}
+
+std::shared_ptr<AbstractOperator> Limit::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  return std::make_shared<Limit>(copied_left_input, _row_count);
+}
+
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(input_table, "Limit requires an input.");
+
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size());
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_nullable(column_id));
+  }
+
+  const auto input_pos_lists = pos_lists_by_column(*input_table);
+  const auto chunk_count = input_table->chunk_count();
+  auto remaining_row_count = _row_count;
+  auto chunk_id = ChunkID{0};
+  for (; chunk_id < chunk_count && remaining_row_count > 0; ++chunk_id) {
+    const auto input_chunk = input_table->get_chunk(chunk_id);
+    const auto input_chunk_size = input_chunk->size();
+    if (!input_chunk_size) {
+      continue;
+    }
+
+    const auto output_chunk_size = static_cast<ChunkOffset>(std::min(uint64_t{input_chunk_size}, remaining_row_count));
+    remaining_row_count -= output_chunk_size;
+    auto output_chunk = std::make_shared<Chunk>();
+    if (!input_pos_lists.empty() && output_chunk_size == input_chunk_size) {
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        output_chunk->add_segment(input_chunk->get_segment(column_id));
+      }
+    } else {
+      // The output covers the chunk's first rows.
+      add_reference_segments(*output_chunk, input_table,
+                             std::make_shared<ChunkRangePosList>(chunk_id, ChunkOffset{0}, output_chunk_size),
+                             input_pos_lists);
+    }
+    output_table->append_chunk(output_chunk);
+  }
+  _performance_data.pruned_chunk_count = chunk_count - chunk_id;
+
+  if (!output_table->row_count()) {
+    append_empty_chunk(*output_table);
+  }
+  return output_table;
+}
+
+}  // namespace opossum
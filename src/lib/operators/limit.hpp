@@ -0,0 +1,36 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Returns the first row_count rows of the input. Full chunks of reference inputs are passed on as they are, other rows
+// are referenced. propagate_row_budgets passes row_count on to the input as a row budget, so that, e.g., a TableScan
+// below the Limit stops scanning once it found enough rows.
+class Limit : public AbstractOperator {
+ public:
+  Limit(const std::shared_ptr<const AbstractOperator>& in, const uint64_t row_count);
+
+  // Sets the row budget (see AbstractOperator::set_row_budget) of the inputs of the Limits in the plan to the Limits'
+  // row counts. Inputs that have other consumers in the plan need all their rows and do not get a budget, neither do
+  // inputs that were already executed. Call this once the plan is built and before it is executed. Consumers outside
+  // of the plan are not known, so operators must not be shared with other plans.
+  static void propagate_row_budgets(const std::shared_ptr<const AbstractOperator>& root);
+
+  uint64_t row_count() const;
+
+  std::unique_ptr<AbstractPipelineStage> create_pipeline_stage() const override;
+
+  std::optional<std::string> description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  const uint64_t _row_count;
+};
+
+}  // namespace opossum
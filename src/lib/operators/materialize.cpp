@@ -0,0 +1,123 @@
+#include "materialize.hpp"
+
+#include <algorithm>
+
+#include "reference_output.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_values.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Gathers the values of the input rows [output_begin, output_end) of a column, where chunk_begins[i] is the index of
+// the first row of input chunk i.
+template <typename T>
+std::shared_ptr<AbstractSegment> materialize_segment(const Table& input_table, const ColumnID column_id,
+                                                     const std::vector<size_t>& chunk_begins, const size_t output_begin,
+                                                     const size_t output_end, const bool dictionary_encode) {
+  const auto row_count = output_end - output_begin;
+  auto values = std::vector<T>(row_count);
+  auto null_values = std::vector<bool>(row_count);
+
+  // The last input chunk that starts at or before output_begin holds the first row.
+  auto chunk_id = static_cast<ChunkID>(
+      std::upper_bound(chunk_begins.cbegin(), chunk_begins.cend(), output_begin) - chunk_begins.cbegin() - 1);
+  for (; chunk_begins[chunk_id] < output_end; ++chunk_id) {
+    const auto chunk_begin = chunk_begins[chunk_id];
+    const auto begin_offset = static_cast<ChunkOffset>(std::max(chunk_begin, output_begin) - chunk_begin);
+    const auto end_offset = static_cast<ChunkOffset>(std::min(chunk_begins[chunk_id + 1], output_end) - chunk_begin);
+    const auto chunk_begin_in_output = chunk_begin - output_begin;
+    for_each_segment_value_in_range<T>(
+        *input_table.get_chunk(chunk_id)->get_segment(column_id), begin_offset, end_offset,
+        [&](const ChunkOffset chunk_offset, const T& value) { values[chunk_begin_in_output + chunk_offset] = value; },
+        [&](const ChunkOffset chunk_offset) { null_values[chunk_begin_in_output + chunk_offset] = true; });
+  }
+
+  auto segment = std::shared_ptr<AbstractSegment>{};
+  if (input_table.column_nullable(column_id)) {
+    segment = std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  } else {
+    DebugAssert(std::find(null_values.cbegin(), null_values.cend(), true) == null_values.cend(),
+                "Column is not nullable, but contains NULLs.");
+    segment = std::make_shared<ValueSegment<T>>(std::move(values));
+  }
+
+  if (dictionary_encode) {
+    return std::make_shared<DictionarySegment<T>>(segment);
+  }
+  return segment;
+}
+
+}  // namespace
+
+namespace opossum {
+
+Materialize::Materialize(const std::shared_ptr<const AbstractOperator>& in, const bool dictionary_encode)
+    : AbstractOperator{in}, _dictionary_encode{dictionary_encode} {}
+
+bool Materialize::dictionary_encode() const {
+  return _dictionary_encode;
+}
+
+std::optional<std::string> Materialize::description() const {
+  return "Materialize " + std::to_string(_dictionary_encode);
+}
+
+std::shared_ptr<AbstractOperator> Materialize::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  return std::make_shared<Materialize>(copied_left_input, _dictionary_encode);
+}
+
+std::shared_ptr<const Table> Materialize::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(input_table, "Materialize requires an input.");
+
+  const auto target_chunk_size = input_table->target_chunk_size();
+  auto output_table = std::make_shared<Table>(target_chunk_size);
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_nullable(column_id));
+  }
+
+  // chunk_begins[i] is the index of the first row of chunk i, if the rows of all chunks are counted consecutively.
+  const auto chunk_count = input_table->chunk_count();
+  auto chunk_begins = std::vector<size_t>{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_begins.push_back(chunk_begins.back() + input_table->get_chunk(chunk_id)->size());
+  }
+  const auto row_count = chunk_begins.back();
+  if (!row_count) {
+    append_empty_chunk(*output_table);
+    return output_table;
+  }
+
+  // Each segment of the output is gathered independently.
+  const auto output_chunk_count = (row_count + target_chunk_size - 1) / target_chunk_size;
+  auto segments = std::vector<std::shared_ptr<AbstractSegment>>(output_chunk_count * column_count);
+  parallel_for(segments.size(), _max_parallelism, [&](const size_t segment_index) {
+    const auto output_chunk_index = segment_index / column_count;
+    const auto column_id = static_cast<ColumnID>(segment_index % column_count);
+    const auto output_begin = output_chunk_index * target_chunk_size;
+    const auto output_end = std::min(output_begin + target_chunk_size, row_count);
+    resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      segments[segment_index] = materialize_segment<Type>(*input_table, column_id, chunk_begins, output_begin,
+                                                          output_end, _dictionary_encode);
+    });
+  });
+
+  for (auto output_chunk_index = size_t{0}; output_chunk_index < output_chunk_count; ++output_chunk_index) {
+    auto chunk = std::make_shared<Chunk>();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      chunk->add_segment(segments[output_chunk_index * column_count + column_id]);
+    }
+    output_table->append_chunk(chunk);
+  }
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Copies the values of the input into new value segments (or dictionary segments, if dictionary_encode is set), e.g.,
+// to cache an intermediate result that consists of reference segments, which are slow to read repeatedly. The output
+// chunks hold target_chunk_size rows of the input table each, so that chunks that were thinned out by scans are merged.
+//
+// The output chunks and columns are gathered in parallel. For each run of positions that reference the same input
+// chunk, the referenced segment is resolved once, and positions in random order are prefetched.
+class Materialize : public AbstractOperator {
+ public:
+  explicit Materialize(const std::shared_ptr<const AbstractOperator>& in, const bool dictionary_encode = false);
+
+  bool dictionary_encode() const;
+
+  std::optional<std::string> description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  const bool _dictionary_encode;
+};
+
+}  // namespace opossum
@@ -0,0 +1,91 @@
+#include "operator_performance_data.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <unordered_set>
+
+#include "abstract_operator.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Formats the duration in milliseconds with microsecond precision.
+std::string format_duration(const std::chrono::nanoseconds duration) {
+  auto stream = std::ostringstream{};
+  stream << std::fixed << std::setprecision(3) << std::chrono::duration<double, std::milli>{duration}.count() << " ms";
+  return stream.str();
+}
+
+void add_performance_data(const AbstractOperator& op, std::unordered_set<const AbstractOperator*>& visited_operators,
+                          OperatorPerformanceData& performance_data) {
+  if (!visited_operators.insert(&op).second) {
+    return;
+  }
+
+  if (op.was_executed()) {
+    performance_data += op.performance_data();
+  }
+  for (const auto& input : {op.left_input(), op.right_input()}) {
+    if (input) {
+      add_performance_data(*input, visited_operators, performance_data);
+    }
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+void OperatorPerformanceData::add_phase(const std::string& name, const std::chrono::nanoseconds duration) {
+  const auto iter = std::find_if(phases.begin(), phases.end(), [&](const auto& phase) { return phase.first == name; });
+  if (iter == phases.end()) {
+    phases.emplace_back(name, duration);
+  } else {
+    iter->second += duration;
+  }
+}
+
+OperatorPerformanceData& OperatorPerformanceData::operator+=(const OperatorPerformanceData& other) {
+  walltime += other.walltime;
+  for (const auto& [name, duration] : other.phases) {
+    add_phase(name, duration);
+  }
+  input_row_count += other.input_row_count;
+  input_chunk_count += other.input_chunk_count;
+  output_row_count += other.output_row_count;
+  output_chunk_count += other.output_chunk_count;
+  pruned_chunk_count += other.pruned_chunk_count;
+  output_bytes += other.output_bytes;
+  worker_thread_count = std::max(worker_thread_count, other.worker_thread_count);
+  return *this;
+}
+
+std::ostream& operator<<(std::ostream& stream, const OperatorPerformanceData& performance_data) {
+  stream << "walltime: " << format_duration(performance_data.walltime);
+  if (!performance_data.phases.empty()) {
+    stream << " (";
+    for (auto phase_index = size_t{0}; phase_index < performance_data.phases.size(); ++phase_index) {
+      const auto& [name, duration] = performance_data.phases[phase_index];
+      stream << (phase_index ? ", " : "") << name << ": " << format_duration(duration);
+    }
+    stream << ")";
+  }
+
+  stream << ", input: " << performance_data.input_row_count << " rows in " << performance_data.input_chunk_count
+         << " chunks, output: " << performance_data.output_row_count << " rows in "
+         << performance_data.output_chunk_count << " chunks (" << performance_data.output_bytes
+         << " bytes), pruned chunks: " << performance_data.pruned_chunk_count
+         << ", worker threads: " << performance_data.worker_thread_count;
+  return stream;
+}
+
+OperatorPerformanceData aggregate_performance_data(const AbstractOperator& root) {
+  auto performance_data = OperatorPerformanceData{};
+  auto visited_operators = std::unordered_set<const AbstractOperator*>{};
+  add_performance_data(root, visited_operators, performance_data);
+  return performance_data;
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+class AbstractOperator;
+
+// What an operator did during its execution and how long it took. AbstractOperator records it for every executed
+// operator (see AbstractOperator::performance_data), so that the operator that slows down a query can be found
+// without attaching a profiler.
+struct OperatorPerformanceData {
+  // Adds the duration to the phase with the given name, which is appended if it was not recorded before.
+  void add_phase(const std::string& name, const std::chrono::nanoseconds duration);
+
+  // Adds the data of another operator, e.g., to sum up a plan. Phases with the same name are added up. The worker
+  // thread count is the maximum of both.
+  OperatorPerformanceData& operator+=(const OperatorPerformanceData& other);
+
+  // The time from the start to the end of the operator's execution, excluding its inputs.
+  std::chrono::nanoseconds walltime{0};
+
+  // The steps of the operator (e.g., "Build" and "Probe" of JoinHash) in the order in which they were first recorded.
+  // They cover most, but not necessarily all of the walltime. Operators without distinct steps do not record phases.
+  std::vector<std::pair<std::string, std::chrono::nanoseconds>> phases;
+
+  // Of both inputs together.
+  uint64_t input_row_count{0};
+  uint64_t input_chunk_count{0};
+
+  uint64_t output_row_count{0};
+  uint64_t output_chunk_count{0};
+
+  // The number of input chunks that the operator skipped without reading them (e.g., because of a row budget).
+  uint64_t pruned_chunk_count{0};
+
+  // The estimated memory usage of the output (see Table::estimate_memory_usage). 0 if the operator passes on an
+  // existing table (e.g., GetTable), which it did not allocate.
+  uint64_t output_bytes{0};
+
+  // The number of distinct threads that worked on the operator, including the ones that executed its parallel_for
+  // jobs.
+  uint64_t worker_thread_count{0};
+};
+
+std::ostream& operator<<(std::ostream& stream, const OperatorPerformanceData& performance_data);
+
+// Sums up the performance data of the executed operators in the plan with the given root. Operators that are the input
+// of several operators are counted once. The operators fused into a Pipeline are not executed themselves; their work
+// is part of the pipeline's data.
+OperatorPerformanceData aggregate_performance_data(const AbstractOperator& root);
+
+}  // namespace opossum
@@ -0,0 +1,244 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include "reference_output.hpp"
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Keeps the selected rows for which predicate(offset) is true. The loop writes every offset and only advances the
+// output position for matches, so that it does not branch on the predicate.
+template <typename Predicate>
+void narrow_selection(std::vector<ChunkOffset>& selection, const Predicate& predicate) {
+  auto selected_count = size_t{0};
+  for (const auto offset : selection) {
+    selection[selected_count] = offset;
+    selected_count += predicate(offset);
+  }
+  selection.resize(selected_count);
+}
+
+// Calls the functor with the comparator of a comparison scan type.
+template <typename Functor>
+void resolve_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      functor(std::equal_to<>{});
+      return;
+    case ScanType::OpNotEquals:
+      functor(std::not_equal_to<>{});
+      return;
+    case ScanType::OpLessThan:
+      functor(std::less<>{});
+      return;
+    case ScanType::OpLessThanEquals:
+      functor(std::less_equal<>{});
+      return;
+    case ScanType::OpGreaterThan:
+      functor(std::greater<>{});
+      return;
+    case ScanType::OpGreaterThanEquals:
+      functor(std::greater_equal<>{});
+      return;
+    default:
+      Fail("Unsupported scan type.");
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+Batch::Batch(const Table& table)
+    : _table{table}, _columns(table.column_count()), _is_materialized(table.column_count()) {
+  _selection.reserve(BATCH_SIZE);
+}
+
+void Batch::reset(const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  DebugAssert(end_offset - begin_offset <= BATCH_SIZE, "Batch is too large.");
+  _chunk_id = chunk_id;
+  _begin_offset = begin_offset;
+  _end_offset = end_offset;
+  _selection.resize(end_offset - begin_offset);
+  std::iota(_selection.begin(), _selection.end(), ChunkOffset{0});
+  std::fill(_is_materialized.begin(), _is_materialized.end(), false);
+}
+
+const Table& Batch::table() const {
+  return _table;
+}
+
+ChunkID Batch::chunk_id() const {
+  return _chunk_id;
+}
+
+ChunkOffset Batch::begin_offset() const {
+  return _begin_offset;
+}
+
+ChunkOffset Batch::size() const {
+  return _end_offset - _begin_offset;
+}
+
+std::vector<ChunkOffset>& Batch::selection() {
+  return _selection;
+}
+
+TableScanStage::TableScanStage(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value)
+    : _column_id{column_id}, _scan_type{scan_type}, _search_value{search_value} {
+  if ((scan_type == ScanType::OpLike || scan_type == ScanType::OpNotLike) && !variant_is_null(search_value)) {
+    _like_matcher = std::make_unique<const LikeMatcher>(type_cast<std::string>(search_value));
+  }
+}
+
+bool TableScanStage::process(Batch& batch) {
+  auto& selection = batch.selection();
+  const auto is_null_scan = _scan_type == ScanType::OpIsNull || _scan_type == ScanType::OpIsNotNull;
+  if (variant_is_null(_search_value) && !is_null_scan) {
+    // Any comparison with NULL is false.
+    selection.clear();
+    return true;
+  }
+
+  resolve_data_type(batch.table().column_data_type(_column_id), [&](auto type) {
+    using Type = typename decltype(type)::type;
+    const auto& column = batch.column<Type>(_column_id);
+    const auto& values = column.values;
+    const auto& nulls = column.nulls;
+
+    if (_scan_type == ScanType::OpIsNull) {
+      narrow_selection(selection, [&](const ChunkOffset offset) { return nulls[offset]; });
+    } else if (_scan_type == ScanType::OpIsNotNull) {
+      narrow_selection(selection, [&](const ChunkOffset offset) { return !nulls[offset]; });
+    } else if (_scan_type == ScanType::OpLike || _scan_type == ScanType::OpNotLike) {
+      if constexpr (std::is_same_v<Type, std::string>) {
+        const auto expected_match = _scan_type == ScanType::OpLike;
+        narrow_selection(selection, [&](const ChunkOffset offset) {
+          return !nulls[offset] && _like_matcher->matches(values[offset]) == expected_match;
+        });
+      } else {
+        Fail("LIKE scans are only supported on string columns.");
+      }
+    } else {
+      const auto search_value = type_cast<Type>(_search_value);
+      const auto typed_search_value = BatchValue<Type>{search_value};
+      resolve_comparator(_scan_type, [&](const auto& comparator) {
+        narrow_selection(selection, [&](const ChunkOffset offset) {
+          return !nulls[offset] && comparator(values[offset], typed_search_value);
+        });
+      });
+    }
+  });
+  return true;
+}
+
+LimitStage::LimitStage(const uint64_t row_count) : _remaining_row_count{row_count} {}
+
+bool LimitStage::process(Batch& batch) {
+  auto& selection = batch.selection();
+  if (selection.size() > _remaining_row_count) {
+    selection.resize(_remaining_row_count);
+  }
+  _remaining_row_count -= selection.size();
+  return _remaining_row_count > 0;
+}
+
+Pipeline::Pipeline(const std::shared_ptr<const AbstractOperator>& root) {
+  auto input = root;
+  while (auto stage = input->create_pipeline_stage()) {
+    _operators.push_back(input);
+    _stages.push_back(std::move(stage));
+    input = input->left_input();
+  }
+  Assert(!_stages.empty(), "The root operator does not support pipelined execution.");
+  std::reverse(_operators.begin(), _operators.end());
+  std::reverse(_stages.begin(), _stages.end());
+  _left_input = input;
+}
+
+size_t Pipeline::stage_count() const {
+  return _stages.size();
+}
+
+std::optional<std::string> Pipeline::description() const {
+  // The output is the same as the one of the fused operators.
+  auto description = std::string{"Pipeline"};
+  for (const auto& op : _operators) {
+    const auto operator_description = op->description();
+    if (!operator_description) {
+      return std::nullopt;
+    }
+    description += " | " + *operator_description;
+  }
+  return description;
+}
+
+std::shared_ptr<AbstractOperator> Pipeline::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  auto copied_root = copied_left_input;
+  for (const auto& op : _operators) {
+    copied_root = op->_on_deep_copy(copied_root, nullptr);
+  }
+  return std::make_shared<Pipeline>(copied_root);
+}
+
+std::shared_ptr<const Table> Pipeline::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(input_table, "Pipeline requires an input.");
+
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size());
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_nullable(column_id));
+  }
+
+  const auto input_pos_lists = pos_lists_by_column(*input_table);
+  const auto chunk_count = input_table->chunk_count();
+  auto batch = Batch{*input_table};
+  auto is_done = false;
+  auto chunk_id = ChunkID{0};
+  for (; chunk_id < chunk_count && !is_done; ++chunk_id) {
+    const auto chunk_size = input_table->get_chunk(chunk_id)->size();
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    for (auto begin_offset = ChunkOffset{0}; begin_offset < chunk_size && !is_done; begin_offset += BATCH_SIZE) {
+      batch.reset(chunk_id, begin_offset, std::min(begin_offset + BATCH_SIZE, chunk_size));
+      for (const auto& stage : _stages) {
+        if (batch.selection().empty()) {
+          break;
+        }
+        is_done |= !stage->process(batch);
+      }
+
+      for (const auto offset : batch.selection()) {
+        chunk_offsets.push_back(begin_offset + offset);
+      }
+    }
+
+    if (chunk_offsets.empty()) {
+      continue;
+    }
+
+    auto output_chunk = std::make_shared<Chunk>();
+    add_reference_segments(*output_chunk, input_table,
+                           make_single_chunk_pos_list(chunk_id, std::move(chunk_offsets), chunk_size), input_pos_lists);
+    output_table->append_chunk(output_chunk);
+  }
+  _performance_data.pruned_chunk_count = chunk_count - chunk_id;
+
+  if (!output_table->row_count()) {
+    append_empty_chunk(*output_table);
+  }
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/table.hpp"
+#include "utils/like_matcher.hpp"
+
+namespace opossum {
+
+// Pipelined execution: Instead of materializing a complete output table per operator, a chain of operators that
+// support it (see AbstractOperator::create_pipeline_stage) is fused into a Pipeline. The pipeline pushes batches of
+// at most BATCH_SIZE rows of its input through one stage per fused operator. Stages only narrow the batch's selection
+// vector, so that the columns they access (which are materialized once per batch) stay in the CPU caches. Only the
+// rows that pass all stages are written to the pipeline's output table. Operators that need their complete input,
+// e.g., hash joins, aggregates, and sorts, break pipelines and are executed as before.
+constexpr auto BATCH_SIZE = ChunkOffset{2048};
+
+// Strings are not copied into batches but referenced in their segments.
+template <typename T>
+using BatchValue = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+class BaseBatchColumn {
+ public:
+  virtual ~BaseBatchColumn() = default;
+};
+
+// The values of a column for all rows of a batch, indexed by the row's offset in the batch. For NULLs, nulls is 1 and
+// the value is T{}. nulls is a vector of bytes rather than bits to keep the loops over it free of branches.
+template <typename T>
+class BatchColumn : public BaseBatchColumn {
+ public:
+  std::vector<BatchValue<T>> values;
+  std::vector<uint8_t> nulls;
+};
+
+// A batch holds consecutive rows of one chunk of a table. Its columns are materialized when they are first accessed.
+// The buffers are kept when the batch is reset to the next rows, so that a pipeline does not allocate per batch.
+class Batch : private Noncopyable {
+ public:
+  explicit Batch(const Table& table);
+
+  // Makes the batch hold the rows [begin_offset, end_offset) of the chunk, all of them selected.
+  void reset(const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
+  const Table& table() const;
+
+  ChunkID chunk_id() const;
+
+  ChunkOffset begin_offset() const;
+
+  // Returns the number of rows, including the ones that are not selected.
+  ChunkOffset size() const;
+
+  // The ascending offsets (relative to begin_offset) of the selected rows.
+  std::vector<ChunkOffset>& selection();
+
+  // Returns the values of the column, which needs to be of type T.
+  template <typename T>
+  const BatchColumn<T>& column(const ColumnID column_id) {
+    auto& column = _columns[column_id];
+    if (!column) {
+      column = std::make_unique<BatchColumn<T>>();
+    }
+
+    auto& typed_column = static_cast<BatchColumn<T>&>(*column);
+    if (!_is_materialized[column_id]) {
+      const auto size = _end_offset - _begin_offset;
+      typed_column.values.resize(size);
+      typed_column.nulls.resize(size);
+      const auto& segment = *_table.get_chunk(_chunk_id)->get_segment(column_id);
+      segment_iterate<T>(segment, _begin_offset, _end_offset, [&](const SegmentPosition<T>& position) {
+        const auto index = position.chunk_offset - _begin_offset;
+        typed_column.values[index] = position.value;
+        typed_column.nulls[index] = position.is_null;
+      });
+      _is_materialized[column_id] = true;
+    }
+    return typed_column;
+  }
+
+ private:
+  const Table& _table;
+  ChunkID _chunk_id{0};
+  ChunkOffset _begin_offset{0};
+  ChunkOffset _end_offset{0};
+  std::vector<ChunkOffset> _selection;
+  std::vector<std::unique_ptr<BaseBatchColumn>> _columns;
+  std::vector<bool> _is_materialized;
+};
+
+// The batch-at-a-time counterpart of an operator.
+class AbstractPipelineStage : private Noncopyable {
+ public:
+  virtual ~AbstractPipelineStage() = default;
+
+  // Removes the rows that the operator would not output from the batch's selection. Returns false if the stage does
+  // not need any further batches.
+  virtual bool process(Batch& batch) = 0;
+};
+
+// Keeps the rows that TableScan would return.
+class TableScanStage : public AbstractPipelineStage {
+ public:
+  TableScanStage(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value);
+
+  bool process(Batch& batch) override;
+
+ protected:
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+  std::unique_ptr<const LikeMatcher> _like_matcher;
+};
+
+// Keeps the first row_count rows that reach the stage.
+class LimitStage : public AbstractPipelineStage {
+ public:
+  explicit LimitStage(const uint64_t row_count);
+
+  bool process(Batch& batch) override;
+
+ protected:
+  uint64_t _remaining_row_count;
+};
+
+// Executes the given operator and the operators below it that support pipelined execution in one pass over the input
+// of the lowest one, which needs to be executed before the pipeline. The fused operators are not executed themselves.
+// The output is the same as the one of the root operator if all operators were executed one after another.
+class Pipeline : public AbstractOperator {
+ public:
+  explicit Pipeline(const std::shared_ptr<const AbstractOperator>& root);
+
+  // Returns the number of fused operators.
+  size_t stage_count() const;
+
+  std::optional<std::string> description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Fuses copies of the fused operators on top of the copied input.
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  // The fused operators and their stages, from the lowest to the root operator.
+  std::vector<std::shared_ptr<const AbstractOperator>> _operators;
+  std::vector<std::unique_ptr<AbstractPipelineStage>> _stages;
+};
+
+}  // namespace opossum
@@ -1,11 +1,12 @@
 #include "print.hpp"
 
 #include <iomanip>
+#include <sstream>
 
 #include "operators/table_wrapper.hpp"
-#include "storage/abstract_segment.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterables.hpp"
 #include "storage/table.hpp"
-#include "type_cast.hpp"
 
 namespace {
 
@@ -21,6 +22,28 @@ std::string print_column_type(const std::shared_ptr<const Table>& table, const C
   return stream.str();
 }
 
+// Returns the printed representation of the chunk's values, per column.
+std::vector<std::vector<std::string>> print_chunk_values(const Table& table, const Chunk& chunk) {
+  const auto column_count = chunk.column_count();
+  auto values = std::vector<std::vector<std::string>>(column_count, std::vector<std::string>(chunk.size()));
+  auto stream = std::stringstream{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      segment_iterate<Type>(*chunk.get_segment(column_id), [&](const SegmentPosition<Type>& position) {
+        stream.str("");
+        if (position.is_null) {
+          stream << NULL_VALUE;
+        } else {
+          stream << position.value;
+        }
+        values[column_id][position.chunk_offset] = stream.str();
+      });
+    });
+  }
+  return values;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -33,6 +56,12 @@ void Print::print(std::shared_ptr<const Table>& table, std::ostream& out) {
   Print(table_wrapper, out).execute();
 }
 
+std::shared_ptr<AbstractOperator> Print::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  return std::make_shared<Print>(copied_left_input, _out);
+}
+
 std::shared_ptr<const Table> Print::_on_execute() {
   auto widths = _column_string_widths(8, 20, _left_input_table());
 
@@ -61,14 +90,13 @@ std::shared_ptr<const Table> Print::_on_execute() {
     }
 
     // Print the rows in the chunk.
+    const auto values = print_chunk_values(*_left_input_table(), *chunk);
     const auto chunk_size = chunk->size();
     for (size_t row = 0; row < chunk_size; ++row) {
       _out << "|";
       const auto column_count = chunk->column_count();
       for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-        // Yes, we use AbstractSegment::operator[] here, but since Print is not an operation that should be part of a
-        // regular query plan, let's keep things simple here.
-        _out << std::setw(widths[column_id]) << (*chunk->get_segment(column_id))[row] << "|" << std::setw(0);
+        _out << std::setw(widths[column_id]) << values[column_id][row] << "|" << std::setw(0);
       }
 
       _out << std::endl;
@@ -91,15 +119,14 @@ std::vector<uint16_t> Print::_column_string_widths(uint16_t min, uint16_t max,
   }
 
   // Go over all rows and find the maximum length of the printed representation of a value, up to max.
-  const auto left_chunk_count = _left_input_table()->chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < left_chunk_count; ++chunk_id) {
-    auto chunk = _left_input_table()->get_chunk(chunk_id);
-
-    const auto column_count = chunk->column_count();
-    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-      for (auto row = size_t{0}; row < chunk->size(); ++row) {
-        auto cell_length =
-            static_cast<uint16_t>(boost::lexical_cast<std::string>((*chunk->get_segment(column_id))[row]).size());
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto values = print_chunk_values(*table, *chunk);
+    const auto chunk_column_count = chunk->column_count();
+    for (auto column_id = ColumnID{0}; column_id < chunk_column_count; ++column_id) {
+      for (const auto& value : values[column_id]) {
+        const auto cell_length = static_cast<uint16_t>(value.size());
         widths[column_id] = std::max({min, widths[column_id], std::min(max, cell_length)});
       }
     }
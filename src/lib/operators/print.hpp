@@ -18,6 +18,10 @@ class Print : public AbstractOperator {
                                               const std::shared_ptr<const Table>& table) const;
   std::shared_ptr<const Table> _on_execute() override;
 
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
   // stream to print the result
   std::ostream& _out;
 };
@@ -0,0 +1,398 @@
+#include "projection.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#include "reference_output.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_values.hpp"
+#include "type_cast.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// The values of an expression for the rows of a chunk. Expressions that do not depend on the rows (e.g., values) hold
+// a single value, which applies to all rows.
+template <typename T>
+struct ExpressionResult {
+  std::vector<T> values;
+
+  // Empty if no value is NULL, of the same size as values otherwise.
+  std::vector<bool> nulls;
+
+  size_t size() const {
+    return values.size();
+  }
+
+  // Single values are broadcast to all rows.
+  bool is_null(const size_t row) const {
+    return !nulls.empty() && nulls[nulls.size() == 1 ? 0 : row];
+  }
+
+  void set_null(const size_t row) {
+    if (nulls.empty()) {
+      nulls.resize(values.size());
+    }
+    nulls[row] = true;
+  }
+
+  // Turns a single value into one value per row.
+  void broadcast(const size_t row_count) {
+    if (values.size() == 1 && row_count != 1) {
+      values.resize(row_count, values.front());
+      if (!nulls.empty()) {
+        nulls.resize(row_count, nulls.front());
+      }
+    }
+  }
+};
+
+// A row of a result that combines two arguments is NULL if it is NULL in either argument.
+template <typename L, typename R>
+std::vector<bool> combine_nulls(const ExpressionResult<L>& left, const ExpressionResult<R>& right,
+                                const size_t row_count) {
+  if (left.nulls.empty() && right.nulls.empty()) {
+    return {};
+  }
+  if (right.nulls.empty() && left.size() == row_count) {
+    return left.nulls;
+  }
+  if (left.nulls.empty() && right.size() == row_count) {
+    return right.nulls;
+  }
+
+  auto nulls = std::vector<bool>(row_count);
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    nulls[row] = left.is_null(row) || right.is_null(row);
+  }
+  return nulls;
+}
+
+// Applies the functor to the values of both arguments row by row, ignoring NULLs. Single values are broadcast. Each
+// combination of single values and vectors gets its own branch-free loop, so that the compiler can vectorize it.
+template <typename Result, typename T, typename Functor>
+ExpressionResult<Result> apply_binary(const ExpressionResult<T>& left, const ExpressionResult<T>& right,
+                                      const Functor& functor) {
+  const auto row_count = std::max(left.size(), right.size());
+  auto result = ExpressionResult<Result>{};
+  result.values.resize(row_count);
+  auto* const result_values = result.values.data();
+  const auto* const left_values = left.values.data();
+  const auto* const right_values = right.values.data();
+  if (left.size() == right.size()) {
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      result_values[row] = functor(left_values[row], right_values[row]);
+    }
+  } else if (left.size() == 1) {
+    const auto& left_value = left.values.front();
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      result_values[row] = functor(left_value, right_values[row]);
+    }
+  } else {
+    DebugAssert(right.size() == 1, "Arguments must have the same size or hold a single value.");
+    const auto& right_value = right.values.front();
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      result_values[row] = functor(left_values[row], right_value);
+    }
+  }
+
+  result.nulls = combine_nulls(left, right, row_count);
+  return result;
+}
+
+// Evaluates expressions on the rows of a chunk.
+class ChunkEvaluator {
+ public:
+  ChunkEvaluator(const Table& table, const Chunk& chunk) : _table{table}, _chunk{chunk} {}
+
+  // Returns the values of the expression, whose data type must be T.
+  template <typename T>
+  ExpressionResult<T> evaluate(const AbstractExpression& expression) const {
+    if (const auto* column_expression = dynamic_cast<const ColumnExpression*>(&expression)) {
+      return _evaluate_column<T>(*column_expression);
+    }
+    if (const auto* value_expression = dynamic_cast<const ValueExpression*>(&expression)) {
+      return ExpressionResult<T>{{type_cast<T>(value_expression->value())}, {}};
+    }
+    if (const auto* case_expression = dynamic_cast<const CaseExpression*>(&expression)) {
+      return _evaluate_case<T>(*case_expression);
+    }
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (const auto* arithmetic_expression = dynamic_cast<const ArithmeticExpression*>(&expression)) {
+        return _evaluate_arithmetic<T>(*arithmetic_expression);
+      }
+    }
+    if constexpr (std::is_same_v<T, int32_t>) {
+      if (const auto* comparison_expression = dynamic_cast<const ComparisonExpression*>(&expression)) {
+        return _evaluate_comparison(*comparison_expression);
+      }
+    }
+    Fail("Unsupported expression or data type.");
+  }
+
+  // Returns the values of the expression converted to T.
+  template <typename T>
+  ExpressionResult<T> evaluate_as(const AbstractExpression& expression) const {
+    auto result = ExpressionResult<T>{};
+    resolve_data_type(expression.data_type(_table), [&](auto type) {
+      using ExpressionType = typename decltype(type)::type;
+      if constexpr (std::is_same_v<ExpressionType, T>) {
+        result = evaluate<T>(expression);
+      } else if constexpr (std::is_arithmetic_v<ExpressionType> && std::is_arithmetic_v<T>) {
+        auto argument = evaluate<ExpressionType>(expression);
+        result.values.resize(argument.size());
+        std::copy(argument.values.cbegin(), argument.values.cend(), result.values.begin());
+        result.nulls = std::move(argument.nulls);
+      } else {
+        Fail("Strings and numbers cannot be converted into each other.");
+      }
+    });
+    return result;
+  }
+
+ protected:
+  template <typename T>
+  ExpressionResult<T> _evaluate_column(const ColumnExpression& expression) const {
+    const auto& segment = *_chunk.get_segment(expression.column_id());
+    auto result = ExpressionResult<T>{};
+    if (const auto* value_segment = segment_cast<ValueSegment<T>>(&segment)) {
+      result.values = value_segment->values();
+      if (value_segment->is_nullable()) {
+        const auto& null_values = value_segment->null_values();
+        if (std::find(null_values.cbegin(), null_values.cend(), true) != null_values.cend()) {
+          result.nulls = null_values;
+        }
+      }
+      return result;
+    }
+
+    result.values.resize(segment.size());
+    for_each_segment_value<T>(
+        segment, [&](const ChunkOffset chunk_offset, const T& value) { result.values[chunk_offset] = value; },
+        [&](const ChunkOffset chunk_offset) { result.set_null(chunk_offset); });
+    return result;
+  }
+
+  template <typename T>
+  ExpressionResult<T> _evaluate_arithmetic(const ArithmeticExpression& expression) const {
+    const auto left = evaluate_as<T>(*expression.left());
+    const auto right = evaluate_as<T>(*expression.right());
+    switch (expression.arithmetic_operator()) {
+      case ArithmeticOperator::Addition:
+        return apply_binary<T>(left, right, [](const T lhs, const T rhs) { return static_cast<T>(lhs + rhs); });
+      case ArithmeticOperator::Subtraction:
+        return apply_binary<T>(left, right, [](const T lhs, const T rhs) { return static_cast<T>(lhs - rhs); });
+      case ArithmeticOperator::Multiplication:
+        return apply_binary<T>(left, right, [](const T lhs, const T rhs) { return static_cast<T>(lhs * rhs); });
+      case ArithmeticOperator::Division: {
+        // Divisions by zero return NULL, as does the integer division of the minimum value by -1, which overflows (and
+        // traps). Such divisors are replaced in the loop, so that it does not need to branch, and the NULLs are set
+        // afterwards.
+        const auto is_undefined = [](const T lhs, const T rhs) {
+          if constexpr (std::is_integral_v<T>) {
+            return rhs == T{0} || (rhs == T{-1} && lhs == std::numeric_limits<T>::min());
+          } else {
+            return rhs == T{0};
+          }
+        };
+        auto result = apply_binary<T>(left, right, [&](const T lhs, const T rhs) {
+          return static_cast<T>(lhs / (is_undefined(lhs, rhs) ? T{1} : rhs));
+        });
+        for (auto row = size_t{0}; row < result.size(); ++row) {
+          if (is_undefined(left.values[left.size() == 1 ? 0 : row], right.values[right.size() == 1 ? 0 : row])) {
+            result.set_null(row);
+          }
+        }
+        return result;
+      }
+    }
+    Fail("Unknown arithmetic operator.");
+  }
+
+  ExpressionResult<int32_t> _evaluate_comparison(const ComparisonExpression& expression) const {
+    auto result = ExpressionResult<int32_t>{};
+    const auto data_type =
+        common_data_type(expression.left()->data_type(_table), expression.right()->data_type(_table));
+    resolve_data_type(data_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+      const auto left = evaluate_as<Type>(*expression.left());
+      const auto right = evaluate_as<Type>(*expression.right());
+      switch (expression.scan_type()) {
+        case ScanType::OpEquals:
+          result = apply_binary<int32_t>(left, right, [](const auto& lhs, const auto& rhs) { return lhs == rhs; });
+          return;
+        case ScanType::OpNotEquals:
+          result = apply_binary<int32_t>(left, right, [](const auto& lhs, const auto& rhs) { return lhs != rhs; });
+          return;
+        case ScanType::OpLessThan:
+          result = apply_binary<int32_t>(left, right, [](const auto& lhs, const auto& rhs) { return lhs < rhs; });
+          return;
+        case ScanType::OpLessThanEquals:
+          result = apply_binary<int32_t>(left, right, [](const auto& lhs, const auto& rhs) { return lhs <= rhs; });
+          return;
+        case ScanType::OpGreaterThan:
+          result = apply_binary<int32_t>(left, right, [](const auto& lhs, const auto& rhs) { return lhs > rhs; });
+          return;
+        case ScanType::OpGreaterThanEquals:
+          result = apply_binary<int32_t>(left, right, [](const auto& lhs, const auto& rhs) { return lhs >= rhs; });
+          return;
+        default:
+          Fail("Unsupported scan type for comparison expressions.");
+      }
+    });
+    return result;
+  }
+
+  template <typename T>
+  ExpressionResult<T> _evaluate_case(const CaseExpression& expression) const {
+    // All rows start with the else value (or NULL). The branches are applied from the last to the first one, so that
+    // each row ends up with the value of its first matching branch.
+    const auto row_count = _chunk.size();
+    auto result = ExpressionResult<T>{};
+    if (expression.else_expression()) {
+      result = evaluate_as<T>(*expression.else_expression());
+      result.broadcast(row_count);
+    } else {
+      result.values.resize(row_count);
+      result.nulls.resize(row_count, true);
+    }
+
+    const auto& branches = expression.branches();
+    for (auto branch_it = branches.crbegin(); branch_it != branches.crend(); ++branch_it) {
+      const auto condition = evaluate<int32_t>(*branch_it->first);
+      const auto value = evaluate_as<T>(*branch_it->second);
+      for (auto row = size_t{0}; row < row_count; ++row) {
+        if (condition.is_null(row) || !condition.values[condition.size() == 1 ? 0 : row]) {
+          continue;
+        }
+
+        result.values[row] = value.values[value.size() == 1 ? 0 : row];
+        if (value.is_null(row)) {
+          result.set_null(row);
+        } else if (!result.nulls.empty()) {
+          result.nulls[row] = false;
+        }
+      }
+    }
+    return result;
+  }
+
+  const Table& _table;
+  const Chunk& _chunk;
+};
+
+}  // namespace
+
+namespace opossum {
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator>& in,
+                       const std::vector<std::shared_ptr<const AbstractExpression>>& expressions)
+    : AbstractOperator{in}, _expressions{expressions} {
+  for (const auto& expression : expressions) {
+    Assert(expression, "Projection expressions must not be nullptr.");
+  }
+}
+
+const std::vector<std::shared_ptr<const AbstractExpression>>& Projection::expressions() const {
+  return _expressions;
+}
+
+std::optional<std::string> Projection::description() const {
+  // Columns are described by their ids, values with their type (see _describe_value), so that the description does
+  // not depend on the input table and different expressions are described differently.
+  const auto describe_column = [](const ColumnID column_id) { return "#" + std::to_string(column_id); };
+  auto description = std::string{"Projection"};
+  for (const auto& expression : _expressions) {
+    description += " " + expression->describe(describe_column, _describe_value) + ",";
+  }
+  return description;
+}
+
+std::shared_ptr<AbstractOperator> Projection::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  return std::make_shared<Projection>(copied_left_input, _expressions);
+}
+
+std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(input_table, "Projection requires an input.");
+
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size());
+  for (const auto& expression : _expressions) {
+    output_table->add_column_definition(expression->description(*input_table), expression->data_type(*input_table),
+                                        expression->is_nullable(*input_table));
+  }
+
+  const auto is_reference_table = !pos_lists_by_column(*input_table).empty();
+  const auto selects_columns_only = std::all_of(_expressions.cbegin(), _expressions.cend(), [](const auto& expression) {
+    return dynamic_cast<const ColumnExpression*>(expression.get()) != nullptr;
+  });
+
+  const auto chunk_count = input_table->chunk_count();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  parallel_for(chunk_count, _max_parallelism, [&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    const auto input_chunk = input_table->get_chunk(chunk_id);
+    const auto row_count = input_chunk->size();
+    if (!row_count) {
+      return;
+    }
+
+    // Column selections on data tables reference the chunk's rows with a position list shared by all columns.
+    const auto pos_list = selects_columns_only && !is_reference_table
+                              ? std::make_shared<ChunkRangePosList>(chunk_id, ChunkOffset{0}, row_count)
+                              : nullptr;
+    const auto evaluator = ChunkEvaluator{*input_table, *input_chunk};
+    auto output_chunk = std::make_shared<Chunk>();
+    const auto expression_count = _expressions.size();
+    for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+      const auto& expression = *_expressions[column_id];
+      const auto* column_expression = dynamic_cast<const ColumnExpression*>(&expression);
+      if (pos_list) {
+        output_chunk->add_segment(
+            std::make_shared<ReferenceSegment>(input_table, column_expression->column_id(), pos_list));
+        continue;
+      }
+      // Reference segments of column selections are passed on, as are dictionary segments, which are immutable. Value
+      // segments may still be appended to, so they are copied.
+      if (column_expression) {
+        const auto& segment = input_chunk->get_segment(column_expression->column_id());
+        if (selects_columns_only || segment->encoding() == SegmentEncoding::Dictionary) {
+          output_chunk->add_segment(segment);
+          continue;
+        }
+      }
+
+      resolve_data_type(output_table->column_data_type(column_id), [&](auto type) {
+        using Type = typename decltype(type)::type;
+        auto result = evaluator.evaluate<Type>(expression);
+        result.broadcast(row_count);
+        if (output_table->column_nullable(column_id)) {
+          result.nulls.resize(row_count);
+          output_chunk->add_segment(
+              std::make_shared<ValueSegment<Type>>(std::move(result.values), std::move(result.nulls)));
+        } else {
+          DebugAssert(result.nulls.empty(), "Expression is not nullable, but returned NULLs.");
+          output_chunk->add_segment(std::make_shared<ValueSegment<Type>>(std::move(result.values)));
+        }
+      });
+    }
+    output_chunks[chunk_id] = output_chunk;
+  });
+
+  for (const auto& chunk : output_chunks) {
+    if (chunk) {
+      output_table->append_chunk(chunk);
+    }
+  }
+  if (!output_table->row_count()) {
+    append_empty_chunk(*output_table);
+  }
+  return output_table;
+}
+
+}  // namespace opossum
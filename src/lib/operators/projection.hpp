@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "expression.hpp"
+
+namespace opossum {
+
+// Computes one output column per expression. The columns are named by the expressions' descriptions.
+//
+// If all expressions are columns of the input, no value is copied: the output references the input rows. Otherwise,
+// the expressions are evaluated chunk by chunk (in parallel) on typed vectors of the chunk's values. The loops that
+// compute the values do not check for NULLs, so that the compiler can vectorize them. NULLs are tracked separately
+// and combined afterwards. Dictionary segments of data tables are passed on without copying, all other columns are
+// stored in value segments.
+class Projection : public AbstractOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator>& in,
+             const std::vector<std::shared_ptr<const AbstractExpression>>& expressions);
+
+  const std::vector<std::shared_ptr<const AbstractExpression>>& expressions() const;
+
+  std::optional<std::string> description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  const std::vector<std::shared_ptr<const AbstractExpression>> _expressions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,154 @@
+#include "reference_output.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Calls emit with the position at each of the indices [indices_begin, indices_end) of the position list. Positions are
+// looked up with the concrete type of the list. BitmapPosLists are walked with an iterator, so that ascending indices
+// (e.g., of a scan's output) cost O(1) each instead of a binary search per index.
+template <typename IndexIterator, typename Emit>
+void positions_at(const AbstractPosList& pos_list, const IndexIterator indices_begin, const IndexIterator indices_end,
+                  const Emit& emit) {
+  resolve_pos_list_type(pos_list, [&](const auto& typed_pos_list) {
+    using PosListType = std::decay_t<decltype(typed_pos_list)>;
+
+    if constexpr (std::is_same_v<PosListType, BitmapPosList>) {
+      auto position_it = typed_pos_list.begin();
+      auto position_index = ChunkOffset{0};
+      for (auto index_it = indices_begin; index_it != indices_end; ++index_it) {
+        const auto index = RowID{*index_it}.chunk_offset;
+        // Seek for indices behind the iterator or far ahead of it, step otherwise.
+        if (index < position_index || index - position_index > BitmapPosList::BITS_PER_WORD) {
+          position_it = typed_pos_list.iterator_at(index);
+          position_index = index;
+        }
+        for (; position_index < index; ++position_index) {
+          ++position_it;
+        }
+        emit(*position_it);
+      }
+    } else {
+      for (auto index_it = indices_begin; index_it != indices_end; ++index_it) {
+        emit(typed_pos_list[RowID{*index_it}.chunk_offset]);
+      }
+    }
+  });
+}
+
+// Returns the rows of the data table that the positions of a reference table refer to, given the position lists of
+// one of the table's columns.
+std::shared_ptr<const AbstractPosList> resolve_positions(const AbstractPosList& pos_list,
+                                                         const PosListsByChunk& column_pos_lists) {
+  // If all positions belong to one input chunk whose positions all belong to one data chunk, so do the resolved
+  // positions, which we can then store compactly.
+  const auto input_chunk_id = pos_list.common_chunk_id();
+  if (input_chunk_id != INVALID_CHUNK_ID) {
+    const auto& input_pos_list = *column_pos_lists[input_chunk_id];
+    const auto chunk_id = input_pos_list.common_chunk_id();
+    if (chunk_id != INVALID_CHUNK_ID) {
+      auto chunk_offsets = std::vector<ChunkOffset>{};
+      chunk_offsets.reserve(pos_list.size());
+      resolve_pos_list_type(pos_list, [&](const auto& typed_pos_list) {
+        positions_at(input_pos_list, typed_pos_list.begin(), typed_pos_list.end(),
+                     [&](const RowID& row_id) { chunk_offsets.push_back(row_id.chunk_offset); });
+      });
+
+      if (!std::is_sorted(chunk_offsets.cbegin(), chunk_offsets.cend())) {
+        return std::make_shared<SingleChunkPosList>(chunk_id, std::move(chunk_offsets));
+      }
+      // The largest offset bounds the size of the referenced chunk, which is all that the bitmap needs to know.
+      const auto chunk_size = chunk_offsets.empty() ? ChunkOffset{0} : chunk_offsets.back() + 1;
+      return make_single_chunk_pos_list(chunk_id, std::move(chunk_offsets), chunk_size);
+    }
+  }
+
+  auto resolved_pos_list = std::make_shared<PosList>();
+  resolved_pos_list->reserve(pos_list.size());
+  for_each_chunk_run(pos_list, [&](const ChunkID chunk_id, const auto rows_begin, const auto rows_end,
+                                   const size_t /*first_index*/) {
+    if (chunk_id == INVALID_CHUNK_ID) {
+      resolved_pos_list->insert(resolved_pos_list->end(), static_cast<size_t>(std::distance(rows_begin, rows_end)),
+                                NULL_ROW_ID);
+      return;
+    }
+    positions_at(*column_pos_lists[chunk_id], rows_begin, rows_end,
+                 [&](const RowID& row_id) { resolved_pos_list->push_back(row_id); });
+  });
+  return resolved_pos_list;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::vector<PosListsByChunk> pos_lists_by_column(const Table& table) {
+  const auto column_count = table.column_count();
+  if (!column_count ||
+      table.get_chunk(ChunkID{0})->get_segment(ColumnID{0})->encoding() != SegmentEncoding::Reference) {
+    return {};
+  }
+
+  const auto chunk_count = table.chunk_count();
+  auto pos_lists = std::vector<PosListsByChunk>(column_count, PosListsByChunk(chunk_count));
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto* reference_segment = segment_cast<ReferenceSegment>(chunk->get_segment(column_id).get());
+      Assert(reference_segment, "Operator inputs must not mix reference segments and data segments.");
+      pos_lists[column_id][chunk_id] = reference_segment->pos_list();
+    }
+  }
+  return pos_lists;
+}
+
+void add_reference_segments(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                            const std::shared_ptr<const AbstractPosList>& pos_list,
+                            const std::vector<PosListsByChunk>& input_pos_lists) {
+  const auto column_count = input_table->column_count();
+  if (input_pos_lists.empty()) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+    }
+    return;
+  }
+
+  // A reference segment must not reference another reference segment, so we look up which rows of the data table the
+  // input rows refer to. Columns that share their position lists in all input chunks (e.g., all columns of a scan's
+  // output) also share the resolved position list.
+  auto resolved_pos_lists = std::map<PosListsByChunk, std::shared_ptr<const AbstractPosList>>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& column_pos_lists = input_pos_lists[column_id];
+    auto& resolved_pos_list = resolved_pos_lists[column_pos_lists];
+    if (!resolved_pos_list) {
+      resolved_pos_list = resolve_positions(*pos_list, column_pos_lists);
+    }
+
+    const auto input_segment =
+        std::static_pointer_cast<const ReferenceSegment>(input_table->get_chunk(ChunkID{0})->get_segment(column_id));
+    output_chunk.add_segment(std::make_shared<ReferenceSegment>(
+        input_segment->referenced_table(), input_segment->referenced_column_id(), resolved_pos_list));
+  }
+}
+
+void append_empty_chunk(Table& table) {
+  auto chunk = std::make_shared<Chunk>();
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      chunk->add_segment(std::make_shared<ValueSegment<ColumnDataType>>(table.column_nullable(column_id)));
+    });
+  }
+  table.append_chunk(chunk);
+}
+
+}  // namespace opossum
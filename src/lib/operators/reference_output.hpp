@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// Helpers for operators whose output references the rows of their input tables.
+
+// The position lists of a column of a reference table, indexed by the input chunk id.
+using PosListsByChunk = std::vector<std::shared_ptr<const AbstractPosList>>;
+
+// Returns the position lists of each column if the table consists of reference segments, an empty vector otherwise.
+std::vector<PosListsByChunk> pos_lists_by_column(const Table& table);
+
+// Adds one reference segment per column of the input table to the output chunk. The positions reference the input
+// table. If the input table consists of reference segments itself (i.e., input_pos_lists is not empty), the positions
+// are resolved so that the output references the underlying data tables. Each input position list is walked in the
+// order of the positions, so resolving ascending positions (e.g., of a scan) does not need random accesses.
+void add_reference_segments(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                            const std::shared_ptr<const AbstractPosList>& pos_list,
+                            const std::vector<PosListsByChunk>& input_pos_lists);
+
+// Appends a chunk of empty value segments to the table. As all tables hold at least one chunk, operators use this if
+// their result is empty.
+void append_empty_chunk(Table& table);
+
+}  // namespace opossum
@@ -0,0 +1,371 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <string_view>
+
+#include "reference_output.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_values.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/parallel_merge.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// The first byte of each column's key distinguishes NULLs from other values.
+constexpr auto NULL_FIRST_BYTE = uint8_t{0};
+constexpr auto NOT_NULL_BYTE = uint8_t{1};
+constexpr auto NULL_LAST_BYTE = uint8_t{2};
+
+template <typename U>
+void store_big_endian(const U value, uint8_t* const out) {
+  for (auto byte_index = size_t{0}; byte_index < sizeof(U); ++byte_index) {
+    out[byte_index] = static_cast<uint8_t>(value >> (8 * (sizeof(U) - 1 - byte_index)));
+  }
+}
+
+// Writes the number so that the bytes compare like the numbers. For signed integers, flipping the sign bit turns the
+// two's complement into an ascending unsigned order. Negative floating-point numbers are ordered inversely by their
+// bits, so all their bits are flipped, while positive ones only get the sign bit set.
+template <typename T>
+void encode_number(const T value, uint8_t* const out) {
+  if constexpr (std::is_integral_v<T>) {
+    using Unsigned = std::make_unsigned_t<T>;
+    constexpr auto SIGN_BIT = Unsigned{1} << (sizeof(T) * 8 - 1);
+    store_big_endian(static_cast<Unsigned>(static_cast<Unsigned>(value) ^ SIGN_BIT), out);
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = Bits{1} << (sizeof(T) * 8 - 1);
+    // -0.0 and 0.0 compare equal, so they have to be encoded equally.
+    const auto bits = std::bit_cast<Bits>(value == T{0} ? T{0} : value);
+    store_big_endian(static_cast<Bits>((bits & SIGN_BIT) ? ~bits : (bits | SIGN_BIT)), out);
+  }
+}
+
+// Writes the keys of one sort column, i.e., a NULL byte followed by the encoded value.
+class BaseColumnKeyEncoder {
+ public:
+  virtual ~BaseColumnKeyEncoder() = default;
+
+  // Returns the number of bytes of the column's keys.
+  virtual size_t key_width() const = 0;
+
+  // Prepares the encoding of the table's values. Needs to be called before encode().
+  virtual void prepare(const Table& table, const size_t max_parallelism) = 0;
+
+  // Writes the key of each row of the segment to keys + chunk_offset * row_key_width. May be called concurrently.
+  virtual void encode(const AbstractSegment& segment, uint8_t* const keys, const size_t row_key_width) const = 0;
+};
+
+template <typename T>
+class ColumnKeyEncoder final : public BaseColumnKeyEncoder {
+ public:
+  // Strings are encoded as their rank among the column's distinct strings.
+  static constexpr auto VALUE_WIDTH = std::is_same_v<T, std::string> ? sizeof(uint32_t) : sizeof(T);
+
+  explicit ColumnKeyEncoder(const SortColumnDefinition& sort_definition)
+      : _column_id{sort_definition.column_id},
+        _descending{sort_definition.sort_mode == SortMode::Descending},
+        _null_byte{sort_definition.nulls_position == NullsPosition::First ? NULL_FIRST_BYTE : NULL_LAST_BYTE} {}
+
+  size_t key_width() const final {
+    return 1 + VALUE_WIDTH;
+  }
+
+  void prepare(const Table& table, const size_t max_parallelism) final {
+    if constexpr (std::is_same_v<T, std::string>) {
+      // Collect the sorted distinct strings of each chunk (dictionaries are sorted and distinct already) and merge
+      // them. The strings are referenced, as the segments outlive the sort.
+      const auto chunk_count = table.chunk_count();
+      auto chunk_strings = std::vector<std::vector<std::string_view>>(chunk_count);
+      parallel_for(chunk_count, max_parallelism, [&](const size_t chunk_index) {
+        const auto segment = table.get_chunk(static_cast<ChunkID>(chunk_index))->get_segment(_column_id);
+        auto& strings = chunk_strings[chunk_index];
+        if (const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(segment.get())) {
+          const auto& dictionary = dictionary_segment->dictionary();
+          strings.assign(dictionary.cbegin(), dictionary.cend());
+          return;
+        }
+
+        for_each_segment_value<T>(
+            *segment, [&](const ChunkOffset /*chunk_offset*/, const T& value) { strings.emplace_back(value); },
+            [](const ChunkOffset /*chunk_offset*/) {});
+        std::sort(strings.begin(), strings.end());
+        strings.erase(std::unique(strings.begin(), strings.end()), strings.end());
+      });
+
+      auto run_offsets = std::vector<size_t>{0};
+      for (const auto& strings : chunk_strings) {
+        _strings.insert(_strings.end(), strings.cbegin(), strings.cend());
+        run_offsets.push_back(_strings.size());
+      }
+      parallel_merge_runs(_strings, std::move(run_offsets), std::less<std::string_view>{}, max_parallelism);
+      _strings.erase(std::unique(_strings.begin(), _strings.end()), _strings.end());
+    }
+  }
+
+  void encode(const AbstractSegment& segment, uint8_t* const keys, const size_t row_key_width) const final {
+    // Each dictionary entry (and NULL, at the NULL value id) is encoded once, and the keys are copied by value id.
+    if (const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(&segment)) {
+      const auto& dictionary = dictionary_segment->dictionary();
+      auto encoded_dictionary = std::vector<uint8_t>((dictionary.size() + 1) * (1 + VALUE_WIDTH));
+      for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+        _encode_value(dictionary[value_id], &encoded_dictionary[value_id * (1 + VALUE_WIDTH)]);
+      }
+      _encode_null(&encoded_dictionary[dictionary.size() * (1 + VALUE_WIDTH)]);
+
+      resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        const auto& value_ids = attribute_vector.values();
+        for (auto chunk_offset = size_t{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+          const auto* const encoded_value = &encoded_dictionary[value_ids[chunk_offset] * (1 + VALUE_WIDTH)];
+          std::memcpy(keys + chunk_offset * row_key_width, encoded_value, 1 + VALUE_WIDTH);
+        }
+      });
+      return;
+    }
+
+    for_each_segment_value<T>(
+        segment,
+        [&](const ChunkOffset chunk_offset, const T& value) {
+          _encode_value(value, keys + chunk_offset * row_key_width);
+        },
+        [&](const ChunkOffset chunk_offset) { _encode_null(keys + chunk_offset * row_key_width); });
+  }
+
+ protected:
+  void _encode_value(const T& value, uint8_t* const key) const {
+    key[0] = NOT_NULL_BYTE;
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto rank_it = std::lower_bound(_strings.cbegin(), _strings.cend(), std::string_view{value});
+      store_big_endian(static_cast<uint32_t>(rank_it - _strings.cbegin()), key + 1);
+    } else {
+      encode_number(value, key + 1);
+    }
+
+    if (_descending) {
+      for (auto byte_index = size_t{1}; byte_index <= VALUE_WIDTH; ++byte_index) {
+        key[byte_index] = static_cast<uint8_t>(~key[byte_index]);
+      }
+    }
+  }
+
+  void _encode_null(uint8_t* const key) const {
+    key[0] = _null_byte;
+    std::memset(key + 1, 0, VALUE_WIDTH);
+  }
+
+  const ColumnID _column_id;
+  const bool _descending;
+  const uint8_t _null_byte;
+  // The sorted distinct strings of the column (only used for strings).
+  std::vector<std::string_view> _strings;
+};
+
+// Returns value segments with the values of the column at the given rows, split into chunks of output_chunk_size.
+template <typename T>
+std::vector<std::shared_ptr<AbstractSegment>> materialize_column(const Table& table, const ColumnID column_id,
+                                                                 const std::vector<size_t>& chunk_begins,
+                                                                 const std::vector<RowID>& rows,
+                                                                 const ChunkOffset output_chunk_size,
+                                                                 const size_t max_parallelism) {
+  // Materialize the column in input order first, so that the values can be gathered by row index.
+  const auto chunk_count = table.chunk_count();
+  auto values = std::vector<T>(rows.size());
+  auto null_values = std::vector<uint8_t>(rows.size());
+  parallel_for(chunk_count, max_parallelism, [&](const size_t chunk_index) {
+    const auto chunk_begin = chunk_begins[chunk_index];
+    for_each_segment_value<T>(
+        *table.get_chunk(static_cast<ChunkID>(chunk_index))->get_segment(column_id),
+        [&](const ChunkOffset chunk_offset, const T& value) { values[chunk_begin + chunk_offset] = value; },
+        [&](const ChunkOffset chunk_offset) { null_values[chunk_begin + chunk_offset] = true; });
+  });
+
+  const auto nullable = table.column_nullable(column_id);
+  const auto output_chunk_count = (rows.size() + output_chunk_size - 1) / output_chunk_size;
+  auto segments = std::vector<std::shared_ptr<AbstractSegment>>(output_chunk_count);
+  parallel_for(output_chunk_count, max_parallelism, [&](const size_t output_chunk_index) {
+    const auto begin = output_chunk_index * output_chunk_size;
+    const auto end = std::min(begin + output_chunk_size, rows.size());
+    auto segment_values = std::vector<T>(end - begin);
+    auto segment_null_values = std::vector<bool>(end - begin);
+    for (auto index = begin; index < end; ++index) {
+      const auto row_index = chunk_begins[rows[index].chunk_id] + rows[index].chunk_offset;
+      segment_values[index - begin] = values[row_index];
+      segment_null_values[index - begin] = null_values[row_index];
+    }
+
+    if (nullable) {
+      segments[output_chunk_index] =
+          std::make_shared<ValueSegment<T>>(std::move(segment_values), std::move(segment_null_values));
+    } else {
+      segments[output_chunk_index] = std::make_shared<ValueSegment<T>>(std::move(segment_values));
+    }
+  });
+  return segments;
+}
+
+}  // namespace
+
+namespace opossum {
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const ChunkOffset output_chunk_size, const OutputMode output_mode)
+    : AbstractOperator{in},
+      _sort_definitions{sort_definitions},
+      _output_chunk_size{output_chunk_size},
+      _output_mode{output_mode} {
+  Assert(output_chunk_size > 0, "Output chunks must hold at least one row.");
+}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const {
+  return _sort_definitions;
+}
+
+ChunkOffset Sort::output_chunk_size() const {
+  return _output_chunk_size;
+}
+
+Sort::OutputMode Sort::output_mode() const {
+  return _output_mode;
+}
+
+std::optional<std::string> Sort::description() const {
+  auto description = std::string{"Sort"};
+  for (const auto& sort_definition : _sort_definitions) {
+    description += " " + std::to_string(sort_definition.column_id) + ":" +
+                   std::to_string(static_cast<int>(sort_definition.sort_mode)) + ":" +
+                   std::to_string(static_cast<int>(sort_definition.nulls_position));
+  }
+  return description + " " + std::to_string(_output_chunk_size) + " " + std::to_string(static_cast<int>(_output_mode));
+}
+
+std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  return std::make_shared<Sort>(copied_left_input, _sort_definitions, _output_chunk_size, _output_mode);
+}
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(input_table, "Sort requires an input.");
+
+  auto timer = Timer{};
+  auto encoders = std::vector<std::unique_ptr<BaseColumnKeyEncoder>>{};
+  auto key_offsets = std::vector<size_t>{};
+  auto key_width = size_t{0};
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column_id < input_table->column_count(), "Sort column does not exist.");
+    resolve_data_type(input_table->column_data_type(sort_definition.column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      encoders.push_back(std::make_unique<ColumnKeyEncoder<Type>>(sort_definition));
+    });
+    encoders.back()->prepare(*input_table, _max_parallelism);
+    key_offsets.push_back(key_width);
+    key_width += encoders.back()->key_width();
+  }
+
+  // chunk_begins[i] is the index of the first row of chunk i, if the rows of all chunks are counted consecutively.
+  const auto chunk_count = input_table->chunk_count();
+  auto chunk_begins = std::vector<size_t>{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_begins.push_back(chunk_begins.back() + input_table->get_chunk(chunk_id)->size());
+  }
+  const auto row_count = chunk_begins.back();
+  _performance_data.add_phase("Preparation", timer.lap());
+
+  // Rows with equal keys are ordered by their RowIDs, which keeps them in input order.
+  auto keys = std::vector<uint8_t>(row_count * key_width);
+  const auto row_less = [&](const RowID& lhs, const RowID& rhs) {
+    const auto* lhs_key = keys.data() + (chunk_begins[lhs.chunk_id] + lhs.chunk_offset) * key_width;
+    const auto* rhs_key = keys.data() + (chunk_begins[rhs.chunk_id] + rhs.chunk_offset) * key_width;
+    const auto comparison = std::memcmp(lhs_key, rhs_key, key_width);
+    return comparison < 0 || (comparison == 0 && lhs < rhs);
+  };
+
+  // Encode and sort each chunk. Chunks that are sorted already are not sorted again.
+  auto rows = std::vector<RowID>(row_count);
+  parallel_for(chunk_count, _max_parallelism, [&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    const auto chunk = input_table->get_chunk(chunk_id);
+    auto* const chunk_keys = keys.data() + chunk_begins[chunk_id] * key_width;
+    for (auto encoder_index = size_t{0}; encoder_index < encoders.size(); ++encoder_index) {
+      encoders[encoder_index]->encode(*chunk->get_segment(_sort_definitions[encoder_index].column_id),
+                                      chunk_keys + key_offsets[encoder_index], key_width);
+    }
+
+    const auto chunk_rows_begin = rows.begin() + chunk_begins[chunk_id];
+    const auto chunk_rows_end = rows.begin() + chunk_begins[chunk_id + 1];
+    for (auto row_it = chunk_rows_begin; row_it != chunk_rows_end; ++row_it) {
+      *row_it = RowID{chunk_id, static_cast<ChunkOffset>(row_it - chunk_rows_begin)};
+    }
+    if (!std::is_sorted(chunk_rows_begin, chunk_rows_end, row_less)) {
+      std::sort(chunk_rows_begin, chunk_rows_end, row_less);
+    }
+  });
+  _performance_data.add_phase("Sort", timer.lap());
+
+  // Merge the sorted chunks, unless they are in order already.
+  auto chunks_are_ordered = true;
+  for (auto chunk_id = ChunkID{1}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk_begin = chunk_begins[chunk_id];
+    if (chunk_begin > 0 && chunk_begin < row_count && row_less(rows[chunk_begin], rows[chunk_begin - 1])) {
+      chunks_are_ordered = false;
+      break;
+    }
+  }
+  if (!chunks_are_ordered) {
+    parallel_merge_runs(rows, chunk_begins, row_less, _max_parallelism);
+  }
+  keys = {};
+  _performance_data.add_phase("Merge", timer.lap());
+
+  // Create the output table.
+  auto output_table = std::make_shared<Table>(_output_chunk_size);
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_nullable(column_id));
+  }
+
+  const auto output_chunk_count = (row_count + _output_chunk_size - 1) / _output_chunk_size;
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(output_chunk_count);
+  if (_output_mode == OutputMode::ReferenceSegments) {
+    const auto input_pos_lists = pos_lists_by_column(*input_table);
+    parallel_for(output_chunk_count, _max_parallelism, [&](const size_t output_chunk_index) {
+      const auto rows_begin = rows.cbegin() + output_chunk_index * _output_chunk_size;
+      const auto rows_end = rows.cbegin() + std::min((output_chunk_index + 1) * _output_chunk_size, row_count);
+      auto chunk = std::make_shared<Chunk>();
+      add_reference_segments(*chunk, input_table, std::make_shared<PosList>(rows_begin, rows_end), input_pos_lists);
+      output_chunks[output_chunk_index] = chunk;
+    });
+  } else {
+    for (auto& chunk : output_chunks) {
+      chunk = std::make_shared<Chunk>();
+    }
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+        using Type = typename decltype(type)::type;
+        const auto segments = materialize_column<Type>(*input_table, column_id, chunk_begins, rows,
+                                                       _output_chunk_size, _max_parallelism);
+        for (auto output_chunk_index = size_t{0}; output_chunk_index < output_chunk_count; ++output_chunk_index) {
+          output_chunks[output_chunk_index]->add_segment(segments[output_chunk_index]);
+        }
+      });
+    }
+  }
+
+  for (const auto& chunk : output_chunks) {
+    output_table->append_chunk(chunk);
+  }
+  if (output_chunks.empty()) {
+    append_empty_chunk(*output_table);
+  }
+  _performance_data.add_phase("Output", timer.lap());
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// A column to sort by. By default, values are sorted ascending, with NULLs first.
+struct SortColumnDefinition {
+  ColumnID column_id;
+  SortMode sort_mode = SortMode::Ascending;
+  NullsPosition nulls_position = NullsPosition::First;
+};
+
+// Sorts the rows of the input by one or more columns. Rows that are equal in all sort columns keep their input order.
+//
+// The sort columns of each row are encoded into a fixed-width binary key that compares like the row when compared
+// with memcmp: integers and floating-point numbers are stored big-endian with flipped sign bits, descending columns are
+// inverted, and NULLs are encoded in a separate byte per column. Strings are replaced with their rank among all
+// distinct strings of the column. For dictionary segments, each dictionary entry is encoded (or ranked) once and the
+// value ids are mapped to the encoded entries, so no value is decompressed. The chunks are sorted in parallel and
+// merged pairwise in parallel rounds.
+//
+// The output consists of chunks of output_chunk_size rows each, which either reference the input rows or hold the
+// values in value segments.
+class Sort : public AbstractOperator {
+ public:
+  enum class OutputMode { ReferenceSegments, ValueSegments };
+
+  static constexpr auto DEFAULT_OUTPUT_CHUNK_SIZE = ChunkOffset{65'535};
+
+  Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const ChunkOffset output_chunk_size = DEFAULT_OUTPUT_CHUNK_SIZE,
+       const OutputMode output_mode = OutputMode::ReferenceSegments);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+  ChunkOffset output_chunk_size() const;
+
+  OutputMode output_mode() const;
+
+  std::optional<std::string> description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const ChunkOffset _output_chunk_size;
+  const OutputMode _output_mode;
+};
+
+}  // namespace opossum
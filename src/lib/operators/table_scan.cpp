@@ -1,10 +1,40 @@
 #include "table_scan.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <optional>
+
 #include "get_table.hpp"
+#include "pipeline.hpp"
+#include "reference_output.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_attribute_vector.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
 #include "types.hpp"
+#include "utils/like_matcher.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Evaluates the pattern once per dictionary entry instead of once per row, so that rows can be looked up by their
+// value id. The additional entry for the NULL value id never matches.
+std::vector<bool> like_value_id_matches(const DictionarySegment<std::string>& segment, const LikeMatcher& matcher,
+                                        const bool is_negated) {
+  const auto& dictionary = segment.dictionary();
+  const auto dictionary_size = dictionary.size();
+  auto value_id_matches = std::vector<bool>(dictionary_size + 1, false);
+  for (auto value_id = size_t{0}; value_id < dictionary_size; ++value_id) {
+    value_id_matches[value_id] = matcher.matches(dictionary[value_id]) != is_negated;
+  }
+  return value_id_matches;
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -12,6 +42,12 @@ TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const Co
                      const ScanType scan_type, const AllTypeVariant search_value)
     : AbstractOperator{in}, _column_id{column_id}, _scan_type{scan_type}, _search_value{search_value} {}
 
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                     const ScanType scan_type, const ParameterID parameter_id)
+    : TableScan{in, column_id, scan_type, NULL_VALUE} {
+  _parameter_id = parameter_id;
+}
+
 ColumnID TableScan::column_id() const {
   return _column_id;
 }
@@ -24,181 +60,577 @@ const AllTypeVariant& TableScan::search_value() const {
   return _search_value;
 }
 
+std::optional<ParameterID> TableScan::parameter_id() const {
+  return _parameter_id;
+}
+
+std::unique_ptr<AbstractPipelineStage> TableScan::create_pipeline_stage() const {
+  Assert(!_parameter_id, "The search value of the TableScan is not bound.");
+  return std::make_unique<TableScanStage>(_column_id, _scan_type, _search_value);
+}
+
+std::optional<std::string> TableScan::description() const {
+  if (_parameter_id) {
+    return std::nullopt;
+  }
+  return "TableScan " + std::to_string(_column_id) + " " + std::to_string(static_cast<int>(_scan_type)) + " " +
+         _describe_value(_search_value);
+}
+
+std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  const auto copy = std::make_shared<TableScan>(copied_left_input, _column_id, _scan_type, _search_value);
+  copy->_parameter_id = _parameter_id;
+  return copy;
+}
+
 std::shared_ptr<const Table> TableScan::_on_execute() {
   const auto input_table = _left_input_table();
-
-  Assert(input_table, "Performing a table scan without input does not work.");
+  _assert_scannable(input_table);
   const auto chunk_count = input_table->chunk_count();
-  const auto column_type = input_table->column_type(_column_id);
-  auto output_reference_segments = std::vector<std::shared_ptr<ReferenceSegment>>{};
 
-  // any comparison with null will always return an empty set
-  if (variant_is_null(_search_value)) {
-    return std::make_shared<Table>(*input_table, output_reference_segments);
+  // Any comparison with NULL will always return an empty set.
+  if (variant_is_null(_search_value) && !_is_null_scan()) {
+    return _create_output_table(input_table, {});
   }
 
-  // We might end up using far less segments, but still should be worth to reserve the space for worst case.
-  output_reference_segments.reserve(chunk_count);
+  // Chunks are grouped into morsels of at least MORSEL_ROW_COUNT rows, which are scanned in parallel. Each chunk's
+  // result is stored at the chunk's index so that the output is assembled in chunk order, independent of which thread
+  // scanned which chunk.
+  auto chunk_results = std::vector<std::shared_ptr<const AbstractPosList>>(chunk_count);
+  auto morsel_begins = std::vector<ChunkID>{};
+  auto morsel_row_count = uint64_t{MORSEL_ROW_COUNT};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (morsel_row_count >= MORSEL_ROW_COUNT) {
+      morsel_begins.push_back(chunk_id);
+      morsel_row_count = 0;
+    }
+    morsel_row_count += input_table->get_chunk(chunk_id)->size();
+  }
 
-  resolve_data_type(column_type, [&](auto type) {
+  resolve_data_type(input_table->column_data_type(_column_id), [&](auto type) {
     using Type = typename decltype(type)::type;
 
-    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-      const auto chunk = input_table->get_chunk(chunk_id);
-      // if chunk is empty, skip this chunk
-      if (!chunk->size()) {
-        continue;
+    // With a row budget, a chunk is skipped once the chunks before it have produced enough rows. As all chunks before
+    // the first skipped one are scanned, the first rows of the output are the same as without the budget. Only the
+    // longest prefix of scanned chunks is counted, so that no lock is needed to check the budget.
+    auto budget_mutex = std::mutex{};
+    auto scanned_chunks = std::vector<bool>(_row_budget ? chunk_count : 0);
+    auto scanned_prefix_end = ChunkID{0};
+    auto scanned_prefix_row_count = std::atomic<uint64_t>{0};
+    const auto add_scanned_chunk = [&](const ChunkID chunk_id) {
+      const auto lock = std::lock_guard<std::mutex>{budget_mutex};
+      scanned_chunks[chunk_id] = true;
+      while (scanned_prefix_end < chunk_count && scanned_chunks[scanned_prefix_end]) {
+        const auto& chunk_result = chunk_results[scanned_prefix_end];
+        scanned_prefix_row_count += chunk_result ? chunk_result->size() : 0;
+        ++scanned_prefix_end;
+      }
+    };
+
+    const auto morsel_count = morsel_begins.size();
+    parallel_for(morsel_count, _max_parallelism, [&](const size_t morsel_id) {
+      const auto morsel_end = morsel_id + 1 < morsel_count ? morsel_begins[morsel_id + 1] : chunk_count;
+      for (auto chunk_id = morsel_begins[morsel_id]; chunk_id < morsel_end; ++chunk_id) {
+        if (!_row_budget) {
+          chunk_results[chunk_id] = _scan_chunk<Type>(input_table, chunk_id);
+          continue;
+        }
+
+        if (scanned_prefix_row_count >= *_row_budget) {
+          return;
+        }
+        chunk_results[chunk_id] = _scan_chunk<Type>(input_table, chunk_id);
+        add_scanned_chunk(chunk_id);
       }
+    });
 
-      auto position_list = std::make_shared<PosList>();
-      const auto segment = chunk->get_segment(_column_id);
+    if (_row_budget) {
+      _performance_data.pruned_chunk_count = std::count(scanned_chunks.cbegin(), scanned_chunks.cend(), false);
+    }
+  });
 
-      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<Type>>(segment);
-      const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<Type>>(segment);
-      const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment);
+  return _create_output_table(input_table, chunk_results);
+}
 
-      Assert(value_segment || dictionary_segment || reference_segment,
-             "TableScan was called on unsupported segment type");
+AsyncTask<std::shared_ptr<const Table>> TableScan::_on_execute_async(const CancellationToken token) {
+  const auto input_table = _left_input_table();
+  _assert_scannable(input_table);
+  const auto chunk_count = input_table->chunk_count();
+  auto chunk_results = std::vector<std::shared_ptr<const AbstractPosList>>{};
 
-      if (value_segment) {
-        position_list = _tablescan_value_segment<Type>(value_segment, chunk_id);
-      } else if (dictionary_segment) {
-        position_list = _tablescan_dict_segment<Type>(dictionary_segment, chunk_id);
-      } else if (reference_segment) {
-        position_list = _tablescan_reference_segment<Type>(reference_segment, chunk_id);
-      }
+  // Any comparison with NULL will always return an empty set.
+  if (variant_is_null(_search_value) && !_is_null_scan()) {
+    co_return _create_output_table(input_table, {});
+  }
 
-      if (!position_list->empty()) {
-        // Only keep non empty segments and change referred table, if we scanned a ReferenceSegment.
-        output_reference_segments.push_back(std::make_shared<ReferenceSegment>(
-            (reference_segment) ? reference_segment->referenced_table() : input_table, _column_id, position_list));
-      }
+  // The chunks are scanned one after another on the current worker, which gives way to other tasks after each chunk.
+  // Thus, concurrent queries share the workers instead of each one occupying all of them.
+  auto row_count = uint64_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (_row_budget && row_count >= *_row_budget) {
+      _performance_data.pruned_chunk_count = chunk_count - chunk_id;
+      break;
     }
-  });
 
-  return std::make_shared<Table>(*input_table, output_reference_segments);
+    if (chunk_id > 0) {
+      co_await yield_to_scheduler(token);
+    }
+    _worker_thread_recorder->record_current_thread();
+
+    auto chunk_result = std::shared_ptr<const AbstractPosList>{};
+    resolve_data_type(input_table->column_data_type(_column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      chunk_result = _scan_chunk<Type>(input_table, chunk_id);
+    });
+
+    if (chunk_result) {
+      row_count += chunk_result->size();
+      chunk_results.push_back(std::move(chunk_result));
+    }
+  }
+
+  co_return _create_output_table(input_table, chunk_results);
+}
+
+void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  if (!_parameter_id) {
+    return;
+  }
+
+  const auto iter = parameters.find(*_parameter_id);
+  if (iter != parameters.end()) {
+    _search_value = iter->second;
+    _parameter_id.reset();
+  }
+}
+
+void TableScan::_assert_scannable(const std::shared_ptr<const Table>& input_table) const {
+  Assert(input_table, "Performing a table scan without input does not work.");
+  Assert(!_parameter_id, "The search value of the TableScan is not bound.");
+  Assert((_scan_type != ScanType::OpLike && _scan_type != ScanType::OpNotLike) ||
+             input_table->column_data_type(_column_id) == DataType::String,
+         "LIKE scans are only supported on string columns.");
+}
+
+std::shared_ptr<const Table> TableScan::_create_output_table(
+    const std::shared_ptr<const Table>& input_table,
+    const std::vector<std::shared_ptr<const AbstractPosList>>& chunk_results) const {
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size());
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_nullable(column_id));
+  }
+
+  // The columns of reference tables may reference different tables with different position lists (e.g., the output of
+  // a join), so the matching rows are resolved per column.
+  const auto input_pos_lists = pos_lists_by_column(*input_table);
+  for (const auto& chunk_result : chunk_results) {
+    if (chunk_result) {
+      auto output_chunk = std::make_shared<Chunk>();
+      add_reference_segments(*output_chunk, input_table, chunk_result, input_pos_lists);
+      output_table->append_chunk(output_chunk);
+    }
+  }
+
+  if (!output_table->row_count()) {
+    append_empty_chunk(*output_table);
+  }
+  return output_table;
 }
 
 template <typename T>
-std::shared_ptr<PosList> TableScan::_tablescan_dict_segment(std::shared_ptr<DictionarySegment<T>> segment,
-                                                            ChunkID chunk_id) {
-  auto position_list = std::make_shared<PosList>();
-  const auto search_val = type_cast<T>(_search_value);
+std::shared_ptr<const AbstractPosList> TableScan::_scan_chunk(const std::shared_ptr<const Table>& input_table,
+                                                              const ChunkID chunk_id) {
+  const auto chunk = input_table->get_chunk(chunk_id);
+  // if chunk is empty, skip this chunk
+  if (!chunk->size()) {
+    return nullptr;
+  }
+
+  // The positions reference the rows of the input chunk, also if the input is a reference table.
+  auto position_list = std::shared_ptr<const AbstractPosList>{};
+  const auto segment = chunk->get_segment(_column_id);
+  switch (segment->encoding()) {
+    case SegmentEncoding::Unencoded:
+      position_list = _tablescan_value_segment<T>(std::static_pointer_cast<ValueSegment<T>>(segment), chunk_id);
+      break;
+    case SegmentEncoding::Dictionary:
+      position_list = _tablescan_dict_segment<T>(std::static_pointer_cast<DictionarySegment<T>>(segment), chunk_id);
+      break;
+    case SegmentEncoding::Reference:
+      position_list =
+          _tablescan_reference_segment<T>(std::static_pointer_cast<ReferenceSegment>(segment), chunk_id);
+      break;
+  }
+
+  // Only keep non empty results.
+  if (position_list->empty()) {
+    return nullptr;
+  }
+  return position_list;
+}
 
-  // Not comparing the individual types anymore, only indexes now.
-  auto scan_op = _create_scan_operation<ValueID>();
+template <typename T>
+std::optional<TableScan::ValueIDRange> TableScan::_matching_value_id_range(const DictionarySegment<T>& segment) const {
+  const auto null_value_id = segment.null_value_id();
+
+  // lower_bound and upper_bound return INVALID_VALUE_ID if all values are smaller than the search value. In this case,
+  // the range ends at the last dictionary entry.
+  const auto bound_or_end = [null_value_id](const ValueID value_id) {
+    return value_id == INVALID_VALUE_ID ? null_value_id : value_id;
+  };
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (_scan_type == ScanType::OpLike || _scan_type == ScanType::OpNotLike) {
+      // Prefix patterns match a contiguous range, as the dictionary is sorted. All other patterns need to be evaluated
+      // per dictionary entry.
+      const auto prefix = LikeMatcher{type_cast<std::string>(_search_value)}.prefix();
+      if (!prefix) {
+        return std::nullopt;
+      }
 
-  const auto lower_bound = segment->lower_bound(search_val);
-  const auto upper_bound = segment->upper_bound(search_val);
+      const auto next_prefix = LikeMatcher::next_prefix(*prefix);
+      return ValueIDRange{bound_or_end(segment.lower_bound(*prefix)),
+                          next_prefix ? bound_or_end(segment.lower_bound(*next_prefix)) : null_value_id,
+                          _scan_type == ScanType::OpNotLike};
+    }
+  }
+
+  if (_is_null_scan()) {
+    return std::nullopt;
+  }
+
+  /**
+   * Upper Bound is exclusive ==> [minElement, upperBound)
+   * Lower Bound is inclusive ==> [lowerBound, maxElement]
+   *
+   * Therefore, if they match, there is no matching element with the search value.
+   */
+  const auto search_val = type_cast<T>(_search_value);
+  const auto lower_bound = bound_or_end(segment.lower_bound(search_val));
+  const auto upper_bound = bound_or_end(segment.upper_bound(search_val));
 
   switch (_scan_type) {
-    /**
-     * Upper Bound is exclusive ==> [minElement, upperBound)
-     * Lower Bound is inclusive ==> [lowerBound, maxElement]
-     *
-     * Therefore, if they match, there is no matching element with the search value.
-     * As we are gonna compare with the valueID and not the actual value, some other
-     * operators also need to be overwritten, to work accordingly.
-     */
     case ScanType::OpEquals:
-      if (lower_bound == upper_bound) {
-        return position_list;
-      }
-      break;
+      return ValueIDRange{lower_bound, upper_bound, false};
     case ScanType::OpNotEquals:
-      if (lower_bound == upper_bound)
-        scan_op = [](auto l, auto r) { return true; };
-      break;
+      return ValueIDRange{lower_bound, upper_bound, true};
+    case ScanType::OpLessThan:
+      return ValueIDRange{ValueID{0}, lower_bound, false};
     case ScanType::OpLessThanEquals:
-      scan_op = [&](auto l, auto r) { return l < upper_bound; };
-      break;
+      return ValueIDRange{ValueID{0}, upper_bound, false};
     case ScanType::OpGreaterThan:
-      scan_op = [&](auto l, auto r) { return l >= upper_bound; };
-      break;
-      // Rest stays as it is.
+      return ValueIDRange{upper_bound, null_value_id, false};
+    case ScanType::OpGreaterThanEquals:
+      return ValueIDRange{lower_bound, null_value_id, false};
     default:
-      break;
+      Fail("Scan Operation not available.");
   }
+}
 
-  const auto attr_vector = segment->attribute_vector();
-  for (auto index = ChunkOffset{0}; index < segment->size(); ++index) {
-    const auto value_id = attr_vector->get(index);
-    if (value_id != segment->null_value_id() && scan_op(value_id, lower_bound)) {
-      position_list->push_back(RowID{chunk_id, index});
+template <typename T>
+std::shared_ptr<const AbstractPosList> TableScan::_tablescan_dict_segment(
+    std::shared_ptr<DictionarySegment<T>> segment, ChunkID chunk_id) {
+  if (_is_null_scan()) {
+    return _tablescan_dict_segment_null(segment, chunk_id);
+  }
+
+  // Not comparing the individual values, only value ids.
+  const auto range = _matching_value_id_range(*segment);
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (!range) {
+      return _tablescan_dict_segment_like(segment, chunk_id);
     }
   }
 
-  return position_list;
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  const auto null_value_id = segment->null_value_id();
+  const auto segment_size = segment->size();
+
+  resolve_attribute_vector(*segment->attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.values();
+    for (auto index = ChunkOffset{0}; index < segment_size; ++index) {
+      const auto value_id = ValueID{value_ids[index]};
+      if (value_id != null_value_id && range->matches(value_id)) {
+        chunk_offsets.push_back(index);
+      }
+    }
+  });
+
+  return make_single_chunk_pos_list(chunk_id, std::move(chunk_offsets), segment_size);
+}
+
+template <typename T>
+std::shared_ptr<const AbstractPosList> TableScan::_tablescan_dict_segment_null(
+    std::shared_ptr<DictionarySegment<T>> segment, ChunkID chunk_id) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  const auto searches_nulls = _scan_type == ScanType::OpIsNull;
+  const auto null_value_id = segment->null_value_id();
+  const auto segment_size = segment->size();
+
+  resolve_attribute_vector(*segment->attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.values();
+    for (auto index = ChunkOffset{0}; index < segment_size; ++index) {
+      if ((value_ids[index] == null_value_id) == searches_nulls) {
+        chunk_offsets.push_back(index);
+      }
+    }
+  });
+
+  return make_single_chunk_pos_list(chunk_id, std::move(chunk_offsets), segment_size);
+}
+
+std::shared_ptr<const AbstractPosList> TableScan::_tablescan_dict_segment_like(
+    std::shared_ptr<DictionarySegment<std::string>> segment, ChunkID chunk_id) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  const auto segment_size = segment->size();
+  const auto value_id_matches = like_value_id_matches(*segment, LikeMatcher{type_cast<std::string>(_search_value)},
+                                                      _scan_type == ScanType::OpNotLike);
+
+  resolve_attribute_vector(*segment->attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.values();
+    for (auto index = ChunkOffset{0}; index < segment_size; ++index) {
+      if (value_id_matches[value_ids[index]]) {
+        chunk_offsets.push_back(index);
+      }
+    }
+  });
+
+  return make_single_chunk_pos_list(chunk_id, std::move(chunk_offsets), segment_size);
 }
 
 template <typename T>
-std::shared_ptr<PosList> TableScan::_tablescan_value_segment(std::shared_ptr<ValueSegment<T>> segment,
-                                                             ChunkID chunk_id) {
+std::shared_ptr<const AbstractPosList> TableScan::_tablescan_value_segment(std::shared_ptr<ValueSegment<T>> segment,
+                                                                           ChunkID chunk_id) {
+  if (_is_null_scan()) {
+    return _tablescan_value_segment_null(segment, chunk_id);
+  }
+
   const auto scan_op = _create_scan_operation<T>();
-  const auto values = segment->values();
+  const auto& values = segment->values();
 
-  auto position_list = std::make_shared<PosList>();
+  auto chunk_offsets = std::vector<ChunkOffset>{};
   const auto search_val = type_cast<T>(_search_value);
 
   auto index = ChunkOffset{0};
   for (const auto& value : values) {
     if (!segment->is_null(index) && scan_op(value, search_val)) {
-      position_list->push_back(RowID{chunk_id, index});
+      chunk_offsets.push_back(index);
     }
     ++index;
   }
 
-  return position_list;
+  return make_single_chunk_pos_list(chunk_id, std::move(chunk_offsets), segment->size());
 }
 
 template <typename T>
-std::shared_ptr<PosList> TableScan::_tablescan_reference_segment(std::shared_ptr<ReferenceSegment> segment,
-                                                                 ChunkID chunk_id) {
-  auto position_list = std::make_shared<PosList>();
+std::shared_ptr<const AbstractPosList> TableScan::_tablescan_value_segment_null(
+    std::shared_ptr<ValueSegment<T>> segment, ChunkID chunk_id) {
+  const auto searches_nulls = _scan_type == ScanType::OpIsNull;
+  const auto segment_size = segment->size();
 
-  const auto input_position_list = segment->pos_list();
-  const auto table = segment->referenced_table();
-  const auto search_val = type_cast<T>(search_value());
-  const auto scan_op = _create_scan_operation<T>();
+  const auto no_rows = [&]() { return std::make_shared<ChunkRangePosList>(chunk_id, 0, 0); };
+  const auto all_rows = [&]() { return std::make_shared<ChunkRangePosList>(chunk_id, 0, segment_size); };
 
-  for (auto index = ChunkOffset{0}; index < segment->size(); ++index) {
-    const auto row = (*input_position_list)[index];
-    const auto chunk = table->get_chunk(row.chunk_id);
-    const auto target_segment = chunk->get_segment(_column_id);
+  // Segments that are not nullable cannot contain NULLs, so we do not need to look at the values at all.
+  if (!segment->is_nullable()) {
+    return searches_nulls ? no_rows() : all_rows();
+  }
 
-    const auto dict_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(target_segment);
-    const auto val_segment = std::dynamic_pointer_cast<ValueSegment<T>>(target_segment);
+  // std::vector<bool> does not portably expose its underlying words. We thus count the NULLs first (which compilers
+  // vectorize well), answer segments that are either all NULL or free of NULLs without a second pass, and allocate
+  // the exact output size otherwise.
+  const auto& null_values = segment->null_values();
+  const auto null_count = static_cast<ChunkOffset>(std::count(null_values.cbegin(), null_values.cend(), true));
+  const auto match_count = searches_nulls ? null_count : segment_size - null_count;
+  if (match_count == 0) {
+    return no_rows();
+  }
+  if (match_count == segment_size) {
+    return all_rows();
+  }
 
-    Assert(dict_segment || val_segment, "Segment that ReferenceSegement references is not supported by TableScan.");
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  chunk_offsets.reserve(match_count);
+  for (auto index = ChunkOffset{0}; index < segment_size; ++index) {
+    if (null_values[index] == searches_nulls) {
+      chunk_offsets.push_back(index);
+    }
+  }
 
-    if (val_segment) {
-      // If value is null, it cannot appear in result set, so just continue.
-      if (val_segment->is_null(row.chunk_offset)) {
-        continue;
+  return make_single_chunk_pos_list(chunk_id, std::move(chunk_offsets), segment_size);
+}
+
+template <typename T>
+std::shared_ptr<const AbstractPosList> TableScan::_tablescan_reference_segment(
+    std::shared_ptr<ReferenceSegment> segment, ChunkID chunk_id) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+
+  const auto& input_position_list = *segment->pos_list();
+  const auto& table = segment->referenced_table();
+  const auto referenced_column_id = segment->referenced_column_id();
+
+  const auto is_null_scan = _is_null_scan();
+  const auto search_val = is_null_scan ? T{} : type_cast<T>(search_value());
+  const auto scan_op = is_null_scan ? std::function<bool(T, T)>{} : _create_scan_operation<T>();
+
+  // LIKE patterns other than prefixes do not match a range of value ids. For dictionary segments, they are evaluated
+  // once per dictionary entry of each referenced chunk (as in _tablescan_dict_segment_like) and not once per row.
+  auto like_matcher = std::optional<LikeMatcher>{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (_scan_type == ScanType::OpLike || _scan_type == ScanType::OpNotLike) {
+      like_matcher.emplace(type_cast<std::string>(_search_value));
+      if (like_matcher->prefix()) {
+        like_matcher.reset();
+      }
+    }
+  }
+  auto value_id_matches_by_chunk = std::vector<std::vector<bool>>(like_matcher ? table->chunk_count() : 0);
+
+  // Position lists usually consist of long runs of rows from the same chunk (e.g., the output of a previous scan holds
+  // rows of a single chunk only). We resolve the referenced segment once per run and process all rows of the run in a
+  // typed loop.
+  for_each_chunk_run(input_position_list, [&](const ChunkID referenced_chunk_id, const auto rows_begin,
+                                              const auto rows_end, const size_t first_index) {
+    const auto first_offset = static_cast<ChunkOffset>(first_index);
+    if (referenced_chunk_id == INVALID_CHUNK_ID) {
+      // NULL_ROW_IDs only match IS NULL scans.
+      if (_scan_type == ScanType::OpIsNull) {
+        const auto run_length = static_cast<ChunkOffset>(std::distance(rows_begin, rows_end));
+        for (auto offset = first_offset; offset < first_offset + run_length; ++offset) {
+          chunk_offsets.push_back(offset);
+        }
       }
-      const auto values = val_segment->values();
-      const auto casted_value = type_cast<T>(values[row.chunk_offset]);
+      return;
+    }
 
-      if (scan_op(casted_value, search_val)) {
-        position_list->emplace_back((*input_position_list)[index]);
+    const auto target_segment = table->get_chunk(referenced_chunk_id)->get_segment(referenced_column_id);
+
+    resolve_segment_type<T>(*target_segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+      if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+        _scan_value_segment_rows(typed_segment, rows_begin, rows_end, first_offset, scan_op, search_val,
+                                 chunk_offsets);
+      } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+        if constexpr (std::is_same_v<T, std::string>) {
+          if (like_matcher) {
+            auto& value_id_matches = value_id_matches_by_chunk[referenced_chunk_id];
+            if (value_id_matches.empty()) {
+              value_id_matches =
+                  like_value_id_matches(typed_segment, *like_matcher, _scan_type == ScanType::OpNotLike);
+            }
+            _scan_dict_segment_rows(typed_segment, rows_begin, rows_end, first_offset, value_id_matches,
+                                    chunk_offsets);
+            return;
+          }
+        }
+        _scan_dict_segment_rows(typed_segment, rows_begin, rows_end, first_offset, {}, chunk_offsets);
+      } else {
+        Fail("Segment that ReferenceSegment references is not supported by TableScan.");
       }
-    } else if (dict_segment) {
-      const auto& attribute_vector = dict_segment->attribute_vector();
-      const auto value_id = attribute_vector->get(row.chunk_offset);
-      // If value is null, it cannot appear in result set, so just continue.
-      if (value_id == dict_segment->null_value_id()) {
-        continue;
+    });
+  });
+
+  // The runs are visited in order, so the offsets are sorted.
+  return make_single_chunk_pos_list(chunk_id, std::move(chunk_offsets),
+                                    static_cast<ChunkOffset>(input_position_list.size()));
+}
+
+template <typename T, typename RowIterator>
+void TableScan::_scan_value_segment_rows(const ValueSegment<T>& segment, const RowIterator rows_begin,
+                                         const RowIterator rows_end, const ChunkOffset first_offset,
+                                         const std::function<bool(T, T)>& scan_op, const T& search_value,
+                                         std::vector<ChunkOffset>& chunk_offsets) const {
+  const auto& values = segment.values();
+  const auto is_nullable = segment.is_nullable();
+
+  if (_is_null_scan()) {
+    const auto searches_nulls = _scan_type == ScanType::OpIsNull;
+    auto offset = first_offset;
+    for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++offset) {
+      const auto row = RowID{*row_it};
+      if ((is_nullable && segment.null_values()[row.chunk_offset]) == searches_nulls) {
+        chunk_offsets.push_back(offset);
       }
-      const auto value = dict_segment->value_of_value_id(value_id);
-      const auto casted_value = type_cast<T>(value);
+    }
+    return;
+  }
 
-      if (scan_op(casted_value, search_val)) {
-        position_list->emplace_back((*input_position_list)[index]);
+  if (!is_nullable) {
+    auto offset = first_offset;
+    for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++offset) {
+      const auto row = RowID{*row_it};
+      if (scan_op(values[row.chunk_offset], search_value)) {
+        chunk_offsets.push_back(offset);
       }
     }
+    return;
   }
 
-  return position_list;
+  // If a value is NULL, it cannot appear in the result set.
+  const auto& null_values = segment.null_values();
+  auto offset = first_offset;
+  for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++offset) {
+    const auto row = RowID{*row_it};
+    if (!null_values[row.chunk_offset] && scan_op(values[row.chunk_offset], search_value)) {
+      chunk_offsets.push_back(offset);
+    }
+  }
+}
+
+template <typename T, typename RowIterator>
+void TableScan::_scan_dict_segment_rows(const DictionarySegment<T>& segment, const RowIterator rows_begin,
+                                        const RowIterator rows_end, const ChunkOffset first_offset,
+                                        const std::vector<bool>& value_id_matches,
+                                        std::vector<ChunkOffset>& chunk_offsets) const {
+  const auto null_value_id = segment.null_value_id();
+
+  resolve_attribute_vector(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    const auto& value_ids = attribute_vector.values();
+
+    if (_is_null_scan()) {
+      const auto searches_nulls = _scan_type == ScanType::OpIsNull;
+      auto offset = first_offset;
+      for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++offset) {
+        const auto row = RowID{*row_it};
+        if ((value_ids[row.chunk_offset] == null_value_id) == searches_nulls) {
+          chunk_offsets.push_back(offset);
+        }
+      }
+      return;
+    }
+
+    // Compare value ids instead of values wherever possible.
+    const auto range = _matching_value_id_range(segment);
+    if (range) {
+      auto offset = first_offset;
+      for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++offset) {
+        const auto row = RowID{*row_it};
+        const auto value_id = ValueID{value_ids[row.chunk_offset]};
+        if (value_id != null_value_id && range->matches(value_id)) {
+          chunk_offsets.push_back(offset);
+        }
+      }
+      return;
+    }
+
+    // All other scans are LIKE patterns, which the caller evaluated per value id.
+    DebugAssert(value_id_matches.size() == segment.dictionary().size() + 1, "LIKE pattern was not evaluated.");
+    auto offset = first_offset;
+    for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++offset) {
+      const auto row = RowID{*row_it};
+      if (value_id_matches[value_ids[row.chunk_offset]]) {
+        chunk_offsets.push_back(offset);
+      }
+    }
+  });
+}
+
+bool TableScan::_is_null_scan() const {
+  return _scan_type == ScanType::OpIsNull || _scan_type == ScanType::OpIsNotNull;
 }
 
 template <typename T>
@@ -222,6 +654,17 @@ std::function<bool(T, T)> TableScan::_create_scan_operation() const {
     case ScanType::OpGreaterThanEquals:
       return [](auto l, auto r) { return l >= r; };
 
+    case ScanType::OpLike:
+    case ScanType::OpNotLike:
+      if constexpr (std::is_same_v<T, std::string>) {
+        // The matcher is created once per scan operation. The search value passed to the operation is ignored.
+        const auto matcher = std::make_shared<LikeMatcher>(type_cast<std::string>(_search_value));
+        const auto is_negated = _scan_type == ScanType::OpNotLike;
+        return [matcher, is_negated](const auto& l, const auto& /*r*/) { return matcher->matches(l) != is_negated; };
+      } else {
+        Fail("LIKE scans are only supported on string columns.");
+      }
+
     default:
       Fail("Scan Operation not available.");
       break;
@@ -13,27 +13,111 @@ class TableScan : public AbstractOperator {
   TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const ScanType scan_type,
             const AllTypeVariant search_value);
 
+  // Creates a scan whose search value is a placeholder, which needs to be bound with set_parameters before the scan is
+  // executed.
+  TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const ScanType scan_type,
+            const ParameterID parameter_id);
+
   ColumnID column_id() const;
 
   ScanType scan_type() const;
 
   const AllTypeVariant& search_value() const;
 
+  // Returns the placeholder of the search value if it was not bound yet.
+  std::optional<ParameterID> parameter_id() const;
+
+  std::unique_ptr<AbstractPipelineStage> create_pipeline_stage() const override;
+
+  // Chunks are distributed to threads in groups (morsels) with at least this many rows, so that tables with many
+  // small chunks do not cause one thread hand-off per chunk.
+  static constexpr auto MORSEL_ROW_COUNT = ChunkOffset{16'384};
+
+  std::optional<std::string> description() const override;
+
  protected:
   template <typename T>
   std::function<bool(T, T)> _create_scan_operation() const;
 
   template <typename T>
-  std::shared_ptr<PosList> _tablescan_dict_segment(std::shared_ptr<DictionarySegment<T>> segment, ChunkID chunk_id);
+  std::shared_ptr<const AbstractPosList> _tablescan_dict_segment(std::shared_ptr<DictionarySegment<T>> segment,
+                                                                 ChunkID chunk_id);
+  std::shared_ptr<const AbstractPosList> _tablescan_dict_segment_like(
+      std::shared_ptr<DictionarySegment<std::string>> segment, ChunkID chunk_id);
   template <typename T>
-  std::shared_ptr<PosList> _tablescan_value_segment(std::shared_ptr<ValueSegment<T>> segment, ChunkID chunk_id);
+  std::shared_ptr<const AbstractPosList> _tablescan_dict_segment_null(std::shared_ptr<DictionarySegment<T>> segment,
+                                                                      ChunkID chunk_id);
+  template <typename T>
+  std::shared_ptr<const AbstractPosList> _tablescan_value_segment(std::shared_ptr<ValueSegment<T>> segment,
+                                                                  ChunkID chunk_id);
+  template <typename T>
+  std::shared_ptr<const AbstractPosList> _tablescan_value_segment_null(std::shared_ptr<ValueSegment<T>> segment,
+                                                                       ChunkID chunk_id);
+  template <typename T>
+  std::shared_ptr<const AbstractPosList> _tablescan_reference_segment(std::shared_ptr<ReferenceSegment> segment,
+                                                                      ChunkID chunk_id);
+
+  // Scan the rows [rows_begin, rows_end) of a position list, which all reference the given segment and start at
+  // first_offset of the scanned chunk, and add the chunk offsets of the matching ones. Scans on dictionary segments
+  // that cannot be expressed as a range of value ids (i.e., LIKE patterns other than prefixes) look up the rows in
+  // value_id_matches, which holds one entry per value id.
+  template <typename T, typename RowIterator>
+  void _scan_value_segment_rows(const ValueSegment<T>& segment, const RowIterator rows_begin,
+                                const RowIterator rows_end, const ChunkOffset first_offset,
+                                const std::function<bool(T, T)>& scan_op, const T& search_value,
+                                std::vector<ChunkOffset>& chunk_offsets) const;
+  template <typename T, typename RowIterator>
+  void _scan_dict_segment_rows(const DictionarySegment<T>& segment, const RowIterator rows_begin,
+                               const RowIterator rows_end, const ChunkOffset first_offset,
+                               const std::vector<bool>& value_id_matches,
+                               std::vector<ChunkOffset>& chunk_offsets) const;
+
+  // Value ids in [begin, end) match a scan on a dictionary segment. If negated is set, all non-NULL value ids outside
+  // of the range match instead.
+  struct ValueIDRange {
+    ValueID begin;
+    ValueID end;
+    bool negated;
+
+    bool matches(const ValueID value_id) const {
+      return (value_id >= begin && value_id < end) != negated;
+    }
+  };
+
+  // Returns the range of matching value ids, or std::nullopt if the scan cannot be expressed as a range (i.e., for
+  // IS [NOT] NULL and for LIKE patterns other than prefixes).
   template <typename T>
-  std::shared_ptr<PosList> _tablescan_reference_segment(std::shared_ptr<ReferenceSegment> segment, ChunkID chunk_id);
+  std::optional<ValueIDRange> _matching_value_id_range(const DictionarySegment<T>& segment) const;
+
+  // Returns whether the scan type is OpIsNull or OpIsNotNull.
+  bool _is_null_scan() const;
 
   std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  AsyncTask<std::shared_ptr<const Table>> _on_execute_async(const CancellationToken token) override;
+
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  void _assert_scannable(const std::shared_ptr<const Table>& input_table) const;
+
+  // Returns the matching rows of the chunk, or nullptr if there are none.
+  template <typename T>
+  std::shared_ptr<const AbstractPosList> _scan_chunk(const std::shared_ptr<const Table>& input_table,
+                                                     const ChunkID chunk_id);
+
+  // Creates the output with one chunk per non-empty result, which holds the matching rows of an input chunk.
+  std::shared_ptr<const Table> _create_output_table(
+      const std::shared_ptr<const Table>& input_table,
+      const std::vector<std::shared_ptr<const AbstractPosList>>& chunk_results) const;
+
   ColumnID _column_id;
   ScanType _scan_type;
   AllTypeVariant _search_value;
+  std::optional<ParameterID> _parameter_id;
 };
 
 }  // namespace opossum
@@ -1,9 +1,21 @@
 #include "table_wrapper.hpp"
 
+#include "storage/table.hpp"
+
 namespace opossum {
 
 TableWrapper::TableWrapper(const std::shared_ptr<const Table>& table) : _table(table) {}
 
+std::optional<std::string> TableWrapper::description() const {
+  return "TableWrapper " + std::to_string(_table->id()) + "." + std::to_string(_table->version());
+}
+
+std::shared_ptr<AbstractOperator> TableWrapper::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  return std::make_shared<TableWrapper>(_table);
+}
+
 std::shared_ptr<const Table> TableWrapper::_on_execute() {
   return _table;
 }
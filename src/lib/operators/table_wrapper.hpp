@@ -12,9 +12,15 @@ class TableWrapper : public AbstractOperator {
  public:
   explicit TableWrapper(const std::shared_ptr<const Table>& table);
 
+  std::optional<std::string> description() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
   // Table to retrieve
   const std::shared_ptr<const Table> _table;
 };
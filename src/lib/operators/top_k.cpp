@@ -0,0 +1,202 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <queue>
+
+#include "reference_output.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_values.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// A row that may be part of the result. The value points into the segment or the dictionary it was read from and is
+// nullptr for NULLs.
+template <typename T>
+struct Candidate {
+  const T* value;
+  RowID row_id;
+};
+
+// Returns whether lhs comes before rhs in the output.
+template <typename T>
+class Precedes {
+ public:
+  explicit Precedes(const SortColumnDefinition& sort_definition) : _sort_definition{sort_definition} {}
+
+  bool operator()(const Candidate<T>& lhs, const Candidate<T>& rhs) const {
+    if (!lhs.value || !rhs.value) {
+      if (lhs.value || rhs.value) {
+        return (_sort_definition.nulls_position == NullsPosition::First) == !lhs.value;
+      }
+      return lhs.row_id < rhs.row_id;
+    }
+
+    if (*lhs.value != *rhs.value) {
+      return (_sort_definition.sort_mode == SortMode::Ascending) == (*lhs.value < *rhs.value);
+    }
+    return lhs.row_id < rhs.row_id;
+  }
+
+ private:
+  const SortColumnDefinition& _sort_definition;
+};
+
+// Returns the best candidate of a dictionary segment, which precedes all rows of the segment.
+template <typename T>
+Candidate<T> best_candidate(const DictionarySegment<T>& segment, const SortColumnDefinition& sort_definition,
+                            const ChunkID chunk_id) {
+  const auto& dictionary = segment.dictionary();
+  const auto first_row = RowID{chunk_id, ChunkOffset{0}};
+  if (dictionary.empty() || (sort_definition.nulls_position == NullsPosition::First && segment.null_count() > 0)) {
+    return Candidate<T>{nullptr, first_row};
+  }
+  return Candidate<T>{sort_definition.sort_mode == SortMode::Ascending ? &dictionary.front() : &dictionary.back(),
+                      first_row};
+}
+
+template <typename T>
+std::vector<RowID> top_k_rows(const Table& input_table, const SortColumnDefinition& sort_definition, const uint64_t k,
+                              const size_t max_parallelism) {
+  const auto precedes = Precedes<T>{sort_definition};
+
+  // The worst row of the best full heap found so far. Only rows that precede it can be part of the result.
+  auto threshold = std::optional<Candidate<T>>{};
+  auto threshold_mutex = std::mutex{};
+
+  const auto chunk_count = input_table.chunk_count();
+  auto heaps = std::vector<std::vector<Candidate<T>>>(chunk_count);
+  parallel_for(chunk_count, max_parallelism, [&](const size_t chunk_index) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    const auto segment = input_table.get_chunk(chunk_id)->get_segment(sort_definition.column_id);
+
+    auto chunk_threshold = std::optional<Candidate<T>>{};
+    {
+      const auto lock = std::lock_guard<std::mutex>{threshold_mutex};
+      chunk_threshold = threshold;
+    }
+    const auto* dictionary_segment = segment_cast<DictionarySegment<T>>(segment.get());
+    if (chunk_threshold && dictionary_segment &&
+        !precedes(best_candidate(*dictionary_segment, sort_definition, chunk_id), *chunk_threshold)) {
+      return;
+    }
+
+    // The top of the heap is the worst candidate of the chunk.
+    auto heap = std::priority_queue<Candidate<T>, std::vector<Candidate<T>>, Precedes<T>>{precedes};
+    const auto push = [&](const Candidate<T>& candidate) {
+      if (chunk_threshold && !precedes(candidate, *chunk_threshold)) {
+        return;
+      }
+      if (heap.size() < k) {
+        heap.push(candidate);
+      } else if (precedes(candidate, heap.top())) {
+        heap.pop();
+        heap.push(candidate);
+      }
+    };
+    for_each_segment_value<T>(
+        *segment,
+        [&](const ChunkOffset chunk_offset, const T& value) {
+          push(Candidate<T>{&value, RowID{chunk_id, chunk_offset}});
+        },
+        [&](const ChunkOffset chunk_offset) {
+          push(Candidate<T>{nullptr, RowID{chunk_id, chunk_offset}});
+        });
+
+    if (heap.size() == k) {
+      const auto lock = std::lock_guard<std::mutex>{threshold_mutex};
+      if (!threshold || precedes(heap.top(), *threshold)) {
+        threshold = heap.top();
+      }
+    }
+    auto& chunk_candidates = heaps[chunk_index];
+    chunk_candidates.reserve(heap.size());
+    while (!heap.empty()) {
+      chunk_candidates.push_back(heap.top());
+      heap.pop();
+    }
+  });
+
+  auto candidates = std::vector<Candidate<T>>{};
+  for (const auto& chunk_candidates : heaps) {
+    candidates.insert(candidates.end(), chunk_candidates.cbegin(), chunk_candidates.cend());
+  }
+  const auto result_size = std::min(uint64_t{candidates.size()}, k);
+  std::partial_sort(candidates.begin(), candidates.begin() + result_size, candidates.end(), precedes);
+
+  auto rows = std::vector<RowID>(result_size);
+  for (auto row_index = size_t{0}; row_index < result_size; ++row_index) {
+    rows[row_index] = candidates[row_index].row_id;
+  }
+  return rows;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const SortColumnDefinition& sort_definition,
+           const uint64_t k)
+    : AbstractOperator{in}, _sort_definition{sort_definition}, _k{k} {}
+
+const SortColumnDefinition& TopK::sort_definition() const {
+  return _sort_definition;
+}
+
+uint64_t TopK::k() const {
+  return _k;
+}
+
+std::optional<std::string> TopK::description() const {
+  return "TopK " + std::to_string(_sort_definition.column_id) + ":" +
+         std::to_string(static_cast<int>(_sort_definition.sort_mode)) + ":" +
+         std::to_string(static_cast<int>(_sort_definition.nulls_position)) + " " + std::to_string(_k);
+}
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/) const {
+  return std::make_shared<TopK>(copied_left_input, _sort_definition, _k);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = _left_input_table();
+  Assert(input_table, "TopK requires an input.");
+  Assert(_sort_definition.column_id < input_table->column_count(), "Sort column does not exist.");
+
+  auto rows = std::vector<RowID>{};
+  if (_k > 0) {
+    resolve_data_type(input_table->column_data_type(_sort_definition.column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      rows = top_k_rows<Type>(*input_table, _sort_definition, _k, _max_parallelism);
+    });
+  }
+
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size());
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_nullable(column_id));
+  }
+
+  if (rows.empty()) {
+    append_empty_chunk(*output_table);
+    return output_table;
+  }
+  // k can be larger than a chunk can hold, so the rows are split into chunks of the target chunk size.
+  const auto input_pos_lists = pos_lists_by_column(*input_table);
+  const auto target_chunk_size = size_t{output_table->target_chunk_size()};
+  for (auto begin = size_t{0}; begin < rows.size(); begin += target_chunk_size) {
+    const auto end = std::min(begin + target_chunk_size, rows.size());
+    auto chunk = std::make_shared<Chunk>();
+    add_reference_segments(*chunk, input_table, std::make_shared<PosList>(rows.cbegin() + begin, rows.cbegin() + end),
+                           input_pos_lists);
+    output_table->append_chunk(chunk);
+  }
+  return output_table;
+}
+
+}  // namespace opossum
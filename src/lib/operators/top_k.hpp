@@ -0,0 +1,37 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+#include "sort.hpp"
+
+namespace opossum {
+
+// Returns the first k rows of the input if sorted by the given column, i.e., the same rows as a Sort followed by a
+// Limit, without sorting the whole input. Rows with equal values are ordered by their RowIDs.
+//
+// Each chunk is scanned into a bounded heap that holds its k best rows. The worst row of a full heap is a threshold
+// that the k best rows of the table must beat, so it is shared between the threads: rows that do not beat it are not
+// pushed, and dictionary-encoded chunks whose smallest (or largest) value cannot beat it are skipped entirely. The
+// output references the input rows in chunks of the input's target chunk size.
+class TopK : public AbstractOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const SortColumnDefinition& sort_definition,
+       const uint64_t k);
+
+  const SortColumnDefinition& sort_definition() const;
+
+  uint64_t k() const;
+
+  std::optional<std::string> description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
+
+  const SortColumnDefinition _sort_definition;
+  const uint64_t _k;
+};
+
+}  // namespace opossum
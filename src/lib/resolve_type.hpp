@@ -1,10 +1,16 @@
 #pragma once
 
+#include <optional>
+
 #include <boost/hana/equal.hpp>
 #include <boost/hana/for_each.hpp>
 #include <boost/hana/size.hpp>
 
 #include "all_type_variant.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -70,4 +76,105 @@ void resolve_data_type(const std::string& type_string, const Functor& func) {
   });
 }
 
+// Parses a type string, e.g., "int" to DataType::Int. As this compares the string with all type strings, use it only
+// when defining a schema and resolve the DataType afterwards.
+inline DataType data_type_from_string(const std::string& type_string) {
+  auto data_type = std::optional<DataType>{};
+  resolve_data_type(type_string, [&](const auto type) { data_type = data_type_of<typename decltype(type)::type>; });
+  Assert(data_type, "Unknown data type '" + type_string + "'.");
+  return *data_type;
+}
+
+// Same as above, but resolves a DataType, which compiles to a switch instead of string comparisons.
+template <typename Functor>
+void resolve_data_type(const DataType data_type, const Functor& func) {
+  switch (data_type) {
+    case DataType::Int:
+      func(hana::type_c<int32_t>);
+      return;
+    case DataType::Long:
+      func(hana::type_c<int64_t>);
+      return;
+    case DataType::Float:
+      func(hana::type_c<float>);
+      return;
+    case DataType::Double:
+      func(hana::type_c<double>);
+      return;
+    case DataType::String:
+      func(hana::type_c<std::string>);
+      return;
+  }
+  Fail("Unknown data type.");
+}
+
+/**
+ * Resolves the concrete type of a segment with values of type T by its encoding tag, i.e., func is called with a
+ * const ValueSegment<T>&, const DictionarySegment<T>&, or const ReferenceSegment&. Use it instead of trying
+ * dynamic_casts to the segment types. T is usually known from the column's type, e.g.:
+ *
+ *   resolve_segment_type<Type>(*segment, [&](const auto& typed_segment) {
+ *     using SegmentType = std::decay_t<decltype(typed_segment)>;
+ *     if constexpr (std::is_same_v<SegmentType, DictionarySegment<Type>>) {
+ *       ...
+ *     }
+ *   });
+ */
+template <typename T, typename Functor>
+void resolve_segment_type(const AbstractSegment& segment, const Functor& func) {
+  // A mismatch would static_cast the segment to the wrong type. Checking it once per segment is cheap.
+  Assert(segment.data_type() == data_type_of<T>, "Segment does not have the requested data type.");
+  switch (segment.encoding()) {
+    case SegmentEncoding::Unencoded:
+      func(static_cast<const ValueSegment<T>&>(segment));
+      return;
+    case SegmentEncoding::Dictionary:
+      func(static_cast<const DictionarySegment<T>&>(segment));
+      return;
+    case SegmentEncoding::Reference:
+      func(static_cast<const ReferenceSegment&>(segment));
+      return;
+  }
+  Fail("Unknown segment encoding.");
+}
+
+namespace detail {
+
+// The encoding of a segment type and the data type of its values. ReferenceSegments can reference any data type.
+template <typename SegmentType>
+struct SegmentTraits;
+
+template <typename T>
+struct SegmentTraits<ValueSegment<T>> {
+  static constexpr auto encoding = SegmentEncoding::Unencoded;
+  static constexpr auto data_type = std::optional<DataType>{data_type_of<T>};
+};
+
+template <typename T>
+struct SegmentTraits<DictionarySegment<T>> {
+  static constexpr auto encoding = SegmentEncoding::Dictionary;
+  static constexpr auto data_type = std::optional<DataType>{data_type_of<T>};
+};
+
+template <>
+struct SegmentTraits<ReferenceSegment> {
+  static constexpr auto encoding = SegmentEncoding::Reference;
+  static constexpr auto data_type = std::optional<DataType>{};
+};
+
+}  // namespace detail
+
+// Returns the segment as a SegmentType (ValueSegment<T>, DictionarySegment<T>, or ReferenceSegment) if it has the
+// corresponding encoding and data type and nullptr otherwise. Unlike a dynamic_cast, this only compares the tags.
+template <typename SegmentType>
+const SegmentType* segment_cast(const AbstractSegment* segment) {
+  using Traits = detail::SegmentTraits<SegmentType>;
+  if (!segment || segment->encoding() != Traits::encoding ||
+      (Traits::data_type && segment->data_type() != *Traits::data_type)) {
+    return nullptr;
+  }
+  DebugAssert(dynamic_cast<const SegmentType*>(segment), "Segment tags do not match its type.");
+  return static_cast<const SegmentType*>(segment);
+}
+
 }  // namespace opossum
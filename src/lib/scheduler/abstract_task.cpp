@@ -0,0 +1,82 @@
+#include "abstract_task.hpp"
+
+#include "scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void AbstractTask::set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor) {
+  Assert(!successor->is_scheduled(), "Dependencies cannot be added to scheduled tasks.");
+  ++successor->_pending_count;
+  _successors.push_back(successor);
+}
+
+const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() const {
+  return _successors;
+}
+
+bool AbstractTask::is_scheduled() const {
+  return _is_scheduled;
+}
+
+bool AbstractTask::is_done() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _is_done;
+}
+
+void AbstractTask::execute() {
+  auto exception = this->exception();
+  if (!exception) {
+    try {
+      _on_execute();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+  }
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _exception = exception;
+    _is_done = true;
+  }
+  _done_condition.notify_all();
+
+  for (const auto& successor : _successors) {
+    if (exception) {
+      const auto lock = std::lock_guard<std::mutex>{successor->_mutex};
+      if (!successor->_exception) {
+        successor->_exception = exception;
+      }
+    }
+    successor->_release();
+  }
+}
+
+void AbstractTask::wait() const {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  _done_condition.wait(lock, [&]() { return _is_done; });
+}
+
+bool AbstractTask::_wait_for(const std::chrono::microseconds timeout) const {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  return _done_condition.wait_for(lock, timeout, [&]() { return _is_done; });
+}
+
+std::exception_ptr AbstractTask::exception() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _exception;
+}
+
+void AbstractTask::_schedule(Scheduler& scheduler) {
+  Assert(!_is_scheduled.exchange(true), "Tasks cannot be scheduled twice.");
+  _scheduler = &scheduler;
+  _release();
+}
+
+void AbstractTask::_release() {
+  if (--_pending_count == 0) {
+    _scheduler->_enqueue(shared_from_this());
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Scheduler;
+
+// A task is a unit of work that the Scheduler executes on one of its worker threads. Tasks form a DAG: A task is only
+// executed once all of its predecessors are done. If a task throws, the exception is stored and passed on to its
+// successors, which are then not executed. Scheduler::wait_for_tasks rethrows it. Tasks need to be held by shared
+// pointers, as the scheduler keeps them alive while they are queued.
+class AbstractTask : public std::enable_shared_from_this<AbstractTask>, private Noncopyable {
+ public:
+  virtual ~AbstractTask() = default;
+
+  // Makes the successor wait for this task. Needs to be called before the successor is scheduled.
+  void set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor);
+
+  const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
+
+  bool is_scheduled() const;
+
+  // Returns whether the task was executed (or skipped because a predecessor failed).
+  bool is_done() const;
+
+  // Runs the task and releases its successors. Called by the scheduler.
+  void execute();
+
+  // Blocks the calling thread until the task is done.
+  void wait() const;
+
+  // Returns the exception thrown by the task or one of its predecessors, or nullptr.
+  std::exception_ptr exception() const;
+
+ protected:
+  friend class Scheduler;
+
+  virtual void _on_execute() = 0;
+
+  // Marks the task as scheduled and enqueues it in the scheduler once its predecessors are done.
+  void _schedule(Scheduler& scheduler);
+
+  // Called once by each predecessor and once when the task is scheduled. The last call enqueues the task.
+  void _release();
+
+  // Blocks the calling thread until the task is done or the timeout expired. Returns whether the task is done.
+  bool _wait_for(const std::chrono::microseconds timeout) const;
+
+  std::vector<std::shared_ptr<AbstractTask>> _successors;
+
+  // The number of predecessors that are not done yet, plus one until the task is scheduled.
+  std::atomic<size_t> _pending_count{1};
+
+  Scheduler* _scheduler = nullptr;
+  std::atomic<bool> _is_scheduled{false};
+
+  mutable std::mutex _mutex;
+  mutable std::condition_variable _done_condition;
+  bool _is_done = false;
+  std::exception_ptr _exception;
+};
+
+}  // namespace opossum
@@ -0,0 +1,18 @@
+#include "async_task.hpp"
+
+#include "job_task.hpp"
+#include "scheduler.hpp"
+
+namespace opossum {
+
+void resume_on_scheduler(const std::coroutine_handle<> handle, const bool is_yielding) {
+  auto& scheduler = Scheduler::get();
+  const auto task = std::make_shared<JobTask>([handle]() { handle.resume(); });
+  if (is_yielding) {
+    scheduler.schedule_yielding_task(task);
+  } else {
+    scheduler.schedule_tasks({task});
+  }
+}
+
+}  // namespace opossum
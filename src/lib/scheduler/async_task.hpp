@@ -0,0 +1,160 @@
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "cancellation_token.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Resumes the coroutine in a task on the global Scheduler. If is_yielding is set, the task is queued behind the tasks
+// that are already queued at the calling worker (see Scheduler::schedule_yielding_task).
+void resume_on_scheduler(const std::coroutine_handle<> handle, const bool is_yielding = false);
+
+// The return type of coroutines that run on the Scheduler, e.g., AbstractOperator::execute_async. Calling such a
+// coroutine starts it in a task on the Scheduler and returns at once. Other coroutines can co_await the result, which
+// suspends them without blocking a thread until the result is available. They are then resumed on the Scheduler.
+// Non-coroutine code can call get() instead, which blocks. Exceptions thrown by the coroutine are rethrown to the one
+// who accesses the result.
+template <typename T>
+class AsyncTask {
+  // The result is stored outside of the coroutine frame, so that the frame can be destroyed when the coroutine ends.
+  struct State {
+    std::mutex mutex;
+    std::condition_variable done_condition;
+    bool is_done = false;
+    std::optional<T> value;
+    std::exception_ptr exception;
+
+    // The coroutine that awaits the result, if any.
+    std::coroutine_handle<> continuation;
+  };
+
+ public:
+  struct promise_type {
+    AsyncTask get_return_object() {
+      return AsyncTask{state};
+    }
+
+    auto initial_suspend() noexcept {
+      struct StartOnScheduler {
+        bool await_ready() const noexcept {
+          return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> handle) const {
+          resume_on_scheduler(handle);
+        }
+
+        void await_resume() const noexcept {}
+      };
+      return StartOnScheduler{};
+    }
+
+    std::suspend_never final_suspend() noexcept {
+      return {};
+    }
+
+    void return_value(T value) {
+      _finish(std::move(value), nullptr);
+    }
+
+    void unhandled_exception() {
+      _finish(std::nullopt, std::current_exception());
+    }
+
+    const std::shared_ptr<State> state = std::make_shared<State>();
+
+   private:
+    void _finish(std::optional<T> value, const std::exception_ptr exception) {
+      auto continuation = std::coroutine_handle<>{};
+      {
+        const auto lock = std::lock_guard<std::mutex>{state->mutex};
+        state->value = std::move(value);
+        state->exception = exception;
+        state->is_done = true;
+        continuation = state->continuation;
+      }
+      state->done_condition.notify_all();
+
+      if (continuation) {
+        resume_on_scheduler(continuation);
+      }
+    }
+  };
+
+  bool is_done() const {
+    const auto lock = std::lock_guard<std::mutex>{_state->mutex};
+    return _state->is_done;
+  }
+
+  // Blocks until the result is available. Must not be called by the Scheduler's workers, which co_await it instead.
+  T get() const {
+    auto lock = std::unique_lock<std::mutex>{_state->mutex};
+    _state->done_condition.wait(lock, [&]() { return _state->is_done; });
+    return _result();
+  }
+
+  bool await_ready() const {
+    return is_done();
+  }
+
+  bool await_suspend(const std::coroutine_handle<> continuation) {
+    const auto lock = std::lock_guard<std::mutex>{_state->mutex};
+    if (_state->is_done) {
+      // Resume the awaiting coroutine at once.
+      return false;
+    }
+    Assert(!_state->continuation, "Only one coroutine can await an AsyncTask.");
+    _state->continuation = continuation;
+    return true;
+  }
+
+  T await_resume() const {
+    const auto lock = std::lock_guard<std::mutex>{_state->mutex};
+    return _result();
+  }
+
+ protected:
+  explicit AsyncTask(const std::shared_ptr<State>& state) : _state{state} {}
+
+  // Needs to be called with the state's mutex held.
+  T _result() const {
+    if (_state->exception) {
+      std::rethrow_exception(_state->exception);
+    }
+    return *_state->value;
+  }
+
+  std::shared_ptr<State> _state;
+};
+
+// Awaiting the returned object lets long-running coroutines give way to other tasks: The coroutine is suspended and
+// queued behind the tasks that are waiting at the current worker. Afterwards (or at once, if the token is already
+// cancelled), it throws OperationCancelled if the token was cancelled.
+inline auto yield_to_scheduler(const CancellationToken& token) {
+  struct YieldAwaiter {
+    bool await_ready() const {
+      return token.is_cancelled();
+    }
+
+    void await_suspend(const std::coroutine_handle<> handle) const {
+      resume_on_scheduler(handle, true);
+    }
+
+    void await_resume() const {
+      token.throw_if_cancelled();
+    }
+
+    const CancellationToken token;
+  };
+  return YieldAwaiter{token};
+}
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#include "cancellation_token.hpp"
+
+namespace opossum {
+
+CancellationToken::CancellationToken() : _is_cancelled{std::make_shared<std::atomic<bool>>(false)} {}
+
+void CancellationToken::cancel() const {
+  *_is_cancelled = true;
+}
+
+bool CancellationToken::is_cancelled() const {
+  return *_is_cancelled;
+}
+
+void CancellationToken::throw_if_cancelled() const {
+  if (is_cancelled()) {
+    throw OperationCancelled("The execution was cancelled.");
+  }
+}
+
+}  // namespace opossum
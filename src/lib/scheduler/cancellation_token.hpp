@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+namespace opossum {
+
+// Thrown by code that stops because its CancellationToken was cancelled.
+class OperationCancelled : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+// Allows cancelling an asynchronous execution (see AbstractOperator::execute_async). Copies of a token share their
+// state, so the caller can keep a copy and cancel it while the execution checks another one. Cancelling is cooperative:
+// The execution checks the token at defined points (e.g., between chunks) and stops by throwing OperationCancelled.
+class CancellationToken {
+ public:
+  CancellationToken();
+
+  void cancel() const;
+
+  bool is_cancelled() const;
+
+  // Throws OperationCancelled if the token was cancelled.
+  void throw_if_cancelled() const;
+
+ protected:
+  std::shared_ptr<std::atomic<bool>> _is_cancelled;
+};
+
+}  // namespace opossum
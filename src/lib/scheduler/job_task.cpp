@@ -0,0 +1,11 @@
+#include "job_task.hpp"
+
+namespace opossum {
+
+JobTask::JobTask(const std::function<void()>& function) : _function{function} {}
+
+void JobTask::_on_execute() {
+  _function();
+}
+
+}  // namespace opossum
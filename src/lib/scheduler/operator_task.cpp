@@ -0,0 +1,51 @@
+#include "operator_task.hpp"
+
+#include <functional>
+#include <unordered_map>
+
+namespace opossum {
+
+OperatorTask::OperatorTask(const std::shared_ptr<AbstractOperator>& op) : _operator{op} {}
+
+std::vector<std::shared_ptr<AbstractTask>> OperatorTask::make_tasks_from_operator(
+    const std::shared_ptr<AbstractOperator>& root) {
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto task_by_operator = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractTask>>{};
+
+  // Creates the tasks in post-order, so that the inputs' tasks precede the ones of their consumers.
+  const std::function<std::shared_ptr<AbstractTask>(const std::shared_ptr<const AbstractOperator>&)> make_task =
+      [&](const std::shared_ptr<const AbstractOperator>& op) -> std::shared_ptr<AbstractTask> {
+    if (!op || op->was_executed()) {
+      return nullptr;
+    }
+
+    const auto iter = task_by_operator.find(op.get());
+    if (iter != task_by_operator.end()) {
+      return iter->second;
+    }
+
+    // The plan holds const pointers to the inputs, but they need to be executed before their consumers.
+    const auto task = std::make_shared<OperatorTask>(std::const_pointer_cast<AbstractOperator>(op));
+    for (const auto& input : {op->left_input(), op->right_input()}) {
+      if (const auto input_task = make_task(input)) {
+        input_task->set_as_predecessor_of(task);
+      }
+    }
+    task_by_operator.emplace(op.get(), task);
+    tasks.push_back(task);
+    return task;
+  };
+
+  make_task(root);
+  return tasks;
+}
+
+const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const {
+  return _operator;
+}
+
+void OperatorTask::_on_execute() {
+  _operator->execute();
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+// A task that executes an operator.
+class OperatorTask : public AbstractTask {
+ public:
+  explicit OperatorTask(const std::shared_ptr<AbstractOperator>& op);
+
+  // Creates the tasks that execute the operator and its (transitive) inputs. The task of an input is a predecessor of
+  // the task of its consumer, so that independent subtrees of the plan can be executed concurrently. Operators that are
+  // used as the input of several operators get a single task. Inputs that were already executed get no task. The task
+  // of the root operator is the last one.
+  static std::vector<std::shared_ptr<AbstractTask>> make_tasks_from_operator(
+      const std::shared_ptr<AbstractOperator>& root);
+
+  const std::shared_ptr<AbstractOperator>& get_operator() const;
+
+ protected:
+  void _on_execute() override;
+
+  const std::shared_ptr<AbstractOperator> _operator;
+};
+
+}  // namespace opossum
@@ -0,0 +1,190 @@
+#include "scheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "utils/assert.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// The scheduler and worker id of the calling thread if it is a worker.
+thread_local const Scheduler* current_scheduler = nullptr;
+thread_local size_t current_worker_id = 0;
+
+// Workers that wait for tasks executed by other workers sleep for this long at first and twice as long each time no
+// other task was ready, up to the maximum.
+constexpr auto MIN_WAIT_TIMEOUT = std::chrono::microseconds{10};
+constexpr auto MAX_WAIT_TIMEOUT = std::chrono::microseconds{1'000};
+
+}  // namespace
+
+namespace opossum {
+
+Scheduler& Scheduler::get() {
+  static auto instance = Scheduler{default_max_parallelism()};
+  return instance;
+}
+
+Scheduler::Scheduler(const size_t worker_count) {
+  Assert(worker_count > 0, "Scheduler needs at least one worker.");
+  _queues.reserve(worker_count);
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _queues.push_back(std::make_unique<WorkerQueue>());
+  }
+
+  _workers.reserve(worker_count);
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _workers.emplace_back([this, worker_id]() { _work(worker_id); });
+  }
+}
+
+Scheduler::~Scheduler() {
+  {
+    // Setting the flag under the mutex ensures that workers either see it before they sleep or are woken up.
+    const auto lock = std::lock_guard<std::mutex>{_sleep_mutex};
+    _is_shutting_down = true;
+  }
+  _wake_condition.notify_all();
+
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+size_t Scheduler::worker_count() const {
+  return _workers.size();
+}
+
+void Scheduler::schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  for (const auto& task : tasks) {
+    task->_schedule(*this);
+  }
+}
+
+void Scheduler::wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  for (const auto& task : tasks) {
+    Assert(task->is_scheduled(), "Waiting for a task that was not scheduled.");
+  }
+
+  if (const auto worker_id = _current_worker_id()) {
+    // Blocking here could leave all workers waiting for tasks that none of them executes. Instead, the worker executes
+    // other tasks. If none are ready, the remaining tasks are being executed by other workers, and it waits for them
+    // with a growing timeout, so that it neither spins nor misses tasks that are queued in the meantime.
+    auto timeout = MIN_WAIT_TIMEOUT;
+    for (const auto& task : tasks) {
+      while (!task->is_done()) {
+        if (const auto other_task = _pop_task(*worker_id)) {
+          other_task->execute();
+          timeout = MIN_WAIT_TIMEOUT;
+        } else if (!task->_wait_for(timeout)) {
+          timeout = std::min(timeout * 2, MAX_WAIT_TIMEOUT);
+        }
+      }
+    }
+  } else {
+    for (const auto& task : tasks) {
+      task->wait();
+    }
+  }
+
+  for (const auto& task : tasks) {
+    if (const auto exception = task->exception()) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+
+void Scheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  schedule_tasks(tasks);
+  wait_for_tasks(tasks);
+}
+
+void Scheduler::schedule_yielding_task(const std::shared_ptr<AbstractTask>& task) {
+  Assert(!task->_is_scheduled.exchange(true), "Tasks cannot be scheduled twice.");
+  Assert(task->_pending_count == 1, "Yielding tasks cannot have predecessors.");
+  task->_scheduler = this;
+  task->_pending_count = 0;
+  _enqueue(task, true);
+}
+
+void Scheduler::_enqueue(const std::shared_ptr<AbstractTask>& task, const bool is_yielding) {
+  ++_queued_task_count;
+
+  const auto worker_id = _current_worker_id();
+  auto& queue = *_queues[worker_id ? *worker_id : _next_queue_id++ % _queues.size()];
+  {
+    const auto lock = std::lock_guard<std::mutex>{queue.mutex};
+    if (is_yielding) {
+      queue.tasks.push_front(task);
+    } else {
+      queue.tasks.push_back(task);
+    }
+  }
+
+  // Workers increase the sleeping count before they check the queued count, and the queued count was increased before
+  // the sleeping count is read here. With sequentially consistent atomics, either the worker sees the task or the
+  // sleeping worker is seen here. Locking the mutex ensures that the worker is not between its check and its wait.
+  if (_sleeping_worker_count > 0) {
+    const auto lock = std::lock_guard<std::mutex>{_sleep_mutex};
+    _wake_condition.notify_one();
+  }
+}
+
+std::shared_ptr<AbstractTask> Scheduler::_pop_task(const size_t worker_id) {
+  auto task = std::shared_ptr<AbstractTask>{};
+  {
+    auto& queue = *_queues[worker_id];
+    const auto lock = std::lock_guard<std::mutex>{queue.mutex};
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    }
+  }
+
+  const auto queue_count = _queues.size();
+  for (auto offset = size_t{1}; !task && offset < queue_count; ++offset) {
+    auto& queue = *_queues[(worker_id + offset) % queue_count];
+    const auto lock = std::lock_guard<std::mutex>{queue.mutex};
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+  }
+
+  if (task) {
+    --_queued_task_count;
+  }
+  return task;
+}
+
+void Scheduler::_work(const size_t worker_id) {
+  current_scheduler = this;
+  current_worker_id = worker_id;
+
+  while (true) {
+    if (const auto task = _pop_task(worker_id)) {
+      task->execute();
+      continue;
+    }
+
+    auto lock = std::unique_lock<std::mutex>{_sleep_mutex};
+    ++_sleeping_worker_count;
+    _wake_condition.wait(lock, [&]() { return _queued_task_count > 0 || _is_shutting_down; });
+    --_sleeping_worker_count;
+    if (_is_shutting_down && _queued_task_count == 0) {
+      return;
+    }
+  }
+}
+
+std::optional<size_t> Scheduler::_current_worker_id() const {
+  if (current_scheduler != this) {
+    return std::nullopt;
+  }
+  return current_worker_id;
+}
+
+}  // namespace opossum
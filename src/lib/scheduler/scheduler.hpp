@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The Scheduler executes tasks on a fixed pool of worker threads. Each worker has its own deque of ready tasks. Tasks
+// that a worker schedules (e.g., the subtasks of an operator) go to the back of its own deque, tasks scheduled by other
+// threads are distributed round-robin. Workers take tasks from the back of their own deque, which keeps the data of
+// recently scheduled tasks in their caches, and steal from the front of the other workers' deques once their own is
+// empty.
+class Scheduler : private Noncopyable {
+ public:
+  // Returns the scheduler that operators use, which has one worker per hardware thread and is started on first use.
+  static Scheduler& get();
+
+  explicit Scheduler(const size_t worker_count);
+
+  // Executes the remaining tasks and stops the workers.
+  ~Scheduler();
+
+  Scheduler(Scheduler&&) = delete;
+
+  size_t worker_count() const;
+
+  // Schedules the tasks. Each task is executed as soon as its predecessors are done. All predecessors of a task need to
+  // be scheduled as well (here or before).
+  void schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  // Blocks until all given tasks are done. If the calling thread is one of the workers, it executes other tasks in the
+  // meantime, so that tasks can wait for their subtasks without blocking a worker. Rethrows the first exception thrown
+  // by any of the tasks.
+  void wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  // Schedules a task without predecessors behind the tasks that are queued at the calling worker, i.e., the worker
+  // only executes it once it has no other work, while idle workers steal it first. Used by coroutines that give way to
+  // other tasks (see yield_to_scheduler).
+  void schedule_yielding_task(const std::shared_ptr<AbstractTask>& task);
+
+  // Schedules the tasks and waits for them.
+  void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+ protected:
+  friend class AbstractTask;
+
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<std::shared_ptr<AbstractTask>> tasks;
+  };
+
+  // Adds a ready task to the back of a worker's deque, or to the front if is_yielding is set.
+  void _enqueue(const std::shared_ptr<AbstractTask>& task, const bool is_yielding = false);
+
+  // Returns a task from the worker's own deque or, if that is empty, one stolen from another worker. Returns nullptr if
+  // all deques are empty.
+  std::shared_ptr<AbstractTask> _pop_task(const size_t worker_id);
+
+  void _work(const size_t worker_id);
+
+  // Returns the id of the calling thread's worker if it belongs to this scheduler.
+  std::optional<size_t> _current_worker_id() const;
+
+  std::vector<std::unique_ptr<WorkerQueue>> _queues;
+  std::vector<std::thread> _workers;
+  std::atomic<size_t> _next_queue_id{0};
+
+  // Idle workers sleep until tasks are queued. The count is increased before a task is pushed, so that it is never
+  // lower than the number of queued tasks. Enqueuing and popping tasks only update the atomic counts. The mutex is only
+  // locked to put workers to sleep and to wake sleeping workers up.
+  std::atomic<size_t> _queued_task_count{0};
+  std::atomic<size_t> _sleeping_worker_count{0};
+  std::mutex _sleep_mutex;
+  std::condition_variable _wake_condition;
+  std::atomic<bool> _is_shutting_down{false};
+};
+
+}  // namespace opossum
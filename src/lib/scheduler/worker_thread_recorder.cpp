@@ -0,0 +1,36 @@
+#include "worker_thread_recorder.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+thread_local WorkerThreadRecorder* current_recorder = nullptr;
+
+}  // namespace
+
+namespace opossum {
+
+WorkerThreadRecorder::Scope::Scope(WorkerThreadRecorder& recorder) : _previous_recorder{current_recorder} {
+  current_recorder = &recorder;
+  recorder.record_current_thread();
+}
+
+WorkerThreadRecorder::Scope::~Scope() {
+  current_recorder = _previous_recorder;
+}
+
+WorkerThreadRecorder* WorkerThreadRecorder::current() {
+  return current_recorder;
+}
+
+void WorkerThreadRecorder::record_current_thread() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _thread_ids.insert(std::this_thread::get_id());
+}
+
+size_t WorkerThreadRecorder::thread_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _thread_ids.size();
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Collects the threads that work on an operator. parallel_for records the threads that execute its jobs in the
+// recorder that is current on the calling thread.
+class WorkerThreadRecorder : private Noncopyable {
+ public:
+  // Makes the recorder the current one of the calling thread, which is recorded, until the scope is destroyed. Scopes
+  // must not span suspension points of coroutines, as the coroutine might be resumed on another thread.
+  class Scope : private Noncopyable {
+   public:
+    explicit Scope(WorkerThreadRecorder& recorder);
+    ~Scope();
+
+   protected:
+    WorkerThreadRecorder* const _previous_recorder;
+  };
+
+  // Returns the current recorder of the calling thread or nullptr if there is none.
+  static WorkerThreadRecorder* current();
+
+  void record_current_thread();
+
+  size_t thread_count() const;
+
+ protected:
+  mutable std::mutex _mutex;
+  std::unordered_set<std::thread::id> _thread_ids;
+};
+
+}  // namespace opossum
@@ -9,10 +9,13 @@
 namespace opossum {
 
 // AbstractSegment is the abstract super class for all segment types, i.e, ValueSegment, DictionarySegment,
-// ReferenceSegment.
+// ReferenceSegment. Each segment is tagged with its encoding and data type, which identify its concrete type without
+// RTTI (see resolve_segment_type).
 class AbstractSegment : private Noncopyable {
  public:
-  AbstractSegment() = default;
+  AbstractSegment(const SegmentEncoding encoding, const DataType data_type)
+      : _encoding{encoding}, _data_type{data_type} {}
+
   virtual ~AbstractSegment() = default;
 
   // We need to explicitly set the move constructor to default when we overwrite the copy constructor.
@@ -20,6 +23,15 @@ class AbstractSegment : private Noncopyable {
 
   AbstractSegment& operator=(AbstractSegment&&) = default;
 
+  SegmentEncoding encoding() const {
+    return _encoding;
+  }
+
+  // Returns the data type of the values. For reference segments, this is the data type of the referenced column.
+  DataType data_type() const {
+    return _data_type;
+  }
+
   // Returns the value at a given position.
   virtual AllTypeVariant operator[](const ChunkOffset chunk_offset) const = 0;
 
@@ -28,6 +40,10 @@ class AbstractSegment : private Noncopyable {
 
   // Returns the calculated memory usage.
   virtual size_t estimate_memory_usage() const = 0;
+
+ private:
+  SegmentEncoding _encoding;
+  DataType _data_type;
 };
 
 }  // namespace opossum
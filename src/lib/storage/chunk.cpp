@@ -1,37 +1,37 @@
 #include "chunk.hpp"
 
+#include "resolve_type.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
 void Chunk::add_segment(const std::shared_ptr<AbstractSegment> segment) {
-  _columns.push_back(segment);
-}
-
-template <typename T>
-bool append_with_type(std::vector<std::shared_ptr<AbstractSegment>>::iterator column_it,
-                      std::vector<AllTypeVariant>::const_iterator value_it) {
-  auto segment = std::dynamic_pointer_cast<ValueSegment<T>>(*column_it);
-  if (segment) {
-    segment->append(*value_it);
-    return true;
+  if (segment->encoding() != SegmentEncoding::Unencoded) {
+    _is_immutable = true;
   }
-  return false;
+  _columns.push_back(segment);
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
+  Assert(!_is_immutable, "Cannot append to an immutable chunk.");
   DebugAssert(values.size() == column_count(), "Cannot insert a tuple with less values than columns.");
 
-  auto column_it = _columns.begin();
-  auto value_it = values.begin();
+  const auto segment_count = _columns.size();
+  for (auto column_id = ColumnID{0}; column_id < segment_count; ++column_id) {
+    auto& segment = *_columns[column_id];
+    resolve_data_type(segment.data_type(), [&](const auto type) {
+      using Type = typename decltype(type)::type;
+      static_cast<ValueSegment<Type>&>(segment).append(values[column_id]);
+    });
+  }
+}
 
-  for (; column_it < _columns.end(); ++column_it) {
-    (append_with_type<int32_t>(column_it, value_it) || append_with_type<int64_t>(column_it, value_it) ||
-     append_with_type<float>(column_it, value_it) || append_with_type<double>(column_it, value_it) ||
-     append_with_type<std::string>(column_it, value_it));
+bool Chunk::is_immutable() const {
+  return _is_immutable;
+}
 
-    ++value_it;
-  }
+void Chunk::set_immutable() {
+  _is_immutable = true;
 }
 
 std::shared_ptr<AbstractSegment> Chunk::get_segment(const ColumnID column_id) const {
@@ -18,7 +18,7 @@ class Chunk : private Noncopyable {
   // Creates an empty chunk.
   Chunk() = default;
 
-  // Adds a segment to the "right" of the chunk.
+  // Adds a segment to the "right" of the chunk. Adding any other segment than a ValueSegment makes the chunk immutable.
   void add_segment(const std::shared_ptr<AbstractSegment> segment);
 
   // Returns the number of columns (cannot exceed ColumnID (uint16_t)).
@@ -28,15 +28,21 @@ class Chunk : private Noncopyable {
   ChunkOffset size() const;
 
   // Adds a new row, given as a list of values, to the chunk. Note this is slow and not thread-safe and should be used
-  // for testing purposes only.
+  // for testing purposes only. The chunk must not be immutable.
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Immutable chunks cannot be appended to, e.g., because they contain encoded segments. Thus, the owner of a chunk
+  // can tell whether it needs a new chunk for further rows without inspecting the segments.
+  bool is_immutable() const;
+  void set_immutable();
+
   // Returns the segment at a given position.
   std::shared_ptr<AbstractSegment> get_segment(ColumnID column_id) const;
 
  protected:
  private:
   std::vector<std::shared_ptr<AbstractSegment>> _columns;
+  bool _is_immutable{false};
 };
 
 }  // namespace opossum
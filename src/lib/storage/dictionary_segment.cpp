@@ -7,9 +7,11 @@
 namespace opossum {
 
 template <typename T>
-DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
-  auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
-  DebugAssert(value_segment, "Given segment is not a value segment.");
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment)
+    : AbstractSegment{SegmentEncoding::Dictionary, data_type_of<T>} {
+  Assert(abstract_segment->encoding() == SegmentEncoding::Unencoded && abstract_segment->data_type() == data_type(),
+         "Given segment is not a value segment of the same data type.");
+  const auto value_segment = std::static_pointer_cast<ValueSegment<T>>(abstract_segment);
 
   auto distinct_values_count = fill_dictionary(value_segment);
   initialize_attributes_vector(distinct_values_count, abstract_segment->size());
@@ -34,21 +36,27 @@ void DictionarySegment<T>::initialize_attributes_vector(const size_t distinct_va
 
 template <typename T>
 size_t DictionarySegment<T>::fill_dictionary(std::shared_ptr<ValueSegment<T>> value_segment) {
-  auto values = std::vector<T>(value_segment->values());
+  // NULLs are stored as T{} in the value segment. They must not end up in the dictionary, as T{} may also be a
+  // regular value of the segment.
+  auto values = std::vector<T>{};
+  auto contains_null = false;
+  const auto& segment_values = value_segment->values();
+  const auto segment_size = segment_values.size();
+  values.reserve(segment_size);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    if (value_segment->is_nullable() && value_segment->null_values()[chunk_offset]) {
+      contains_null = true;
+    } else {
+      values.push_back(segment_values[chunk_offset]);
+    }
+  }
 
   std::sort(values.begin(), values.end());
   auto last_distinct = std::unique(values.begin(), values.end());
   values.erase(last_distinct, values.end());
 
   // Includes NULL-Values.
-  const auto distinct_values_count = values.size();
-
-  if (value_segment->is_nullable()) {
-    const auto null_values = value_segment->null_values();
-    const auto contains_null = (std::find(null_values.begin(), null_values.end(), true) != null_values.end());
-    if (contains_null)
-      values.erase(values.begin());
-  }
+  const auto distinct_values_count = values.size() + (contains_null ? 1 : 0);
 
   _dictionary = values;
   return distinct_values_count;
@@ -76,6 +84,7 @@ void DictionarySegment<T>::fill_attributes_vector(std::shared_ptr<ValueSegment<T
   for (auto val_index = ChunkOffset{0}; val_index < values_count; ++val_index) {
     if (is_null(val_index)) {
       _attribute_vector->set(val_index, null_value_id());
+      ++_null_count;
     } else {
       _attribute_vector->set(val_index, inverted_dictionary[values[val_index]]);
     }
@@ -84,7 +93,11 @@ void DictionarySegment<T>::fill_attributes_vector(std::shared_ptr<ValueSegment<T
 
 template <typename T>
 AllTypeVariant DictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
-  return decompress(chunk_offset);
+  const auto value = get_typed_value(chunk_offset);
+  if (!value) {
+    return NULL_VALUE;
+  }
+  return *value;
 }
 
 template <typename T>
@@ -172,6 +185,38 @@ ChunkOffset DictionarySegment<T>::size() const {
   return static_cast<ChunkOffset>(_attribute_vector->size());
 }
 
+template <typename T>
+std::optional<T> DictionarySegment<T>::min() const {
+  if (_dictionary.empty()) {
+    return std::nullopt;
+  }
+  return _dictionary.front();
+}
+
+template <typename T>
+std::optional<T> DictionarySegment<T>::max() const {
+  if (_dictionary.empty()) {
+    return std::nullopt;
+  }
+  return _dictionary.back();
+}
+
+template <typename T>
+ChunkOffset DictionarySegment<T>::null_count() const {
+  return _null_count;
+}
+
+template <typename T>
+std::vector<ChunkOffset> DictionarySegment<T>::value_id_counts() const {
+  auto counts = std::vector<ChunkOffset>(_dictionary.size() + 1);
+  resolve_attribute_vector(*_attribute_vector, [&](const auto& attribute_vector) {
+    for (const auto value_id : attribute_vector.values()) {
+      ++counts[value_id];
+    }
+  });
+  return counts;
+}
+
 template <typename T>
 size_t DictionarySegment<T>::estimate_memory_usage() const {
   return (_dictionary.size() * sizeof(T)) + (_attribute_vector->size() * _attribute_vector->width());
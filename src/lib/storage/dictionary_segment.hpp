@@ -57,6 +57,19 @@ class DictionarySegment : public AbstractSegment {
   // Returns the number of entries.
   ChunkOffset size() const override;
 
+  // Aggregate kernels that answer from the dictionary and the attribute vector without decompressing any value.
+  // As the dictionary is sorted and only contains the segment's values, min and max are its first and last entries.
+  // Both return std::nullopt if the segment only contains NULLs.
+  std::optional<T> min() const;
+  std::optional<T> max() const;
+
+  // Returns the number of NULL values.
+  ChunkOffset null_count() const;
+
+  // Returns the number of occurrences of each value ID, indexed by value ID. The last entry (at null_value_id())
+  // is the number of NULL values.
+  std::vector<ChunkOffset> value_id_counts() const;
+
   // Returns the calculated memory usage.
   size_t estimate_memory_usage() const final;
 
@@ -68,6 +81,7 @@ class DictionarySegment : public AbstractSegment {
 
   std::vector<T> _dictionary;
   std::shared_ptr<AbstractAttributeVector> _attribute_vector;
+  ChunkOffset _null_count{0};
 };
 
 EXPLICITLY_DECLARE_DATA_TYPES(DictionarySegment);
@@ -34,6 +34,11 @@ AttributeVectorWidth FixedWidthIntegerVector<T>::width() const {
   return AttributeVectorWidth{sizeof(T)};
 }
 
+template <typename T>
+const std::vector<T>& FixedWidthIntegerVector<T>::values() const {
+  return _attribute_vector;
+}
+
 template class FixedWidthIntegerVector<u_int8_t>;
 template class FixedWidthIntegerVector<u_int16_t>;
 template class FixedWidthIntegerVector<u_int32_t>;
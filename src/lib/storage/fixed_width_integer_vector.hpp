@@ -3,6 +3,7 @@
 #include "abstract_attribute_vector.hpp"
 #include "abstract_segment.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 #include "vector"
 
 namespace opossum {
@@ -23,8 +24,30 @@ class FixedWidthIntegerVector : public AbstractAttributeVector {
   // Returns the width of biggest value id in bytes.
   AttributeVectorWidth width() const;
 
+  // Returns all value ids. Use this in hot loops instead of calling get() for each position.
+  const std::vector<T>& values() const;
+
  protected:
   std::vector<T> _attribute_vector;
 };
 
+// Calls the functor with the concrete FixedWidthIntegerVector of the given attribute vector, so that hot loops can
+// access the value ids without a virtual call per position.
+template <typename Functor>
+void resolve_attribute_vector(const AbstractAttributeVector& attribute_vector, const Functor& functor) {
+  switch (attribute_vector.width()) {
+    case sizeof(u_int8_t):
+      functor(static_cast<const FixedWidthIntegerVector<u_int8_t>&>(attribute_vector));
+      break;
+    case sizeof(u_int16_t):
+      functor(static_cast<const FixedWidthIntegerVector<u_int16_t>&>(attribute_vector));
+      break;
+    case sizeof(u_int32_t):
+      functor(static_cast<const FixedWidthIntegerVector<u_int32_t>&>(attribute_vector));
+      break;
+    default:
+      Fail("Unsupported attribute vector width.");
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,131 @@
+#include "pos_list.hpp"
+
+#include <algorithm>
+
+namespace opossum {
+
+bool AbstractPosList::empty() const {
+  return size() == 0;
+}
+
+ChunkID PosList::common_chunk_id() const {
+  // We do not track whether all RowIDs share a chunk, as that would require a check on every insertion.
+  return INVALID_CHUNK_ID;
+}
+
+size_t PosList::memory_usage() const {
+  return capacity() * sizeof(RowID);
+}
+
+SingleChunkPosList::SingleChunkPosList(const ChunkID chunk_id, std::vector<ChunkOffset>&& offsets)
+    : _chunk_id{chunk_id}, _offsets{std::move(offsets)} {}
+
+size_t SingleChunkPosList::size() const {
+  return _offsets.size();
+}
+
+ChunkID SingleChunkPosList::common_chunk_id() const {
+  return _chunk_id;
+}
+
+size_t SingleChunkPosList::memory_usage() const {
+  return _offsets.capacity() * sizeof(ChunkOffset);
+}
+
+const std::vector<ChunkOffset>& SingleChunkPosList::offsets() const {
+  return _offsets;
+}
+
+ChunkRangePosList::ChunkRangePosList(const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                     const ChunkOffset end_offset)
+    : _chunk_id{chunk_id}, _begin_offset{begin_offset}, _end_offset{end_offset} {
+  Assert(begin_offset <= end_offset, "Range of a ChunkRangePosList must not be negative.");
+}
+
+size_t ChunkRangePosList::size() const {
+  return _end_offset - _begin_offset;
+}
+
+ChunkID ChunkRangePosList::common_chunk_id() const {
+  return _chunk_id;
+}
+
+size_t ChunkRangePosList::memory_usage() const {
+  return 0;
+}
+
+BitmapPosList::BitmapPosList(const ChunkID chunk_id, std::vector<uint64_t>&& words)
+    : _chunk_id{chunk_id}, _words{std::move(words)} {
+  const auto word_count = _words.size();
+  _preceding_bit_counts.resize(word_count);
+  for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+    _preceding_bit_counts[word_index] = static_cast<uint32_t>(_size);
+    _size += std::popcount(_words[word_index]);
+  }
+}
+
+RowID BitmapPosList::operator[](const size_t index) const {
+  DebugAssert(index < _size, "Index out of bounds.");
+  return *iterator_at(index);
+}
+
+BitmapPosList::Iterator BitmapPosList::iterator_at(const size_t index) const {
+  DebugAssert(index <= _size, "Index out of bounds.");
+  if (index == _size) {
+    return end();
+  }
+
+  // Find the last word whose preceding bit count is <= index. Empty words share their count with the next word, so
+  // upper_bound skips them.
+  const auto word_it = std::upper_bound(_preceding_bit_counts.cbegin(), _preceding_bit_counts.cend(), index) - 1;
+  const auto word_index = static_cast<size_t>(word_it - _preceding_bit_counts.cbegin());
+
+  auto word = _words[word_index];
+  for (auto skipped_bits = index - *word_it; skipped_bits > 0; --skipped_bits) {
+    word &= word - 1;
+  }
+
+  return Iterator{_chunk_id, &_words, word_index, word};
+}
+
+size_t BitmapPosList::size() const {
+  return _size;
+}
+
+ChunkID BitmapPosList::common_chunk_id() const {
+  return _chunk_id;
+}
+
+size_t BitmapPosList::memory_usage() const {
+  return _words.capacity() * sizeof(uint64_t) + _preceding_bit_counts.capacity() * sizeof(uint32_t);
+}
+
+std::shared_ptr<const AbstractPosList> make_single_chunk_pos_list(const ChunkID chunk_id,
+                                                                  std::vector<ChunkOffset>&& offsets,
+                                                                  const ChunkOffset chunk_size) {
+  DebugAssert(std::is_sorted(offsets.cbegin(), offsets.cend()), "Offsets must be sorted.");
+  const auto offset_count = offsets.size();
+
+  // Sorted, distinct offsets are contiguous if the distance between the first and the last one matches their count.
+  if (offset_count > 0 && offsets.back() - offsets.front() + 1 == offset_count) {
+    return std::make_shared<ChunkRangePosList>(chunk_id, offsets.front(), offsets.back() + 1);
+  }
+
+  // A bitmap needs 64 + 32 bits per 64 rows of the chunk, i.e., 1.5 bits per row, while the offsets need 32 bits per
+  // position. The bitmap is smaller if more than 1.5 / 32 of the rows qualify.
+  const auto word_count = (static_cast<size_t>(chunk_size) + BitmapPosList::BITS_PER_WORD - 1) /
+                          BitmapPosList::BITS_PER_WORD;
+  const auto bitmap_bytes = word_count * (sizeof(uint64_t) + sizeof(uint32_t));
+  if (bitmap_bytes < offset_count * sizeof(ChunkOffset)) {
+    auto words = std::vector<uint64_t>(word_count);
+    for (const auto offset : offsets) {
+      words[offset / BitmapPosList::BITS_PER_WORD] |= uint64_t{1} << (offset % BitmapPosList::BITS_PER_WORD);
+    }
+    return std::make_shared<BitmapPosList>(chunk_id, std::move(words));
+  }
+
+  offsets.shrink_to_fit();
+  return std::make_shared<SingleChunkPosList>(chunk_id, std::move(offsets));
+}
+
+}  // namespace opossum
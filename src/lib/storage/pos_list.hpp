@@ -0,0 +1,477 @@
+#pragma once
+
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// AbstractPosList is the abstract super class for all position lists, which store the rows that a ReferenceSegment
+// references. Besides the general PosList, which stores a full RowID per position, there are compact representations
+// for positions that all belong to the same chunk (which is the case for the output of a scan on a data chunk):
+//   - SingleChunkPosList stores the chunk offsets (4 bytes per position),
+//   - ChunkRangePosList stores a contiguous range of offsets (no memory per position), and
+//   - BitmapPosList stores one bit per row of the referenced chunk, which is the smallest representation if many rows
+//     qualify.
+//
+// operator[] is virtual and intended for single accesses. Hot loops should use resolve_pos_list_type or
+// for_each_chunk_run to iterate over the positions with the iterators of the concrete type.
+class AbstractPosList : private Noncopyable {
+ public:
+  AbstractPosList() = default;
+  virtual ~AbstractPosList() = default;
+
+  // Returns the position at the given index.
+  virtual RowID operator[](const size_t index) const = 0;
+
+  // Returns the number of positions.
+  virtual size_t size() const = 0;
+
+  bool empty() const;
+
+  // Returns the chunk that all positions belong to. Returns INVALID_CHUNK_ID if the positions may belong to different
+  // chunks or contain NULL_ROW_IDs.
+  virtual ChunkID common_chunk_id() const = 0;
+
+  // Returns the number of bytes used to store the positions, excluding the constant size of the object itself.
+  virtual size_t memory_usage() const = 0;
+};
+
+// Position list that stores a full RowID per position. Positions may reference different chunks and may be NULL_ROW_ID.
+class PosList final : public AbstractPosList, private std::vector<RowID> {
+  using Vector = std::vector<RowID>;
+
+ public:
+  using Vector::Vector;
+  using AbstractPosList::empty;
+  using Vector::back;
+  using Vector::begin;
+  using Vector::capacity;
+  using Vector::cbegin;
+  using Vector::cend;
+  using Vector::clear;
+  using Vector::const_iterator;
+  using Vector::data;
+  using Vector::emplace_back;
+  using Vector::end;
+  using Vector::front;
+  using Vector::insert;
+  using Vector::iterator;
+  using Vector::push_back;
+  using Vector::reserve;
+  using Vector::resize;
+  using Vector::value_type;
+
+  RowID operator[](const size_t index) const final {
+    return Vector::operator[](index);
+  }
+
+  RowID& operator[](const size_t index) {
+    return Vector::operator[](index);
+  }
+
+  size_t size() const final {
+    return Vector::size();
+  }
+
+  ChunkID common_chunk_id() const final;
+
+  size_t memory_usage() const final;
+};
+
+// Position list that stores the offsets of positions within a single chunk.
+class SingleChunkPosList final : public AbstractPosList {
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = RowID;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = RowID;
+
+    Iterator() = default;
+    Iterator(const ChunkID chunk_id, std::vector<ChunkOffset>::const_iterator offset_it)
+        : _chunk_id{chunk_id}, _offset_it{offset_it} {}
+
+    RowID operator*() const {
+      return RowID{_chunk_id, *_offset_it};
+    }
+
+    RowID operator[](const difference_type distance) const {
+      return RowID{_chunk_id, _offset_it[distance]};
+    }
+
+    Iterator& operator++() {
+      ++_offset_it;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto previous = *this;
+      ++_offset_it;
+      return previous;
+    }
+
+    Iterator& operator--() {
+      --_offset_it;
+      return *this;
+    }
+
+    Iterator operator--(int) {
+      auto previous = *this;
+      --_offset_it;
+      return previous;
+    }
+
+    Iterator& operator+=(const difference_type distance) {
+      _offset_it += distance;
+      return *this;
+    }
+
+    Iterator& operator-=(const difference_type distance) {
+      _offset_it -= distance;
+      return *this;
+    }
+
+    Iterator operator+(const difference_type distance) const {
+      return Iterator{_chunk_id, _offset_it + distance};
+    }
+
+    friend Iterator operator+(const difference_type distance, const Iterator& iterator) {
+      return iterator + distance;
+    }
+
+    Iterator operator-(const difference_type distance) const {
+      return Iterator{_chunk_id, _offset_it - distance};
+    }
+
+    difference_type operator-(const Iterator& other) const {
+      return _offset_it - other._offset_it;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return _offset_it == other._offset_it;
+    }
+
+    auto operator<=>(const Iterator& other) const {
+      return _offset_it <=> other._offset_it;
+    }
+
+   private:
+    ChunkID _chunk_id{INVALID_CHUNK_ID};
+    std::vector<ChunkOffset>::const_iterator _offset_it;
+  };
+
+  SingleChunkPosList(const ChunkID chunk_id, std::vector<ChunkOffset>&& offsets);
+
+  RowID operator[](const size_t index) const final {
+    return RowID{_chunk_id, _offsets[index]};
+  }
+
+  size_t size() const final;
+
+  ChunkID common_chunk_id() const final;
+
+  size_t memory_usage() const final;
+
+  const std::vector<ChunkOffset>& offsets() const;
+
+  Iterator begin() const {
+    return Iterator{_chunk_id, _offsets.cbegin()};
+  }
+
+  // Returns the iterator to the position at the given index in O(1).
+  Iterator iterator_at(const size_t index) const {
+    return begin() + static_cast<std::ptrdiff_t>(index);
+  }
+
+  Iterator end() const {
+    return Iterator{_chunk_id, _offsets.cend()};
+  }
+
+ private:
+  const ChunkID _chunk_id;
+  const std::vector<ChunkOffset> _offsets;
+};
+
+// Position list that stores the contiguous offsets [begin_offset, end_offset) of a single chunk.
+class ChunkRangePosList final : public AbstractPosList {
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = RowID;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = RowID;
+
+    Iterator() = default;
+    Iterator(const ChunkID chunk_id, const ChunkOffset chunk_offset)
+        : _chunk_id{chunk_id}, _chunk_offset{chunk_offset} {}
+
+    RowID operator*() const {
+      return RowID{_chunk_id, _chunk_offset};
+    }
+
+    RowID operator[](const difference_type distance) const {
+      return *(*this + distance);
+    }
+
+    Iterator& operator++() {
+      ++_chunk_offset;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto previous = *this;
+      ++_chunk_offset;
+      return previous;
+    }
+
+    Iterator& operator--() {
+      --_chunk_offset;
+      return *this;
+    }
+
+    Iterator operator--(int) {
+      auto previous = *this;
+      --_chunk_offset;
+      return previous;
+    }
+
+    Iterator& operator+=(const difference_type distance) {
+      _chunk_offset = static_cast<ChunkOffset>(_chunk_offset + distance);
+      return *this;
+    }
+
+    Iterator& operator-=(const difference_type distance) {
+      _chunk_offset = static_cast<ChunkOffset>(_chunk_offset - distance);
+      return *this;
+    }
+
+    Iterator operator+(const difference_type distance) const {
+      return Iterator{_chunk_id, static_cast<ChunkOffset>(_chunk_offset + distance)};
+    }
+
+    friend Iterator operator+(const difference_type distance, const Iterator& iterator) {
+      return iterator + distance;
+    }
+
+    Iterator operator-(const difference_type distance) const {
+      return Iterator{_chunk_id, static_cast<ChunkOffset>(_chunk_offset - distance)};
+    }
+
+    difference_type operator-(const Iterator& other) const {
+      return static_cast<difference_type>(_chunk_offset) - static_cast<difference_type>(other._chunk_offset);
+    }
+
+    bool operator==(const Iterator& other) const {
+      return _chunk_offset == other._chunk_offset;
+    }
+
+    auto operator<=>(const Iterator& other) const {
+      return _chunk_offset <=> other._chunk_offset;
+    }
+
+   private:
+    ChunkID _chunk_id{INVALID_CHUNK_ID};
+    ChunkOffset _chunk_offset{0};
+  };
+
+  ChunkRangePosList(const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
+  RowID operator[](const size_t index) const final {
+    return RowID{_chunk_id, static_cast<ChunkOffset>(_begin_offset + index)};
+  }
+
+  size_t size() const final;
+
+  ChunkID common_chunk_id() const final;
+
+  size_t memory_usage() const final;
+
+  Iterator begin() const {
+    return Iterator{_chunk_id, _begin_offset};
+  }
+
+  // Returns the iterator to the position at the given index in O(1).
+  Iterator iterator_at(const size_t index) const {
+    return Iterator{_chunk_id, static_cast<ChunkOffset>(_begin_offset + index)};
+  }
+
+  Iterator end() const {
+    return Iterator{_chunk_id, _end_offset};
+  }
+
+ private:
+  const ChunkID _chunk_id;
+  const ChunkOffset _begin_offset;
+  const ChunkOffset _end_offset;
+};
+
+// Position list that stores one bit per row of a single chunk. The positions are the set bits in ascending order.
+class BitmapPosList final : public AbstractPosList {
+ public:
+  static constexpr auto BITS_PER_WORD = size_t{64};
+
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = RowID;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = RowID;
+
+    Iterator() = default;
+    Iterator(const ChunkID chunk_id, const std::vector<uint64_t>* words, const size_t word_index)
+        : _chunk_id{chunk_id}, _words{words}, _word_index{word_index} {
+      _skip_empty_words();
+    }
+
+    // Points to the lowest set bit of word, which holds the bits of the word at word_index that were not visited yet.
+    Iterator(const ChunkID chunk_id, const std::vector<uint64_t>* words, const size_t word_index, const uint64_t word)
+        : _chunk_id{chunk_id}, _words{words}, _word_index{word_index}, _word{word} {
+      DebugAssert(word, "The word needs to contain the position.");
+    }
+
+    RowID operator*() const {
+      return RowID{_chunk_id, static_cast<ChunkOffset>(_word_index * BITS_PER_WORD + std::countr_zero(_word))};
+    }
+
+    Iterator& operator++() {
+      // Clear the lowest set bit.
+      _word &= _word - 1;
+      if (!_word) {
+        ++_word_index;
+        _skip_empty_words();
+      }
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto previous = *this;
+      ++(*this);
+      return previous;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return _word_index == other._word_index && _word == other._word;
+    }
+
+   private:
+    void _skip_empty_words() {
+      const auto word_count = _words->size();
+      while (_word_index < word_count && !(*_words)[_word_index]) {
+        ++_word_index;
+      }
+      _word = _word_index < word_count ? (*_words)[_word_index] : 0;
+    }
+
+    ChunkID _chunk_id{INVALID_CHUNK_ID};
+    const std::vector<uint64_t>* _words{nullptr};
+    size_t _word_index{0};
+    // The bits of the current word that have not been visited yet.
+    uint64_t _word{0};
+  };
+
+  // Bit i of words[i / 64] (counted from the least significant bit) marks whether chunk offset i is part of the list.
+  BitmapPosList(const ChunkID chunk_id, std::vector<uint64_t>&& words);
+
+  // Looks up the word containing the index-th set bit via binary search.
+  RowID operator[](const size_t index) const final;
+
+  // Returns the iterator to the position at the given index (or end() for size()) in O(log n), like operator[].
+  Iterator iterator_at(const size_t index) const;
+
+  size_t size() const final;
+
+  ChunkID common_chunk_id() const final;
+
+  size_t memory_usage() const final;
+
+  Iterator begin() const {
+    return Iterator{_chunk_id, &_words, 0};
+  }
+
+  Iterator end() const {
+    return Iterator{_chunk_id, &_words, _words.size()};
+  }
+
+ private:
+  const ChunkID _chunk_id;
+  const std::vector<uint64_t> _words;
+  // Number of set bits in all words before the word at the same index. Used to find a position in O(log n).
+  std::vector<uint32_t> _preceding_bit_counts;
+  size_t _size{0};
+};
+
+// Creates the smallest position list for the given ascending offsets of a chunk with chunk_size rows.
+std::shared_ptr<const AbstractPosList> make_single_chunk_pos_list(const ChunkID chunk_id,
+                                                                  std::vector<ChunkOffset>&& offsets,
+                                                                  const ChunkOffset chunk_size);
+
+// Calls the functor with the concrete type of the position list, so that the functor can iterate over the positions
+// without virtual calls.
+template <typename Functor>
+void resolve_pos_list_type(const AbstractPosList& pos_list, const Functor& functor) {
+  if (const auto* row_id_pos_list = dynamic_cast<const PosList*>(&pos_list)) {
+    functor(*row_id_pos_list);
+  } else if (const auto* single_chunk_pos_list = dynamic_cast<const SingleChunkPosList*>(&pos_list)) {
+    functor(*single_chunk_pos_list);
+  } else if (const auto* chunk_range_pos_list = dynamic_cast<const ChunkRangePosList*>(&pos_list)) {
+    functor(*chunk_range_pos_list);
+  } else if (const auto* bitmap_pos_list = dynamic_cast<const BitmapPosList*>(&pos_list)) {
+    functor(*bitmap_pos_list);
+  } else {
+    Fail("Unknown position list type.");
+  }
+}
+
+// Calls functor(chunk_id, begin, end, first_index) for each run of consecutive positions that reference the same
+// chunk, where [begin, end) are iterators of the concrete position list type and first_index is the index of the run's
+// first position. Runs of NULL_ROW_IDs are passed with INVALID_CHUNK_ID. Consumers can thus resolve the referenced
+// segment once per run instead of once per position. Only the positions [begin_index, end_index) are visited.
+template <typename Functor>
+void for_each_chunk_run(const AbstractPosList& pos_list, const size_t begin_index, const size_t end_index,
+                        const Functor& functor) {
+  DebugAssert(begin_index <= end_index && end_index <= pos_list.size(), "Invalid position range.");
+  if (begin_index == end_index) {
+    return;
+  }
+
+  resolve_pos_list_type(pos_list, [&](const auto& typed_pos_list) {
+    using PosListType = std::decay_t<decltype(typed_pos_list)>;
+
+    if constexpr (std::is_same_v<PosListType, PosList>) {
+      auto run_begin = begin_index;
+      while (run_begin < end_index) {
+        const auto chunk_id = typed_pos_list[run_begin].chunk_id;
+        auto run_end = run_begin + 1;
+        while (run_end < end_index && typed_pos_list[run_end].chunk_id == chunk_id) {
+          ++run_end;
+        }
+
+        functor(chunk_id, typed_pos_list.cbegin() + run_begin, typed_pos_list.cbegin() + run_end, run_begin);
+        run_begin = run_end;
+      }
+    } else {
+      // All positions of the other position lists belong to the same chunk. They seek to the range's bounds without
+      // walking from their first position.
+      functor(typed_pos_list.common_chunk_id(), typed_pos_list.iterator_at(begin_index),
+              typed_pos_list.iterator_at(end_index), begin_index);
+    }
+  });
+}
+
+// Same as above for all positions of the list.
+template <typename Functor>
+void for_each_chunk_run(const AbstractPosList& pos_list, const Functor& functor) {
+  for_each_chunk_run(pos_list, 0, pos_list.size(), functor);
+}
+
+}  // namespace opossum
@@ -6,11 +6,16 @@
 namespace opossum {
 
 ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table>& referenced_table,
-                                   const ColumnID referenced_column_id, const std::shared_ptr<const PosList>& pos)
-    : _referenced_table{referenced_table}, _referenced_column_id{referenced_column_id}, _pos_list{pos} {}
+                                   const ColumnID referenced_column_id,
+                                   const std::shared_ptr<const AbstractPosList>& pos)
+    : AbstractSegment{SegmentEncoding::Reference, referenced_table->column_data_type(referenced_column_id)},
+      _referenced_table{referenced_table},
+      _referenced_column_id{referenced_column_id},
+      _pos_list{pos} {}
 
 AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
-  const auto row_id = _pos_list->at(chunk_offset);
+  DebugAssert(chunk_offset < _pos_list->size(), "Out of bounds.");
+  const auto row_id = (*_pos_list)[chunk_offset];
 
   if (row_id.is_null()) {
     return NULL_VALUE;
@@ -25,7 +30,7 @@ ChunkOffset ReferenceSegment::size() const {
   return _pos_list->size();
 }
 
-const std::shared_ptr<const PosList>& ReferenceSegment::pos_list() const {
+const std::shared_ptr<const AbstractPosList>& ReferenceSegment::pos_list() const {
   return _pos_list;
 }
 
@@ -38,7 +43,7 @@ ColumnID ReferenceSegment::referenced_column_id() const {
 }
 
 size_t ReferenceSegment::estimate_memory_usage() const {
-  return _pos_list->capacity() * sizeof(RowID);
+  return _pos_list->memory_usage();
 }
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "abstract_segment.hpp"
+#include "pos_list.hpp"
 
 namespace opossum {
 
@@ -11,24 +12,25 @@ class ReferenceSegment : public AbstractSegment {
  public:
   // Creates a reference segment. The parameters specify the positions and the referenced column.
   ReferenceSegment(const std::shared_ptr<const Table>& referenced_table, const ColumnID referenced_column_id,
-                   const std::shared_ptr<const PosList>& pos);
+                   const std::shared_ptr<const AbstractPosList>& pos);
 
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
 
   ChunkOffset size() const override;
 
-  const std::shared_ptr<const PosList>& pos_list() const;
+  const std::shared_ptr<const AbstractPosList>& pos_list() const;
 
   const std::shared_ptr<const Table>& referenced_table() const;
 
   ColumnID referenced_column_id() const;
 
+  // Returns the memory used by the position list, which depends on its representation.
   size_t estimate_memory_usage() const final;
 
  private:
   std::shared_ptr<const Table> _referenced_table;
   const ColumnID _referenced_column_id;
-  std::shared_ptr<const PosList> _pos_list;
+  std::shared_ptr<const AbstractPosList> _pos_list;
 };
 
 }  // namespace opossum
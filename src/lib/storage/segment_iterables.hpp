@@ -0,0 +1,222 @@
+#pragma once
+
+#include <iterator>
+
+#include "chunk.hpp"
+#include "dictionary_segment.hpp"
+#include "fixed_width_integer_vector.hpp"
+#include "pos_list.hpp"
+#include "reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "table.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// Segment iterables visit the rows of a segment whose concrete type is resolved once per segment, instead of calling
+// the virtual AbstractSegment::operator[] and boxing each value into an AllTypeVariant. Use resolve_segment_iterable
+// (or segment_iterate) to dispatch on the segment type:
+//
+//   segment_iterate<T>(segment, [&](const SegmentPosition<T>& position) {
+//     if (!position.is_null) {
+//       process(position.chunk_offset, position.value);
+//     }
+//   });
+//
+// All iterables iterate sequentially over a range of the segment with for_each. The iterables of data segments
+// additionally visit the rows of a position list with for_each_at_rows.
+
+// A row visited by a segment iterable. For sequential iterations, chunk_offset is the row's offset in the segment. For
+// iterations over the rows of a position list, it is the row's index in the list (counted from a given first
+// position). The value of NULLs is T{}. value refers into the segment and stays valid as long as the segment does.
+template <typename T>
+struct SegmentPosition {
+  const T& value;
+  bool is_null;
+  ChunkOffset chunk_offset;
+};
+
+// Number of rows that for_each_at_rows prefetches ahead.
+constexpr auto SEGMENT_PREFETCH_DISTANCE = std::ptrdiff_t{16};
+
+// Prefetches the entry of values for the row SEGMENT_PREFETCH_DISTANCE rows ahead of row_it. Only rows with
+// random-access iterators (i.e., of a PosList) may be in random order. The rows of the other position lists are
+// ascending, which the hardware prefetcher recognizes by itself.
+template <typename RowIterator, typename Values>
+void prefetch_segment_value(const RowIterator row_it, const RowIterator rows_end, const Values& values) {
+  if constexpr (std::random_access_iterator<RowIterator>) {
+    if (rows_end - row_it > SEGMENT_PREFETCH_DISTANCE) {
+      __builtin_prefetch(&values[(*(row_it + SEGMENT_PREFETCH_DISTANCE)).chunk_offset]);
+    }
+  }
+}
+
+template <typename T>
+class ValueSegmentIterable {
+ public:
+  explicit ValueSegmentIterable(const ValueSegment<T>& segment) : _segment{segment} {}
+
+  // Calls functor(position) for the rows [begin_offset, end_offset).
+  template <typename Functor>
+  void for_each(const ChunkOffset begin_offset, const ChunkOffset end_offset, const Functor& functor) const {
+    const auto& values = _segment.values();
+    if (!_segment.is_nullable()) {
+      for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+        functor(SegmentPosition<T>{values[chunk_offset], false, chunk_offset});
+      }
+      return;
+    }
+
+    const auto& null_values = _segment.null_values();
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+      functor(SegmentPosition<T>{values[chunk_offset], null_values[chunk_offset], chunk_offset});
+    }
+  }
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    for_each(ChunkOffset{0}, _segment.size(), functor);
+  }
+
+  // Calls functor(position) for the rows [rows_begin, rows_end) of a position list, whose chunk ids are ignored.
+  template <typename RowIterator, typename Functor>
+  void for_each_at_rows(const RowIterator rows_begin, const RowIterator rows_end, const ChunkOffset first_position,
+                        const Functor& functor) const {
+    const auto& values = _segment.values();
+    const auto* null_values = _segment.is_nullable() ? &_segment.null_values() : nullptr;
+    auto position = first_position;
+    for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++position) {
+      prefetch_segment_value(row_it, rows_end, values);
+      const auto chunk_offset = (*row_it).chunk_offset;
+      functor(SegmentPosition<T>{values[chunk_offset], null_values && (*null_values)[chunk_offset], position});
+    }
+  }
+
+ private:
+  const ValueSegment<T>& _segment;
+};
+
+template <typename T>
+class DictionarySegmentIterable {
+ public:
+  explicit DictionarySegmentIterable(const DictionarySegment<T>& segment) : _segment{segment} {}
+
+  // Calls functor(position) for the rows [begin_offset, end_offset).
+  template <typename Functor>
+  void for_each(const ChunkOffset begin_offset, const ChunkOffset end_offset, const Functor& functor) const {
+    const auto rows = ChunkRangePosList{ChunkID{0}, begin_offset, end_offset};
+    for_each_at_rows(rows.begin(), rows.end(), begin_offset, functor);
+  }
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    for_each(ChunkOffset{0}, _segment.size(), functor);
+  }
+
+  // Calls functor(position) for the rows [rows_begin, rows_end) of a position list, whose chunk ids are ignored.
+  template <typename RowIterator, typename Functor>
+  void for_each_at_rows(const RowIterator rows_begin, const RowIterator rows_end, const ChunkOffset first_position,
+                        const Functor& functor) const {
+    const auto& dictionary = _segment.dictionary();
+    const auto null_value_id = _segment.null_value_id();
+    resolve_attribute_vector(*_segment.attribute_vector(), [&](const auto& attribute_vector) {
+      const auto& value_ids = attribute_vector.values();
+      auto position = first_position;
+      for (auto row_it = rows_begin; row_it != rows_end; ++row_it, ++position) {
+        prefetch_segment_value(row_it, rows_end, value_ids);
+        const auto value_id = value_ids[(*row_it).chunk_offset];
+        if (value_id == null_value_id) {
+          functor(SegmentPosition<T>{_null_value, true, position});
+        } else {
+          functor(SegmentPosition<T>{dictionary[value_id], false, position});
+        }
+      }
+    });
+  }
+
+ private:
+  static inline const T _null_value{};
+
+  const DictionarySegment<T>& _segment;
+};
+
+// Calls functor with the iterable of a value or dictionary segment.
+template <typename T, typename Functor>
+void resolve_data_segment_iterable(const AbstractSegment& segment, const Functor& functor) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      functor(ValueSegmentIterable<T>{typed_segment});
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      functor(DictionarySegmentIterable<T>{typed_segment});
+    } else {
+      Fail("Unsupported segment type.");
+    }
+  });
+}
+
+// Visits the referenced values. The referenced segment is resolved once per run of positions in the same chunk.
+template <typename T>
+class ReferenceSegmentIterable {
+ public:
+  explicit ReferenceSegmentIterable(const ReferenceSegment& segment) : _segment{segment} {}
+
+  // Calls functor(position) for the rows [begin_offset, end_offset).
+  template <typename Functor>
+  void for_each(const ChunkOffset begin_offset, const ChunkOffset end_offset, const Functor& functor) const {
+    const auto& referenced_table = *_segment.referenced_table();
+    const auto referenced_column_id = _segment.referenced_column_id();
+    const auto visit_run = [&](const ChunkID chunk_id, const auto rows_begin, const auto rows_end,
+                               const size_t first_index) {
+      if (chunk_id == INVALID_CHUNK_ID) {
+        const auto run_end = static_cast<ChunkOffset>(first_index + std::distance(rows_begin, rows_end));
+        for (auto position = static_cast<ChunkOffset>(first_index); position < run_end; ++position) {
+          functor(SegmentPosition<T>{_null_value, true, position});
+        }
+        return;
+      }
+
+      resolve_data_segment_iterable<T>(
+          *referenced_table.get_chunk(chunk_id)->get_segment(referenced_column_id), [&](const auto& iterable) {
+            iterable.for_each_at_rows(rows_begin, rows_end, static_cast<ChunkOffset>(first_index), functor);
+          });
+    };
+    for_each_chunk_run(*_segment.pos_list(), begin_offset, end_offset, visit_run);
+  }
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    for_each(ChunkOffset{0}, _segment.size(), functor);
+  }
+
+ private:
+  static inline const T _null_value{};
+
+  const ReferenceSegment& _segment;
+};
+
+// Calls functor with the iterable of the segment's concrete type.
+template <typename T, typename Functor>
+void resolve_segment_iterable(const AbstractSegment& segment, const Functor& functor) {
+  if (segment.encoding() == SegmentEncoding::Reference) {
+    functor(ReferenceSegmentIterable<T>{static_cast<const ReferenceSegment&>(segment)});
+  } else {
+    resolve_data_segment_iterable<T>(segment, functor);
+  }
+}
+
+// Calls functor(position) for the rows [begin_offset, end_offset) of the segment.
+template <typename T, typename Functor>
+void segment_iterate(const AbstractSegment& segment, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                     const Functor& functor) {
+  resolve_segment_iterable<T>(segment,
+                              [&](const auto& iterable) { iterable.for_each(begin_offset, end_offset, functor); });
+}
+
+// Calls functor(position) for all rows of the segment.
+template <typename T, typename Functor>
+void segment_iterate(const AbstractSegment& segment, const Functor& functor) {
+  segment_iterate<T>(segment, ChunkOffset{0}, segment.size(), functor);
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "segment_iterables.hpp"
+
+namespace opossum {
+
+// Value and NULL callbacks on top of the segment iterables (see segment_iterables.hpp) for operators that handle NULLs
+// separately.
+
+// Calls functor(position, value) for each non-NULL value and null_functor(position) for each NULL at the given rows of
+// a value or dictionary segment. The chunk ids of the rows are ignored. Positions are counted from first_position on.
+template <typename T, typename RowIterator, typename Functor, typename NullFunctor>
+void for_each_segment_value_at_rows(const AbstractSegment& segment, const RowIterator rows_begin,
+                                    const RowIterator rows_end, const ChunkOffset first_position,
+                                    const Functor& functor, const NullFunctor& null_functor) {
+  resolve_data_segment_iterable<T>(segment, [&](const auto& iterable) {
+    iterable.for_each_at_rows(rows_begin, rows_end, first_position, [&](const SegmentPosition<T>& position) {
+      if (position.is_null) {
+        null_functor(position.chunk_offset);
+      } else {
+        functor(position.chunk_offset, position.value);
+      }
+    });
+  });
+}
+
+// Calls functor(chunk_offset, value) for each non-NULL value and null_functor(chunk_offset) for each NULL of the
+// rows [begin_offset, end_offset) of the segment, which may be a reference segment. The values are passed as references
+// into the data segments, so they stay valid as long as the referenced segments do.
+template <typename T, typename Functor, typename NullFunctor>
+void for_each_segment_value_in_range(const AbstractSegment& segment, const ChunkOffset begin_offset,
+                                     const ChunkOffset end_offset, const Functor& functor,
+                                     const NullFunctor& null_functor) {
+  segment_iterate<T>(segment, begin_offset, end_offset, [&](const SegmentPosition<T>& position) {
+    if (position.is_null) {
+      null_functor(position.chunk_offset);
+    } else {
+      functor(position.chunk_offset, position.value);
+    }
+  });
+}
+
+// Same as above for all rows of the segment.
+template <typename T, typename Functor, typename NullFunctor>
+void for_each_segment_value(const AbstractSegment& segment, const Functor& functor, const NullFunctor& null_functor) {
+  for_each_segment_value_in_range<T>(segment, ChunkOffset{0}, segment.size(), functor, null_functor);
+}
+
+}  // namespace opossum
@@ -1,4 +1,6 @@
+#include <atomic>
 #include <thread>
+#include <unordered_set>
 
 #include "algorithm"
 #include "dictionary_segment.hpp"
@@ -6,9 +8,15 @@
 #include "table.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+auto next_table_id = std::atomic<uint64_t>{0};
+
+}  // namespace
+
 namespace opossum {
 
-Table::Table(const ChunkOffset target_chunk_size) {
+Table::Table(const ChunkOffset target_chunk_size) : _id{next_table_id++} {
   _target_chunk_size = target_chunk_size;
   _chunks = std::vector<std::shared_ptr<Chunk>>{std::make_shared<Chunk>()};
 }
@@ -16,8 +24,10 @@ Table::Table(const ChunkOffset target_chunk_size) {
 Table::Table(const Table& other_table, const std::vector<std::shared_ptr<ReferenceSegment>>& reference_segments)
     : _column_names{other_table._column_names},
       _column_types{other_table._column_types},
+      _column_data_types{other_table._column_data_types},
       _column_nullable{other_table._column_nullable},
-      _target_chunk_size{other_table._target_chunk_size} {
+      _target_chunk_size{other_table._target_chunk_size},
+      _id{next_table_id++} {
   const auto number_chunks = reference_segments.size();
   _chunks.reserve(number_chunks);
 
@@ -34,7 +44,7 @@ Table::Table(const Table& other_table, const std::vector<std::shared_ptr<Referen
   if (number_chunks == 0) {
     auto output_chunk = std::make_shared<Chunk>();
     for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-      resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+      resolve_data_type(_column_data_types[column_id], [&](const auto data_type_t) {
         using ColumnDataType = typename decltype(data_type_t)::type;
         output_chunk->add_segment(std::make_shared<ValueSegment<ColumnDataType>>());
       });
@@ -46,19 +56,23 @@ Table::Table(const Table& other_table, const std::vector<std::shared_ptr<Referen
 void Table::add_column_definition(const std::string& name, const std::string& type, const bool nullable) {
   DebugAssert(_column_names.size() == _column_types.size() && _column_types.size() == _column_nullable.size(),
               "Columns are not well defined");
-  if (std::find(_column_names.begin(), _column_names.end(), name) != _column_names.end()) {
-    throw std::logic_error("It is not allowed to add two columns with the same name.");
-  }
-
+  // Parsing the type string may fail, so it is done before the column is added.
+  const auto data_type = data_type_from_string(type);
   _column_names.emplace_back(name);
   _column_types.emplace_back(type);
+  _column_data_types.emplace_back(data_type);
   _column_nullable.emplace_back(nullable);
+  _bump_version();
 }
 
 void Table::add_column(const std::string& name, const std::string& type, const bool nullable) {
   DebugAssert(_chunks[0]->size() == 0, "Adding columns is only allowed if the table does not have any entries.");
+  if (std::find(_column_names.begin(), _column_names.end(), name) != _column_names.end()) {
+    throw std::logic_error("It is not allowed to add two columns with the same name.");
+  }
+
   add_column_definition(name, type, nullable);
-  resolve_data_type(type, [&](const auto data_type_t) {
+  resolve_data_type(_column_data_types.back(), [&](const auto data_type_t) {
     using ColumnDataType = typename decltype(data_type_t)::type;
     const auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(nullable);
     _chunks[0]->add_segment(value_segment);
@@ -67,10 +81,11 @@ void Table::add_column(const std::string& name, const std::string& type, const b
 
 void Table::create_new_chunk() {
   _chunks.emplace_back(std::make_shared<Chunk>());
+  _bump_version();
 
   size_t num_columns = _column_types.size();
   for (unsigned int col_id = 0; col_id < num_columns; ++col_id) {
-    resolve_data_type(_column_types[col_id], [&](const auto data_type_t) {
+    resolve_data_type(_column_data_types[col_id], [&](const auto data_type_t) {
       using ColumnDataType = typename decltype(data_type_t)::type;
       const auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(_column_nullable[col_id]);
       _chunks.back()->add_segment(value_segment);
@@ -78,18 +93,23 @@ void Table::create_new_chunk() {
   }
 }
 
-void Table::append(const std::vector<AllTypeVariant>& values) {
-  auto is_dictionary_encoded = false;
-  resolve_data_type(_column_types[0], [this, &is_dictionary_encoded](const auto data_type_t) {
-    using ColumnDataType = typename decltype(data_type_t)::type;
-    auto segment = _chunks.back()->get_segment(ColumnID{0});
-    is_dictionary_encoded = static_cast<bool>(std::dynamic_pointer_cast<DictionarySegment<ColumnDataType>>(segment));
-  });
+void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
+  Assert(chunk->column_count() == column_count(), "Chunk needs to have one segment per column.");
+  _bump_version();
+  if (_chunks.size() == 1 && _chunks.back()->size() == 0) {
+    _chunks.back() = chunk;
+    return;
+  }
+
+  _chunks.push_back(chunk);
+}
 
-  if (_chunks.back()->size() == _target_chunk_size || is_dictionary_encoded) {
+void Table::append(const std::vector<AllTypeVariant>& values) {
+  if (_chunks.back()->size() == _target_chunk_size || _chunks.back()->is_immutable()) {
     create_new_chunk();
   }
   _chunks.back()->append(values);
+  _bump_version();
 }
 
 ColumnCount Table::column_count() const {
@@ -141,6 +161,13 @@ const std::string& Table::column_type(const ColumnID column_id) const {
   return _column_types[column_id];
 }
 
+DataType Table::column_data_type(const ColumnID column_id) const {
+  if (column_id >= _column_data_types.size()) {
+    throw std::logic_error("Table does not contain column with the requested id.");
+  }
+  return _column_data_types[column_id];
+}
+
 bool Table::column_nullable(const ColumnID column_id) const {
   if (column_id > _column_nullable.size()) {
     throw std::logic_error("Table does not contain column with the requested id.");
@@ -168,7 +195,7 @@ void Table::compress_chunk(const ChunkID chunk_id) {
   auto threads = std::vector<std::thread>(column_count());
 
   const auto compression_functor = [&](ColumnID column_id) {
-    resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+    resolve_data_type(_column_data_types[column_id], [&](const auto data_type_t) {
       using ColumnDataType = typename decltype(data_type_t)::type;
 
       auto value_segment = get_chunk(chunk_id)->get_segment(column_id);
@@ -186,6 +213,41 @@ void Table::compress_chunk(const ChunkID chunk_id) {
     compressed_chunk->add_segment(compressed_segments[thread_index]);
   }
   _chunks[chunk_id] = compressed_chunk;
+  _bump_version();
+}
+
+uint64_t Table::id() const {
+  return _id;
+}
+
+uint64_t Table::version() const {
+  return _version;
+}
+
+size_t Table::estimate_memory_usage() const {
+  auto memory_usage = size_t{0};
+  auto pos_lists = std::unordered_set<const AbstractPosList*>{};
+  for (const auto& chunk : _chunks) {
+    // Chunks and the segment objects themselves are counted as well, so that reference segments whose position lists
+    // do not store any positions (e.g., ChunkRangePosLists) are not free.
+    const auto column_count = chunk->column_count();
+    memory_usage += sizeof(Chunk) + column_count * sizeof(ReferenceSegment);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto segment = chunk->get_segment(column_id);
+      if (segment->encoding() == SegmentEncoding::Reference) {
+        const auto& pos_list = static_cast<const ReferenceSegment&>(*segment).pos_list();
+        if (!pos_lists.insert(pos_list.get()).second) {
+          continue;
+        }
+      }
+      memory_usage += segment->estimate_memory_usage();
+    }
+  }
+  return memory_usage;
+}
+
+void Table::_bump_version() {
+  ++_version;
 }
 
 }  // namespace opossum
@@ -45,6 +45,10 @@ class Table : private Noncopyable {
   // Returns the column type of the nth column.
   const std::string& column_type(const ColumnID column_id) const;
 
+  // Returns the column type of the nth column as DataType, which is parsed from the type string only once, when the
+  // column is defined. Use it to resolve the column's type.
+  DataType column_data_type(const ColumnID column_id) const;
+
   // Returns whether the nth column can contain NULL values.
   bool column_nullable(const ColumnID column_id) const;
 
@@ -56,13 +60,18 @@ class Table : private Noncopyable {
   ChunkOffset target_chunk_size() const;
 
   // Adds column definition without creating the actual columns. This is helpful when, e.g., an operator first creates
-  // the structure of the table and then adds chunk by chunk.
+  // the structure of the table and then adds chunk by chunk. Other than add_column, this does not reject duplicate
+  // column names, as operators such as joins may combine tables with identically named columns.
   void add_column_definition(const std::string& name, const std::string& type, const bool nullable);
 
   // Adds a column to the end, i.e., right, of the table. This can only be done if the table does not yet have any
   // entries, because we would otherwise have to deal with default values.
   void add_column(const std::string& name, const std::string& type, const bool nullable);
 
+  // Appends a chunk that holds one segment per column. If the table only consists of its initial empty chunk, that
+  // chunk is replaced. Operators use this to add their output chunk by chunk.
+  void append_chunk(const std::shared_ptr<Chunk>& chunk);
+
   // Inserts a row at the end of the table. Note this is slow and not thread-safe and should be used for testing
   // purposes only.
   void append(const std::vector<AllTypeVariant>& values);
@@ -73,12 +82,30 @@ class Table : private Noncopyable {
   // Compresses a ValueColumn into a DictionaryColumn.
   void compress_chunk(const ChunkID chunk_id);
 
+  // Returns an id that is unique across all tables of the process. Together with the version, it identifies the table
+  // and its contents (e.g., for the ResultCache).
+  uint64_t id() const;
+
+  // Returns the version of the table's contents, which is increased whenever the table is modified through its methods
+  // (e.g., append or compress_chunk, but not when chunks are modified directly).
+  uint64_t version() const;
+
+  // Returns the estimated number of bytes that the table's chunks and segments use. Position lists that are shared by
+  // multiple reference segments are counted once.
+  size_t estimate_memory_usage() const;
+
  protected:
+  // Increases the version of the table.
+  void _bump_version();
+
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
+  std::vector<DataType> _column_data_types;
   std::vector<bool> _column_nullable;
   unsigned int _target_chunk_size;
+  const uint64_t _id;
+  uint64_t _version = 0;
 };
 
 }  // namespace opossum
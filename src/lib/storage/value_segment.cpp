@@ -6,12 +6,20 @@
 namespace opossum {
 
 template <typename T>
-ValueSegment<T>::ValueSegment(bool nullable) {
+ValueSegment<T>::ValueSegment(bool nullable) : AbstractSegment{SegmentEncoding::Unencoded, data_type_of<T>} {
   if (nullable) {
     _null_values = std::vector<bool>();
   }
 }
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::vector<T>&& values, std::optional<std::vector<bool>>&& null_values)
+    : AbstractSegment{SegmentEncoding::Unencoded, data_type_of<T>},
+      _values{std::move(values)},
+      _null_values{std::move(null_values)} {
+  Assert(!_null_values || _null_values->size() == _values.size(), "Values and NULL values must have the same size.");
+}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   DebugAssert(chunk_offset < size(), "Out of bounds.");
@@ -10,6 +10,9 @@ class ValueSegment : public AbstractSegment {
  public:
   explicit ValueSegment(bool nullable = false);
 
+  // Creates a segment that holds the given values. The segment is nullable if null_values are given.
+  explicit ValueSegment(std::vector<T>&& values, std::optional<std::vector<bool>>&& null_values = std::nullopt);
+
   // Returns the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
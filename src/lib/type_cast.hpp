@@ -1,60 +1,110 @@
 #pragma once
 
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+
 #include <boost/hana/contains.hpp>
-#include <boost/hana/integral_constant.hpp>
-#include <boost/hana/not_equal.hpp>
-#include <boost/hana/size.hpp>
-#include <boost/hana/take_while.hpp>
-#include <boost/lexical_cast.hpp>
 
 #include "all_type_variant.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
 namespace hana = boost::hana;
 
-namespace detail {
-
-// Returns the index of type T in an Iterable
-template <typename Sequence, typename T>
-constexpr auto index_of(Sequence const& sequence, T const& element) {
-  constexpr auto size = decltype(hana::size(hana::take_while(sequence, hana::not_equal.to(element)))){};
-  return static_cast<size_t>(decltype(size)::value);
-}
-
-}  // namespace detail
-
 // Retrieves the value stored in an AllTypeVariant without conversion
 template <typename T>
 const T& get(const AllTypeVariant& value) {
   static_assert(hana::contains(types_including_null, hana::type_c<T>), "Type not in AllTypeVariant");
-  return boost::get<T>(value);
+  return std::get<T>(value);
 }
 
-// cast methods - from variant to specific type
+namespace detail {
+
+// Converts a number to another numeric type. Fails if the value is out of the range of T, so that, e.g., large longs
+// are not silently wrapped around when converted to ints. Floating-point numbers are truncated towards zero.
+template <typename T, typename Source>
+T cast_number(const Source number) {
+  if constexpr (std::is_integral_v<T> && std::is_integral_v<Source>) {
+    if (!std::in_range<T>(number)) {
+      Fail("Value " + std::to_string(number) + " is out of the range of the target type.");
+    }
+  } else if constexpr (std::is_integral_v<T>) {
+    // The minimum of a signed integer type is -2^(n-1), which floating-point numbers represent exactly. NaN fails both
+    // comparisons.
+    constexpr auto lower_bound = static_cast<double>(std::numeric_limits<T>::min());
+    const auto truncated = std::trunc(static_cast<double>(number));
+    if (!(truncated >= lower_bound && truncated < -lower_bound)) {
+      Fail("Value " + std::to_string(number) + " is out of the range of the target type.");
+    }
+  } else if constexpr (std::is_floating_point_v<Source> && sizeof(T) < sizeof(Source)) {
+    if (std::isfinite(number) && std::abs(number) > std::numeric_limits<T>::max()) {
+      Fail("Value " + std::to_string(number) + " is out of the range of the target type.");
+    }
+  }
+  return static_cast<T>(number);
+}
 
-// Template specialization for everything but integral types
+// Parses a number. Integers can also be given as floating-point numbers, which are truncated (e.g., "3.7" is 3).
 template <typename T>
-std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (static_cast<size_t>(value.which()) == detail::index_of(types_including_null, hana::type_c<T>)) {
-    return get<T>(value);
+T parse_number(const std::string& string) {
+  const auto* const end = string.data() + string.size();
+  auto number = T{};
+  const auto [parse_end, error] = std::from_chars(string.data(), end, number);
+  if (error == std::errc{} && parse_end == end) {
+    return number;
   }
 
-  return boost::lexical_cast<T>(value);
+  // Integers that are out of range or given as floating-point numbers are parsed as doubles, which cast_number
+  // truncates or rejects.
+  if constexpr (std::is_integral_v<T>) {
+    return cast_number<T>(parse_number<double>(string));
+  }
+  Fail("Cannot convert '" + string + "' to a number.");
 }
 
-// Template specialization for integral types
+// Prints a number in its shortest representation that parses back to the same value.
 template <typename T>
-std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (static_cast<size_t>(value.which()) == detail::index_of(types_including_null, hana::type_c<T>)) {
-    return get<T>(value);
-  }
+std::string print_number(const T number) {
+  auto buffer = std::array<char, 32>{};
+  const auto [end, error] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), number);
+  DebugAssert(error == std::errc{}, "Number does not fit into the buffer.");
+  return std::string(buffer.data(), end);
+}
+
+}  // namespace detail
+
+// cast methods - from a value or a variant to a specific type
 
-  try {
-    return boost::lexical_cast<T>(value);
-  } catch (...) {
-    return boost::numeric_cast<T>(boost::lexical_cast<double>(value));
+// Converts a value of one of the data types to T. Numbers are converted with a static_cast, so floating-point numbers
+// are truncated towards zero. Values that are out of the range of T cannot be converted. Strings are parsed and
+// printed with std::from_chars and std::to_chars. Only conversions to strings allocate. NULL values cannot be
+// converted.
+template <typename T, typename Source>
+T type_cast(const Source& value) {
+  if constexpr (std::is_same_v<T, Source>) {
+    return value;
+  } else if constexpr (std::is_same_v<Source, NullValue>) {
+    Fail("Cannot convert NULL to a value.");
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    return detail::print_number(value);
+  } else if constexpr (std::is_same_v<Source, std::string>) {
+    return detail::parse_number<T>(value);
+  } else {
+    return detail::cast_number<T>(value);
   }
 }
 
+// Same as above, but converts the value held by the variant. The type of the value is resolved with a jump table,
+// so that each combination of held type and T has its own direct conversion.
+template <typename T>
+T type_cast(const AllTypeVariant& value) {
+  return std::visit([](const auto& held_value) { return type_cast<T>(held_value); }, value);
+}
+
 }  // namespace opossum
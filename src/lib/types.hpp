@@ -32,6 +32,7 @@ STRONG_TYPEDEF(uint32_t, ChunkID);
 STRONG_TYPEDEF(uint16_t, ColumnID);
 STRONG_TYPEDEF(opossum::ColumnID::base_type, ColumnCount);
 STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
+STRONG_TYPEDEF(uint16_t, ParameterID);
 
 namespace opossum {
 
@@ -69,9 +70,38 @@ constexpr RowID NULL_ROW_ID = RowID{INVALID_CHUNK_ID, INVALID_CHUNK_OFFSET};
 // types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max().
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
-enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
+// OpLike and OpNotLike are only supported on string columns. See LikeMatcher for the supported pattern syntax.
+// OpIsNull and OpIsNotNull ignore the search value.
+enum class ScanType {
+  OpEquals,
+  OpNotEquals,
+  OpLessThan,
+  OpLessThanEquals,
+  OpGreaterThan,
+  OpGreaterThanEquals,
+  OpLike,
+  OpNotLike,
+  OpIsNull,
+  OpIsNotNull
+};
+
+// Inner joins return all pairs of matching rows. Left joins additionally return the rows of the left input without a
+// join partner, with NULLs for the columns of the right input. Semi and Anti joins only return the columns of the
+// left input, namely the rows that have at least one (Semi) or no join partner (Anti). As in SQL's NOT EXISTS, rows
+// with a NULL join value are part of the Anti join's result.
+enum class JoinMode { Inner, Left, Semi, Anti };
+
+// As in SQL, all aggregate functions but Count on all rows (COUNT(*)) ignore NULL values. Sum, Min, Max, and Avg
+// return NULL for groups without any non-NULL value.
+enum class AggregateFunction { Count, CountDistinct, Sum, Min, Max, Avg };
+
+// Sort order of a column. NULLs are placed before or after all other values independently of the sort order.
+enum class SortMode { Ascending, Descending };
+enum class NullsPosition { First, Last };
 
-using PosList = std::vector<RowID>;
+// Encoding of a segment. Unencoded segments are ValueSegments. Reference segments do not store values themselves but
+// refer to those of another table.
+enum class SegmentEncoding : uint8_t { Unencoded, Dictionary, Reference };
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
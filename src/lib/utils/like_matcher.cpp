@@ -0,0 +1,142 @@
+#include "like_matcher.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace opossum {
+
+LikeMatcher::LikeMatcher(const std::string& pattern) : _pattern{pattern} {
+  if (_pattern.find('_') != std::string::npos) {
+    _pattern_type = PatternType::Generic;
+    return;
+  }
+
+  const auto first_literal_char = _pattern.find_first_not_of('%');
+  if (first_literal_char == std::string::npos) {
+    // The pattern is empty or consists of '%' only. An empty pattern only matches the empty string, while "%" matches
+    // everything and can therefore be treated as an empty prefix.
+    _pattern_type = _pattern.empty() ? PatternType::Exact : PatternType::Prefix;
+    return;
+  }
+
+  const auto last_literal_char = _pattern.find_last_not_of('%');
+  _literal = _pattern.substr(first_literal_char, last_literal_char - first_literal_char + 1);
+  if (_literal.find('%') != std::string::npos) {
+    _pattern_type = PatternType::Generic;
+    return;
+  }
+
+  const auto has_leading_wildcard = first_literal_char > 0;
+  const auto has_trailing_wildcard = last_literal_char + 1 < _pattern.size();
+  if (has_leading_wildcard && has_trailing_wildcard) {
+    _pattern_type = PatternType::Contains;
+  } else if (has_leading_wildcard) {
+    _pattern_type = PatternType::Suffix;
+  } else if (has_trailing_wildcard) {
+    _pattern_type = PatternType::Prefix;
+  } else {
+    _pattern_type = PatternType::Exact;
+  }
+}
+
+bool LikeMatcher::matches(const std::string_view value) const {
+  switch (_pattern_type) {
+    case PatternType::Exact:
+      return value == _literal;
+    case PatternType::Prefix:
+      return value.starts_with(_literal);
+    case PatternType::Suffix:
+      return value.ends_with(_literal);
+    case PatternType::Contains:
+      return _contains(value);
+    case PatternType::Generic:
+      return _matches_generic(value);
+  }
+  return false;
+}
+
+std::optional<std::string> LikeMatcher::prefix() const {
+  if (_pattern_type != PatternType::Prefix) {
+    return std::nullopt;
+  }
+  return _literal;
+}
+
+std::optional<std::string> LikeMatcher::next_prefix(const std::string& prefix) {
+  auto next = prefix;
+
+  // Characters are compared as unsigned chars, so '\xFF' cannot be incremented and is dropped instead.
+  while (!next.empty() && static_cast<unsigned char>(next.back()) == std::numeric_limits<unsigned char>::max()) {
+    next.pop_back();
+  }
+
+  if (next.empty()) {
+    return std::nullopt;
+  }
+
+  next.back() = static_cast<char>(static_cast<unsigned char>(next.back()) + 1);
+  return next;
+}
+
+bool LikeMatcher::_contains(const std::string_view value) const {
+  const auto literal_size = _literal.size();
+  if (value.size() < literal_size) {
+    return false;
+  }
+
+  // std::memchr is vectorized by common standard libraries. We use it to jump to the next occurrence of the literal's
+  // first character and only compare the remaining characters at these candidate positions.
+  const auto first_char = _literal.front();
+  const auto* search_begin = value.data();
+  const auto* const last_candidate = value.data() + (value.size() - literal_size);
+  while (search_begin <= last_candidate) {
+    const auto* const candidate = static_cast<const char*>(
+        std::memchr(search_begin, first_char, static_cast<size_t>(last_candidate - search_begin) + 1));
+    if (!candidate) {
+      return false;
+    }
+
+    if (std::memcmp(candidate + 1, _literal.data() + 1, literal_size - 1) == 0) {
+      return true;
+    }
+    search_begin = candidate + 1;
+  }
+
+  return false;
+}
+
+bool LikeMatcher::_matches_generic(const std::string_view value) const {
+  // Greedy matching that backtracks to the most recent '%' on a mismatch. Each '%' is only revisited with a growing
+  // value position, so the matching does not explode for patterns with many wildcards.
+  const auto value_size = value.size();
+  const auto pattern_size = _pattern.size();
+  auto value_position = size_t{0};
+  auto pattern_position = size_t{0};
+  auto wildcard_position = std::string::npos;
+  auto wildcard_value_position = size_t{0};
+
+  while (value_position < value_size) {
+    if (pattern_position < pattern_size &&
+        (_pattern[pattern_position] == '_' || _pattern[pattern_position] == value[value_position])) {
+      ++pattern_position;
+      ++value_position;
+    } else if (pattern_position < pattern_size && _pattern[pattern_position] == '%') {
+      wildcard_position = pattern_position;
+      wildcard_value_position = value_position;
+      ++pattern_position;
+    } else if (wildcard_position != std::string::npos) {
+      pattern_position = wildcard_position + 1;
+      ++wildcard_value_position;
+      value_position = wildcard_value_position;
+    } else {
+      return false;
+    }
+  }
+
+  while (pattern_position < pattern_size && _pattern[pattern_position] == '%') {
+    ++pattern_position;
+  }
+  return pattern_position == pattern_size;
+}
+
+}  // namespace opossum
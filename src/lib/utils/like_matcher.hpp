@@ -0,0 +1,43 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace opossum {
+
+// Evaluates SQL LIKE patterns, where '%' matches any sequence of characters (including the empty one) and '_' matches
+// exactly one character. Escaping wildcards is not supported.
+//
+// The pattern is classified once on construction, so that the common cases (exact match, prefix, suffix, and
+// substring) do not need the generic wildcard matcher. Operators should create one LikeMatcher per scan and not per
+// value.
+class LikeMatcher {
+ public:
+  explicit LikeMatcher(const std::string& pattern);
+
+  // Returns whether the value matches the pattern.
+  bool matches(const std::string_view value) const;
+
+  // Returns the literal prefix if the pattern is of the form "abc%" (including "%"), std::nullopt otherwise. All
+  // matching values of such a pattern form a contiguous range in any sorted sequence of strings.
+  std::optional<std::string> prefix() const;
+
+  // Returns the smallest string that is greater than all strings starting with the given prefix. Returns std::nullopt
+  // if no such string exists (e.g., for an empty prefix or a prefix consisting only of '\xFF' characters).
+  static std::optional<std::string> next_prefix(const std::string& prefix);
+
+ protected:
+  enum class PatternType { Exact, Prefix, Suffix, Contains, Generic };
+
+  bool _matches_generic(const std::string_view value) const;
+  bool _contains(const std::string_view value) const;
+
+  const std::string _pattern;
+  PatternType _pattern_type;
+
+  // The pattern without its leading and trailing '%' for all pattern types but Generic.
+  std::string _literal;
+};
+
+}  // namespace opossum
@@ -1,11 +1,11 @@
 #include "load_table.hpp"
 
 #include <fstream>
-
-#include <boost/lexical_cast.hpp>
+#include <sstream>
 
 #include "resolve_type.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
 #include "utils/assert.hpp"
 
 namespace {
@@ -50,9 +50,9 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
     variant_values.reserve(column_count);
 
     for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-      resolve_data_type(column_types[column_id], [&](auto data_type_t) {
+      resolve_data_type(table->column_data_type(column_id), [&](auto data_type_t) {
         using ColumnDataType = typename decltype(data_type_t)::type;
-        variant_values.emplace_back(boost::lexical_cast<ColumnDataType>(string_values[column_id]));
+        variant_values.emplace_back(type_cast<ColumnDataType>(string_values[column_id]));
       });
     }
 
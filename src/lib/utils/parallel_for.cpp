@@ -0,0 +1,87 @@
+#include "parallel_for.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/scheduler.hpp"
+#include "scheduler/worker_thread_recorder.hpp"
+
+namespace opossum {
+
+size_t default_max_parallelism() {
+  return std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+}
+
+void parallel_for(const size_t count, const size_t max_thread_count, const std::function<void(size_t)>& functor) {
+  const auto thread_count = std::min(count, std::max(size_t{1}, max_thread_count));
+  if (thread_count <= 1) {
+    for (auto index = size_t{0}; index < count; ++index) {
+      functor(index);
+    }
+    return;
+  }
+
+  auto next_index = std::atomic<size_t>{0};
+
+  // The threads that get at least one index work on behalf of the caller's operator.
+  auto* const recorder = WorkerThreadRecorder::current();
+  const auto worker = [&]() {
+    auto is_recorded = false;
+    while (true) {
+      const auto index = next_index.fetch_add(1);
+      if (index >= count) {
+        return;
+      }
+
+      if (recorder && !is_recorded) {
+        recorder->record_current_thread();
+        is_recorded = true;
+      }
+
+      try {
+        functor(index);
+      } catch (...) {
+        // Skip the remaining indices.
+        next_index = count;
+        throw;
+      }
+    }
+  };
+
+  // The calling thread participates as well, so we only schedule thread_count - 1 tasks. As workers that wait for tasks
+  // execute other tasks in the meantime, this also works if the calling thread is a worker itself.
+  auto& scheduler = Scheduler::get();
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(thread_count - 1);
+  for (auto task_id = size_t{1}; task_id < thread_count; ++task_id) {
+    tasks.push_back(std::make_shared<JobTask>(worker));
+  }
+  scheduler.schedule_tasks(tasks);
+
+  auto exception = std::exception_ptr{};
+  try {
+    worker();
+  } catch (...) {
+    exception = std::current_exception();
+  }
+
+  // The tasks reference the local variables, so we have to wait for them even if the calling thread failed.
+  try {
+    scheduler.wait_for_tasks(tasks);
+  } catch (...) {
+    if (!exception) {
+      exception = std::current_exception();
+    }
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+}  // namespace opossum
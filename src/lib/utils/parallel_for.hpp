@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace opossum {
+
+// Returns the default number of threads an operator may use, i.e., the number of hardware threads (at least 1).
+size_t default_max_parallelism();
+
+// Calls the functor for every index in [0, count) using up to max_thread_count threads (including the calling one).
+// The other threads are workers of the Scheduler, so parallel_for can also be used by operators that are executed as
+// tasks. Indices are handed out one at a time, so that uneven work (e.g., chunks of different sizes) is balanced.
+// Blocks until all calls have returned. If a call throws, the remaining indices are skipped and the first exception is
+// rethrown in the calling thread. The threads that call the functor are recorded in the calling thread's current
+// WorkerThreadRecorder, if any.
+void parallel_for(const size_t count, const size_t max_thread_count, const std::function<void(size_t)>& functor);
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "parallel_for.hpp"
+
+namespace opossum {
+
+// Merges consecutive sorted runs of values into a single sorted run. run_offsets holds the index of the first value of
+// each run, followed by values.size(). Each round merges pairs of neighboring runs in parallel and halves the number of
+// runs.
+template <typename T, typename Compare>
+void parallel_merge_runs(std::vector<T>& values, std::vector<size_t> run_offsets, const Compare& compare,
+                         const size_t max_parallelism) {
+  auto merged_values = std::vector<T>(values.size());
+  while (run_offsets.size() > 2) {
+    const auto run_count = run_offsets.size() - 1;
+    const auto pair_count = (run_count + 1) / 2;
+    parallel_for(pair_count, max_parallelism, [&](const size_t pair_index) {
+      const auto begin = run_offsets[2 * pair_index];
+      const auto middle = run_offsets[std::min(2 * pair_index + 1, run_count)];
+      const auto end = run_offsets[std::min(2 * pair_index + 2, run_count)];
+      std::merge(values.cbegin() + begin, values.cbegin() + middle, values.cbegin() + middle, values.cbegin() + end,
+                 merged_values.begin() + begin, compare);
+    });
+
+    auto merged_run_offsets = std::vector<size_t>{};
+    for (auto run_index = size_t{0}; run_index < run_count; run_index += 2) {
+      merged_run_offsets.push_back(run_offsets[run_index]);
+    }
+    merged_run_offsets.push_back(run_offsets.back());
+    run_offsets = std::move(merged_run_offsets);
+    std::swap(values, merged_values);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,14 @@
+#include "timer.hpp"
+
+namespace opossum {
+
+Timer::Timer() : _begin{std::chrono::steady_clock::now()} {}
+
+std::chrono::nanoseconds Timer::lap() {
+  const auto end = std::chrono::steady_clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - _begin);
+  _begin = end;
+  return duration;
+}
+
+}  // namespace opossum
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <chrono>
+
+namespace opossum {
+
+// Measures the wall time of consecutive steps, e.g., of the phases of an operator.
+class Timer {
+ public:
+  Timer();
+
+  // Returns the time since the timer was created or lap was last called and restarts the timer.
+  std::chrono::nanoseconds lap();
+
+ protected:
+  std::chrono::steady_clock::time_point _begin;
+};
+
+}  // namespace opossum
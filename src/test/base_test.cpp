@@ -1,5 +1,6 @@
 #include "base_test.hpp"
 
+#include "resolve_type.hpp"
 #include "storage/storage_manager.hpp"
 #include "type_cast.hpp"
 
@@ -23,6 +24,26 @@ void BaseTest::ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_p
   ASSERT_TABLE_EQ(*tleft, *tright, order_sensitive, strict_types);
 }
 
+std::shared_ptr<Table> BaseTest::_create_table(
+    const std::vector<std::pair<std::string, std::string>>& column_definitions,
+    const std::vector<std::vector<AllTypeVariant>>& rows) {
+  // The columns are not added with add_column because joins may output several columns with the same name.
+  auto table = std::make_shared<Table>();
+  auto chunk = std::make_shared<Chunk>();
+  for (const auto& [name, type] : column_definitions) {
+    table->add_column_definition(name, type, true);
+    resolve_data_type(data_type_from_string(type), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      chunk->add_segment(std::make_shared<ValueSegment<ColumnDataType>>(true));
+    });
+  }
+  for (const auto& row : rows) {
+    chunk->append(row);
+  }
+  table->append_chunk(chunk);
+  return table;
+}
+
 BaseTest::Matrix BaseTest::_table_to_matrix(const Table& table) {
   // Initialize matrix with table sizes.
   auto matrix = Matrix(table.row_count(), std::vector<AllTypeVariant>(table.column_count()));
@@ -61,6 +82,13 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
   std::cout << "-------------" << std::endl;
 }
 
+// NULL = NULL is not true in SQL, so NullValue's operator== returns false and EXPECT_EQ cannot compare two NULL cells.
+// For the comparison of tables, however, a NULL in the expected table means that the actual table holds a NULL at that
+// position. Returns whether both or neither of the cells are NULL.
+bool BaseTest::_null_cells_match(const AllTypeVariant& left, const AllTypeVariant& right) {
+  return variant_is_null(left) == variant_is_null(right);
+}
+
 ::testing::AssertionResult BaseTest::_table_equal(const Table& tleft, const Table& tright, bool order_sensitive,
                                                   bool strict_types) {
   auto left = _table_to_matrix(tleft);
@@ -118,6 +146,12 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
 
   for (auto row = uint64_t{0}; row < left.size(); ++row)
     for (auto column_id = ColumnID{0}; column_id < left[row].size(); ++column_id) {
+      if (variant_is_null(left[row][column_id]) || variant_is_null(right[row][column_id])) {
+        EXPECT_TRUE(_null_cells_match(left[row][column_id], right[row][column_id]))
+            << "Row:" << row + 1 << " Column:" << column_id + 1;
+        continue;
+      }
+
       if (tleft.column_type(column_id) == "float") {
         const auto left_val = type_cast<float>(left[row][column_id]);
         const auto right_val = type_cast<float>(right[row][column_id]);
@@ -19,6 +19,7 @@ class BaseTest : public ::testing::Test {
   // helper functions for _table_equal
   static Matrix _table_to_matrix(const Table& table);
   static void _print_matrix(const BaseTest::Matrix& matrix);
+  static bool _null_cells_match(const AllTypeVariant& left, const AllTypeVariant& right);
 
   // helper function for load_table
   template <typename T>
@@ -30,6 +31,12 @@ class BaseTest : public ::testing::Test {
   static ::testing::AssertionResult _table_equal(const Table& tleft, const Table& tright, bool order_sensitive = false,
                                                  bool strict_types = true);
 
+  // Creates a table with a single chunk from the given column definitions (name and type) and rows, e.g., as the
+  // expected output of an operator. All columns are nullable, and column names may repeat.
+  static std::shared_ptr<Table> _create_table(
+      const std::vector<std::pair<std::string, std::string>>& column_definitions,
+      const std::vector<std::vector<AllTypeVariant>>& rows);
+
   // creates a opossum table based from a file
   static void EXPECT_TABLE_EQ(const Table& tleft, const Table& tright, bool order_sensitive = false,
                               bool strict_types = true);
@@ -0,0 +1,70 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "cache/plan_cache.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class PlanCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", "int", false);
+    for (auto value = int32_t{0}; value < 10; ++value) {
+      table->append({value});
+    }
+    _table = table;
+  }
+
+  std::shared_ptr<const AbstractOperator> make_template() {
+    ++_template_count;
+    return std::make_shared<TableScan>(std::make_shared<TableWrapper>(_table), ColumnID{0},
+                                       ScanType::OpGreaterThanEquals, ParameterID{0});
+  }
+
+  std::shared_ptr<const Table> _table;
+  size_t _template_count = 0;
+};
+
+TEST_F(PlanCacheTest, InstantiatesCachedTemplates) {
+  auto cache = PlanCache{2};
+  for (const auto lower_bound : {3, 8, 3}) {
+    const auto plan = cache.instantiate("a >= ?", [&]() { return make_template(); }, {{ParameterID{0}, lower_bound}});
+    std::const_pointer_cast<AbstractOperator>(plan->left_input())->execute();
+    plan->execute();
+    EXPECT_EQ(plan->get_output()->row_count(), 10 - lower_bound);
+  }
+
+  EXPECT_EQ(_template_count, 1);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(static_cast<const TableScan&>(*cache.get("a >= ?")).parameter_id(), ParameterID{0});
+}
+
+TEST_F(PlanCacheTest, EvictsLeastRecentlyUsedTemplates) {
+  auto cache = PlanCache{2};
+  const auto template_a = make_template();
+  const auto template_b = make_template();
+  cache.set("a", template_a);
+  cache.set("b", template_b);
+  EXPECT_EQ(cache.get("a"), template_a);
+
+  // "b" is the least recently used template.
+  cache.set("c", make_template());
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.get("b"), nullptr);
+  EXPECT_EQ(cache.get("a"), template_a);
+
+  cache.set("a", template_b);
+  EXPECT_EQ(cache.get("a"), template_b);
+  EXPECT_EQ(cache.size(), 2);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_EQ(cache.capacity(), 2);
+  EXPECT_THROW(PlanCache{0}, std::logic_error);
+}
+
+}  // namespace opossum
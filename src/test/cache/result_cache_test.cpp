@@ -0,0 +1,177 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "cache/result_cache.hpp"
+#include "operators/expression.hpp"
+#include "operators/get_table.hpp"
+#include "operators/limit.hpp"
+#include "operators/print.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(5);
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "string", true);
+    for (auto value = int32_t{0}; value < 20; ++value) {
+      _table->append({value, value % 3 ? AllTypeVariant{"s" + std::to_string(value % 4)} : NULL_VALUE});
+    }
+    _table->compress_chunk(ChunkID{1});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  // GetTable -> TableScan -> TableScan, as used by a dashboard tile.
+  static std::shared_ptr<TableScan> make_plan() {
+    const auto scan = std::make_shared<TableScan>(std::make_shared<GetTable>("table"), ColumnID{0},
+                                                  ScanType::OpGreaterThanEquals, 4);
+    return std::make_shared<TableScan>(scan, ColumnID{1}, ScanType::OpEquals, "s1");
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ResultCacheTest, ReusesResultsOfIdenticalPlans) {
+  auto cache = ResultCache{1'000'000};
+  const auto plan = make_plan();
+  const auto output = cache.execute(plan);
+  EXPECT_TRUE(plan->was_executed());
+  EXPECT_EQ(output->row_count(), 3);
+
+  // Both scans missed and were cached, the GetTable was not.
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.statistics().hit_count, 0);
+  EXPECT_EQ(cache.statistics().miss_count, 2);
+  EXPECT_GT(cache.memory_usage(), 0);
+
+  // The inputs of a cached result are not executed.
+  const auto other_plan = make_plan();
+  EXPECT_EQ(cache.execute(other_plan), output);
+  EXPECT_TRUE(other_plan->was_executed());
+  EXPECT_EQ(other_plan->get_output(), output);
+  EXPECT_FALSE(other_plan->left_input()->was_executed());
+  EXPECT_EQ(cache.statistics().hit_count, 1);
+
+  // Subplans are cached as well.
+  const auto shared_scan = make_plan()->left_input();
+  cache.execute(std::make_shared<TableScan>(shared_scan, ColumnID{1}, ScanType::OpIsNull, NULL_VALUE));
+  EXPECT_EQ(cache.statistics().hit_count, 2);
+  EXPECT_EQ(shared_scan->get_output(), plan->left_input()->get_output());
+
+  // A row budget changes the output, so the limited scan is not served from the cache.
+  const auto limited_scan = make_plan()->left_input();
+  const auto limit = std::make_shared<Limit>(limited_scan, 2);
+  Limit::propagate_row_budgets(limit);
+  EXPECT_EQ(cache.execute(limit)->row_count(), 2);
+  EXPECT_EQ(cache.statistics().hit_count, 2);
+  EXPECT_NE(limited_scan->get_output(), plan->left_input()->get_output());
+}
+
+TEST_F(ResultCacheTest, ReusesProjections) {
+  auto cache = ResultCache{1'000'000};
+  const auto make_projection = [&]() {
+    const auto column = std::make_shared<ColumnExpression>(ColumnID{0});
+    return std::make_shared<Projection>(
+        make_plan(), std::vector<std::shared_ptr<const AbstractExpression>>{std::make_shared<ArithmeticExpression>(
+                         ArithmeticOperator::Multiplication, column, std::make_shared<ValueExpression>(2))});
+  };
+
+  const auto output = cache.execute(make_projection());
+  EXPECT_EQ(cache.execute(make_projection()), output);
+  EXPECT_EQ(cache.statistics().hit_count, 1);
+}
+
+TEST_F(ResultCacheTest, ModificationsInvalidateResults) {
+  auto cache = ResultCache{1'000'000};
+  const auto key = ResultCache::cache_key(*make_plan());
+  EXPECT_EQ(cache.execute(make_plan())->row_count(), 3);
+
+  _table->append({21, "s1"});
+  EXPECT_NE(ResultCache::cache_key(*make_plan()), key);
+  EXPECT_EQ(cache.execute(make_plan())->row_count(), 4);
+  EXPECT_EQ(cache.statistics().hit_count, 0);
+}
+
+TEST_F(ResultCacheTest, CacheKeys) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  const auto scan_key = [&](const AllTypeVariant& search_value) {
+    return ResultCache::cache_key(TableScan{table_wrapper, ColumnID{0}, ScanType::OpEquals, search_value});
+  };
+
+  EXPECT_EQ(scan_key(1), scan_key(1));
+  EXPECT_NE(scan_key(1), scan_key("1"));
+  EXPECT_NE(scan_key(1), scan_key(int64_t{1}));
+  EXPECT_NE(scan_key(1.0f), scan_key(1.0));
+  EXPECT_NE(scan_key(0.1), scan_key(0.1000001));
+  EXPECT_NE(scan_key(NULL_VALUE), scan_key("NULL"));
+
+  // Operators with placeholders or without a description cannot be cached.
+  EXPECT_EQ(ResultCache::cache_key(TableScan{table_wrapper, ColumnID{0}, ScanType::OpEquals, ParameterID{0}}),
+            std::nullopt);
+  const auto print = std::make_shared<Print>(table_wrapper);
+  EXPECT_EQ(ResultCache::cache_key(*print), std::nullopt);
+  EXPECT_EQ(ResultCache::cache_key(Limit{print, 1}), std::nullopt);
+
+  // Projections are described by their expressions, with column ids and typed values.
+  const auto projection_key = [&](const std::shared_ptr<const AbstractExpression>& expression) {
+    return ResultCache::cache_key(Projection{table_wrapper, {expression}});
+  };
+  const auto column = std::make_shared<ColumnExpression>(ColumnID{0});
+  const auto plus = [&](const AllTypeVariant& value) {
+    return std::make_shared<ArithmeticExpression>(ArithmeticOperator::Addition, column,
+                                                  std::make_shared<ValueExpression>(value));
+  };
+  ASSERT_NE(projection_key(column), std::nullopt);
+  EXPECT_EQ(projection_key(plus(1)), projection_key(plus(1)));
+  EXPECT_NE(projection_key(plus(1)), projection_key(plus(int64_t{1})));
+  EXPECT_NE(projection_key(plus(1)), projection_key(std::make_shared<ColumnExpression>(ColumnID{1})));
+  EXPECT_NE(ResultCache::cache_key(Projection{table_wrapper, {column, column}}), projection_key(column));
+
+  // A row budget changes the output.
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 1);
+  const auto key = ResultCache::cache_key(*scan);
+  scan->set_row_budget(10);
+  EXPECT_NE(ResultCache::cache_key(*scan), key);
+}
+
+TEST_F(ResultCacheTest, Eviction) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  scan->execute();
+  const auto output = scan->get_output();
+  const auto memory_usage = output->estimate_memory_usage();
+
+  // Room for two outputs.
+  auto cache = ResultCache{2 * memory_usage + 1};
+  cache.set("expensive", output, 1'000.0);
+  cache.set("cheap", output, 10.0);
+  cache.set("new", output, 100.0);
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.memory_usage(), 2 * memory_usage);
+  EXPECT_EQ(cache.statistics().eviction_count, 1);
+  EXPECT_EQ(cache.get("cheap"), nullptr);
+  EXPECT_EQ(cache.get("expensive"), output);
+
+  // With equal costs, the least recently used output is evicted.
+  cache.clear();
+  cache.set("a", output, 1.0);
+  cache.set("b", output, 1.0);
+  cache.get("a");
+  cache.set("c", output, 1.0);
+  EXPECT_EQ(cache.get("b"), nullptr);
+  EXPECT_EQ(cache.get("a"), output);
+
+  // Outputs that exceed the budget are not cached.
+  auto small_cache = ResultCache{memory_usage - 1};
+  small_cache.set("a", output, 1.0);
+  EXPECT_EQ(small_cache.size(), 0);
+}
+
+}  // namespace opossum
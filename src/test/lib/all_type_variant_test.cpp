@@ -1,5 +1,10 @@
+#include <limits>
+
 #include "base_test.hpp"
 
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+
 namespace opossum {
 
 template <typename T>
@@ -34,7 +39,7 @@ TYPED_TEST(AllTypeVariantTest, GetExtractsExactValue) {
       EXPECT_TRUE(variant_is_null(variant));
     } else {
       const auto variant = AllTypeVariant{value_in};
-      const auto value_out = boost::get<TypeParam>(variant);
+      const auto value_out = std::get<TypeParam>(variant);
 
       EXPECT_EQ(value_in, value_out);
       EXPECT_FALSE(variant_is_null(variant));
@@ -42,4 +47,56 @@ TYPED_TEST(AllTypeVariantTest, GetExtractsExactValue) {
   }
 }
 
+TYPED_TEST(AllTypeVariantTest, ResolveDataType) {
+  if constexpr (!std::is_same_v<TypeParam, NullValue>) {
+    auto resolved = false;
+    resolve_data_type(data_type_of<TypeParam>, [&](const auto type) {
+      resolved = std::is_same_v<typename decltype(type)::type, TypeParam>;
+    });
+    EXPECT_TRUE(resolved);
+  }
+}
+
+TEST(TypeCastTest, ConvertsBetweenDataTypes) {
+  EXPECT_EQ(type_cast<int64_t>(AllTypeVariant{int32_t{-17}}), int64_t{-17});
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{3.7}), 3);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{-3.7f}), -3);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{int64_t{1} << 40}), 1099511627776.0);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{2.5}), 2.5f);
+
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"42"}), 42);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{"4.2"}), 4);
+  EXPECT_EQ(type_cast<double>(AllTypeVariant{"-0.25"}), -0.25);
+  EXPECT_EQ(type_cast<int64_t>(std::string{"9000000000"}), int64_t{9000000000});
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"4 apples"}), std::logic_error);
+  EXPECT_THROW(type_cast<float>(AllTypeVariant{""}), std::logic_error);
+
+  // Values that are out of range are not wrapped around.
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{int64_t{-2'147'483'648}}), -2'147'483'648);
+  EXPECT_EQ(type_cast<int32_t>(AllTypeVariant{2'147'483'647.9}), 2'147'483'647);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{int64_t{1} << 40}), std::logic_error);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{"9000000000"}), std::logic_error);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{2'147'483'648.0}), std::logic_error);
+  EXPECT_THROW(type_cast<int64_t>(AllTypeVariant{1e19f}), std::logic_error);
+  EXPECT_THROW(type_cast<int64_t>(AllTypeVariant{"9223372036854775808"}), std::logic_error);
+  EXPECT_THROW(type_cast<int32_t>(AllTypeVariant{std::numeric_limits<double>::quiet_NaN()}), std::logic_error);
+  EXPECT_THROW(type_cast<float>(AllTypeVariant{1e300}), std::logic_error);
+  EXPECT_THROW(type_cast<double>(AllTypeVariant{"1e400"}), std::logic_error);
+  EXPECT_EQ(type_cast<float>(AllTypeVariant{std::numeric_limits<double>::infinity()}),
+            std::numeric_limits<float>::infinity());
+
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{17}), "17");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{458.7f}), "458.7");
+  EXPECT_EQ(type_cast<std::string>(AllTypeVariant{"abc"}), "abc");
+
+  EXPECT_THROW(type_cast<int32_t>(NULL_VALUE), std::logic_error);
+  EXPECT_THROW(type_cast<std::string>(NULL_VALUE), std::logic_error);
+}
+
+TEST(TypeCastTest, PrintsVariants) {
+  auto stream = std::stringstream{};
+  stream << AllTypeVariant{17} << "|" << AllTypeVariant{"abc"} << "|" << AllTypeVariant{2.5} << "|" << NULL_VALUE;
+  EXPECT_EQ(stream.str(), "17|abc|2.5|NULL");
+}
+
 }  // namespace opossum
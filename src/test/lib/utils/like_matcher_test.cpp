@@ -0,0 +1,69 @@
+#include "base_test.hpp"
+
+#include "utils/like_matcher.hpp"
+
+namespace opossum {
+
+class LikeMatcherTest : public BaseTest {};
+
+TEST_F(LikeMatcherTest, ExactPattern) {
+  const auto matcher = LikeMatcher{"Hasso"};
+  EXPECT_TRUE(matcher.matches("Hasso"));
+  EXPECT_FALSE(matcher.matches("Hasso Plattner"));
+  EXPECT_FALSE(matcher.matches(""));
+  EXPECT_FALSE(matcher.prefix());
+
+  EXPECT_TRUE(LikeMatcher{""}.matches(""));
+  EXPECT_FALSE(LikeMatcher{""}.matches("a"));
+}
+
+TEST_F(LikeMatcherTest, PrefixPattern) {
+  const auto matcher = LikeMatcher{"Ha%"};
+  EXPECT_TRUE(matcher.matches("Hasso"));
+  EXPECT_TRUE(matcher.matches("Ha"));
+  EXPECT_FALSE(matcher.matches("H"));
+  EXPECT_FALSE(matcher.matches("aHa"));
+  EXPECT_EQ(matcher.prefix(), "Ha");
+
+  const auto match_all = LikeMatcher{"%"};
+  EXPECT_TRUE(match_all.matches(""));
+  EXPECT_TRUE(match_all.matches("anything"));
+  EXPECT_EQ(match_all.prefix(), "");
+}
+
+TEST_F(LikeMatcherTest, SuffixAndContainsPattern) {
+  const auto suffix_matcher = LikeMatcher{"%ner"};
+  EXPECT_TRUE(suffix_matcher.matches("Plattner"));
+  EXPECT_FALSE(suffix_matcher.matches("Plattners"));
+  EXPECT_FALSE(suffix_matcher.prefix());
+
+  const auto contains_matcher = LikeMatcher{"%att%"};
+  EXPECT_TRUE(contains_matcher.matches("Plattner"));
+  EXPECT_TRUE(contains_matcher.matches("att"));
+  EXPECT_TRUE(contains_matcher.matches("aatatt"));
+  EXPECT_FALSE(contains_matcher.matches("at"));
+  EXPECT_FALSE(contains_matcher.matches("a_t_t"));
+}
+
+TEST_F(LikeMatcherTest, GenericPattern) {
+  const auto matcher = LikeMatcher{"H_s%o%r"};
+  EXPECT_TRUE(matcher.matches("Hasso Plattner"));
+  EXPECT_TRUE(matcher.matches("Hisor"));
+  EXPECT_FALSE(matcher.matches("Hsor"));
+  EXPECT_FALSE(matcher.matches("Hasso Plattners"));
+  EXPECT_FALSE(matcher.prefix());
+
+  EXPECT_TRUE(LikeMatcher{"%a%a%"}.matches("banana"));
+  EXPECT_FALSE(LikeMatcher{"%a%a%a%a%"}.matches("banana"));
+  EXPECT_TRUE(LikeMatcher{"___"}.matches("abc"));
+  EXPECT_FALSE(LikeMatcher{"___"}.matches("ab"));
+}
+
+TEST_F(LikeMatcherTest, NextPrefix) {
+  EXPECT_EQ(LikeMatcher::next_prefix("abc"), "abd");
+  EXPECT_EQ(LikeMatcher::next_prefix("ab\xFF"), "ac");
+  EXPECT_FALSE(LikeMatcher::next_prefix(""));
+  EXPECT_FALSE(LikeMatcher::next_prefix("\xFF\xFF"));
+}
+
+}  // namespace opossum
@@ -0,0 +1,258 @@
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/aggregate.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  // Creates a table with the nullable group-by columns "a" (int) and "b" (string) and the nullable column "v" (int).
+  std::shared_ptr<TableWrapper> get_table_op(const bool compressed) {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int", true);
+    table->add_column("b", "string", true);
+    table->add_column("v", "int", true);
+    table->append({1, "x", 10});
+    table->append({2, "x", 20});
+    table->append({1, "y", NULL_VALUE});
+    table->append({NULL_VALUE, "x", 5});
+    table->append({1, "x", 30});
+    table->append({2, NULL_VALUE, 20});
+    table->append({NULL_VALUE, "x", 7});
+    table->append({1, "y", 0});
+
+    if (compressed) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Returns the expected output of all_aggregates grouped by the given columns.
+  static std::shared_ptr<Table> expected_table(std::vector<std::pair<std::string, std::string>> column_definitions,
+                                               const std::vector<std::vector<AllTypeVariant>>& rows) {
+    column_definitions.insert(column_definitions.end(), {{"COUNT(*)", "long"},
+                                                         {"COUNT(v)", "long"},
+                                                         {"COUNT(DISTINCT v)", "long"},
+                                                         {"SUM(v)", "long"},
+                                                         {"MIN(v)", "int"},
+                                                         {"MAX(v)", "int"},
+                                                         {"AVG(v)", "double"}});
+    return _create_table(column_definitions, rows);
+  }
+
+  std::shared_ptr<const Table> aggregate(const std::shared_ptr<const AbstractOperator>& in,
+                                         const std::vector<AggregateDefinition>& aggregates,
+                                         const std::vector<ColumnID>& group_by_column_ids) {
+    const auto aggregate = std::make_shared<Aggregate>(in, aggregates, group_by_column_ids);
+    aggregate->execute();
+    return aggregate->get_output();
+  }
+
+  const std::vector<AggregateDefinition> all_aggregates{{AggregateFunction::Count, std::nullopt},
+                                                        {AggregateFunction::Count, ColumnID{2}},
+                                                        {AggregateFunction::CountDistinct, ColumnID{2}},
+                                                        {AggregateFunction::Sum, ColumnID{2}},
+                                                        {AggregateFunction::Min, ColumnID{2}},
+                                                        {AggregateFunction::Max, ColumnID{2}},
+                                                        {AggregateFunction::Avg, ColumnID{2}}};
+};
+
+TEST_F(OperatorsAggregateTest, Getters) {
+  const auto table_op = get_table_op(false);
+  const auto aggregate = std::make_shared<Aggregate>(
+      table_op, std::vector<AggregateDefinition>{{AggregateFunction::Sum, ColumnID{2}}}, std::vector{ColumnID{1}});
+  EXPECT_EQ(aggregate->aggregates().size(), 1);
+  EXPECT_EQ(aggregate->aggregates()[0].function, AggregateFunction::Sum);
+  EXPECT_EQ(aggregate->group_by_column_ids(), std::vector{ColumnID{1}});
+
+  aggregate->set_max_parallelism(2);
+  EXPECT_EQ(aggregate->max_parallelism(), 2);
+  EXPECT_THROW(aggregate->set_max_parallelism(0), std::logic_error);
+}
+
+TEST_F(OperatorsAggregateTest, OutputColumns) {
+  const auto output = aggregate(get_table_op(false), all_aggregates, {ColumnID{1}});
+  EXPECT_EQ(output->column_count(), 8);
+  const auto expected_names = std::vector<std::string>{"b",     "COUNT(*)", "COUNT(v)", "COUNT(DISTINCT v)",
+                                                       "SUM(v)", "MIN(v)",   "MAX(v)",   "AVG(v)"};
+  const auto expected_types =
+      std::vector<std::string>{"string", "long", "long", "long", "long", "int", "int", "double"};
+  for (auto column_id = ColumnID{0}; column_id < output->column_count(); ++column_id) {
+    EXPECT_EQ(output->column_name(column_id), expected_names[column_id]);
+    EXPECT_EQ(output->column_type(column_id), expected_types[column_id]);
+  }
+  EXPECT_TRUE(output->column_nullable(ColumnID{0}));
+  EXPECT_FALSE(output->column_nullable(ColumnID{1}));
+  EXPECT_FALSE(output->column_nullable(ColumnID{3}));
+  EXPECT_TRUE(output->column_nullable(ColumnID{4}));
+  EXPECT_TRUE(output->column_nullable(ColumnID{7}));
+}
+
+TEST_F(OperatorsAggregateTest, NoGroupBy) {
+  for (const auto compressed : {false, true}) {
+    SCOPED_TRACE("compressed: " + std::to_string(compressed));
+    EXPECT_TABLE_EQ(aggregate(get_table_op(compressed), all_aggregates, {}),
+                    expected_table({}, {{8, 7, 6, 92, 0, 30, 92.0 / 7}}));
+  }
+}
+
+TEST_F(OperatorsAggregateTest, EmptyInput) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int", true);
+  table->add_column("b", "string", true);
+  table->add_column("v", "int", true);
+  const auto table_op = std::make_shared<TableWrapper>(table);
+  table_op->execute();
+
+  EXPECT_TABLE_EQ(aggregate(table_op, all_aggregates, {}),
+                  expected_table({}, {{0, 0, 0, NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE}}));
+  EXPECT_TABLE_EQ(aggregate(table_op, all_aggregates, {ColumnID{0}}), expected_table({{"a", "int"}}, {}));
+}
+
+TEST_F(OperatorsAggregateTest, SingleColumnGroupBy) {
+  for (const auto compressed : {false, true}) {
+    SCOPED_TRACE("compressed: " + std::to_string(compressed));
+    EXPECT_TABLE_EQ(aggregate(get_table_op(compressed), all_aggregates, {ColumnID{0}}),
+                    expected_table({{"a", "int"}}, {{1, 4, 3, 3, 40, 0, 30, 40.0 / 3},
+                                                    {2, 2, 2, 1, 40, 20, 20, 20.0},
+                                                    {NULL_VALUE, 2, 2, 2, 12, 5, 7, 6.0}}));
+  }
+}
+
+TEST_F(OperatorsAggregateTest, MultiColumnGroupBy) {
+  const auto aggregates =
+      std::vector<AggregateDefinition>{{AggregateFunction::Count, std::nullopt}, {AggregateFunction::Sum, ColumnID{2}}};
+  for (const auto compressed : {false, true}) {
+    SCOPED_TRACE("compressed: " + std::to_string(compressed));
+    EXPECT_TABLE_EQ(aggregate(get_table_op(compressed), aggregates, {ColumnID{0}, ColumnID{1}}),
+                    _create_table({{"a", "int"}, {"b", "string"}, {"COUNT(*)", "long"}, {"SUM(v)", "long"}},
+                                  {{1, "x", 2, 40},
+                                   {1, "y", 2, 0},
+                                   {2, NULL_VALUE, 1, 20},
+                                   {2, "x", 1, 20},
+                                   {NULL_VALUE, "x", 2, 12}}));
+    EXPECT_TABLE_EQ(aggregate(get_table_op(compressed), aggregates, {ColumnID{1}, ColumnID{0}}),
+                    _create_table({{"b", "string"}, {"a", "int"}, {"COUNT(*)", "long"}, {"SUM(v)", "long"}},
+                                  {{NULL_VALUE, 2, 1, 20},
+                                   {"x", 1, 2, 40},
+                                   {"x", 2, 1, 20},
+                                   {"x", NULL_VALUE, 2, 12},
+                                   {"y", 1, 2, 0}}));
+  }
+}
+
+TEST_F(OperatorsAggregateTest, GroupByWithoutAggregates) {
+  EXPECT_TABLE_EQ(aggregate(get_table_op(true), {}, {ColumnID{1}}),
+                  _create_table({{"b", "string"}}, {{NULL_VALUE}, {"x"}, {"y"}}));
+}
+
+TEST_F(OperatorsAggregateTest, ManyGroups) {
+  // The number of combinations of both group-by columns exceeds the size of the dense group arrays.
+  auto table = std::make_shared<Table>(50'000);
+  table->add_column("a", "int", false);
+  table->add_column("b", "long", false);
+  for (auto row_index = int32_t{0}; row_index < 100'000; ++row_index) {
+    table->append({row_index % 1'000, int64_t{row_index % 700}});
+  }
+  table->compress_chunk(ChunkID{0});
+  const auto table_op = std::make_shared<TableWrapper>(table);
+  table_op->execute();
+
+  const auto output =
+      aggregate(table_op, {{AggregateFunction::Count, std::nullopt}, {AggregateFunction::Max, ColumnID{1}}},
+                {ColumnID{0}, ColumnID{1}});
+  // Rows with the same values modulo 1'000 and 700 are 7'000 rows apart, so the first 2'000 groups have 15 rows.
+  auto expected_rows = std::vector<std::vector<AllTypeVariant>>{};
+  for (auto row_index = int32_t{0}; row_index < 7'000; ++row_index) {
+    expected_rows.push_back({row_index % 1'000, int64_t{row_index % 700}, row_index < 2'000 ? 15 : 14,
+                             int64_t{row_index % 700}});
+  }
+  EXPECT_TABLE_EQ(output, _create_table({{"a", "int"}, {"b", "long"}, {"COUNT(*)", "long"}, {"MAX(b)", "long"}},
+                                         expected_rows));
+}
+
+TEST_F(OperatorsAggregateTest, WholeChunkAggregates) {
+  // The first and the last chunk only contain a single group each, so that their compressed segments are aggregated
+  // as a whole. The second chunk contains two groups and is aggregated row by row.
+  auto table = std::make_shared<Table>(3);
+  table->add_column("g", "int", false);
+  table->add_column("v", "double", true);
+  table->append({1, 1.5});
+  table->append({1, NULL_VALUE});
+  table->append({1, 2.5});
+  table->append({2, NULL_VALUE});
+  table->append({2, NULL_VALUE});
+  table->append({1, 1.5});
+  table->append({1, -4.0});
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->compress_chunk(chunk_id);
+  }
+  const auto table_op = std::make_shared<TableWrapper>(table);
+  table_op->execute();
+
+  const auto aggregates = std::vector<AggregateDefinition>{{AggregateFunction::Count, std::nullopt},
+                                                           {AggregateFunction::Count, ColumnID{1}},
+                                                           {AggregateFunction::CountDistinct, ColumnID{1}},
+                                                           {AggregateFunction::Sum, ColumnID{1}},
+                                                           {AggregateFunction::Min, ColumnID{1}},
+                                                           {AggregateFunction::Max, ColumnID{1}},
+                                                           {AggregateFunction::Avg, ColumnID{1}}};
+  const auto column_definitions = std::vector<std::pair<std::string, std::string>>{
+      {"COUNT(*)", "long"},  {"COUNT(v)", "long"}, {"COUNT(DISTINCT v)", "long"}, {"SUM(v)", "double"},
+      {"MIN(v)", "double"}, {"MAX(v)", "double"}, {"AVG(v)", "double"}};
+  EXPECT_TABLE_EQ(aggregate(table_op, aggregates, {}),
+                  _create_table(column_definitions, {{7, 4, 3, 1.5, -4.0, 2.5, 0.375}}));
+
+  auto grouped_column_definitions = column_definitions;
+  grouped_column_definitions.insert(grouped_column_definitions.begin(), {"g", "int"});
+  EXPECT_TABLE_EQ(aggregate(table_op, aggregates, {ColumnID{0}}),
+                  _create_table(grouped_column_definitions,
+                                {{1, 5, 4, 3, 1.5, -4.0, 2.5, 0.375},
+                                 {2, 2, 0, 0, NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE}}));
+}
+
+TEST_F(OperatorsAggregateTest, StringMinMax) {
+  const auto aggregates = std::vector<AggregateDefinition>{{AggregateFunction::Min, ColumnID{1}},
+                                                           {AggregateFunction::Max, ColumnID{1}},
+                                                           {AggregateFunction::CountDistinct, ColumnID{1}}};
+  for (const auto compressed : {false, true}) {
+    SCOPED_TRACE("compressed: " + std::to_string(compressed));
+    EXPECT_TABLE_EQ(aggregate(get_table_op(compressed), aggregates, {ColumnID{0}}),
+                    _create_table({{"a", "int"}, {"MIN(b)", "string"}, {"MAX(b)", "string"},
+                                   {"COUNT(DISTINCT b)", "long"}},
+                                  {{1, "x", "y", 2}, {2, "x", "x", 1}, {NULL_VALUE, "x", "x", 1}}));
+  }
+}
+
+TEST_F(OperatorsAggregateTest, ReferenceSegments) {
+  const auto scan = std::make_shared<TableScan>(get_table_op(true), ColumnID{2}, ScanType::OpGreaterThan, 5);
+  scan->execute();
+  EXPECT_TABLE_EQ(aggregate(scan, all_aggregates, {ColumnID{1}}),
+                  expected_table({{"b", "string"}},
+                                 {{NULL_VALUE, 1, 1, 1, 20, 20, 20, 20.0}, {"x", 4, 4, 4, 67, 7, 30, 16.75}}));
+}
+
+TEST_F(OperatorsAggregateTest, InvalidAggregatesFail) {
+  const auto table_op = get_table_op(false);
+  for (const auto& definition : {AggregateDefinition{AggregateFunction::Sum, ColumnID{1}},
+                                 AggregateDefinition{AggregateFunction::Avg, ColumnID{1}},
+                                 AggregateDefinition{AggregateFunction::Min, std::nullopt},
+                                 AggregateDefinition{AggregateFunction::Count, ColumnID{3}}}) {
+    const auto aggregate = std::make_shared<Aggregate>(table_op, std::vector{definition}, std::vector<ColumnID>{});
+    EXPECT_THROW(aggregate->execute(), std::logic_error);
+  }
+}
+
+}  // namespace opossum
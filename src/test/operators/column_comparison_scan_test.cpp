@@ -0,0 +1,231 @@
+#include "base_test.hpp"
+
+#include "operators/column_comparison_scan.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class OperatorsColumnComparisonScanTest : public BaseTest {
+ protected:
+  // Creates a table with the columns "id", "a", and "b", where "a" and "b" are nullable ints. Chunks are encoded
+  // according to the given encoding: 'v' keeps the value segments, 'd' dictionary-encodes the chunk.
+  std::shared_ptr<TableWrapper> get_table_op(const std::string& chunk_encodings) {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("id", "int", false);
+    table->add_column("a", "int", true);
+    table->add_column("b", "int", true);
+
+    table->append({0, 1, 2});
+    table->append({1, 2, 2});
+    table->append({2, 3, 2});
+    table->append({3, NULL_VALUE, 2});
+    table->append({4, 5, NULL_VALUE});
+    table->append({5, 7, 6});
+    table->append({6, 7, 8});
+    table->append({7, 9, 9});
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (chunk_encodings[chunk_id] == 'd') {
+        table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::vector<int32_t> get_ids(const std::shared_ptr<const Table>& table) {
+    auto ids = std::vector<int32_t>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        ids.push_back(type_cast<int32_t>((*chunk->get_segment(ColumnID{0}))[chunk_offset]));
+      }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  const std::map<ScanType, std::vector<int32_t>> expected_ids{
+      {ScanType::OpEquals, {1, 7}},          {ScanType::OpNotEquals, {0, 2, 5, 6}},
+      {ScanType::OpLessThan, {0, 6}},        {ScanType::OpLessThanEquals, {0, 1, 6, 7}},
+      {ScanType::OpGreaterThan, {2, 5}},     {ScanType::OpGreaterThanEquals, {1, 2, 5, 7}}};
+};
+
+TEST_F(OperatorsColumnComparisonScanTest, Getters) {
+  const auto scan =
+      std::make_shared<ColumnComparisonScan>(get_table_op("vvv"), ColumnID{1}, ScanType::OpLessThan, ColumnID{2});
+  EXPECT_EQ(scan->left_column_id(), ColumnID{1});
+  EXPECT_EQ(scan->scan_type(), ScanType::OpLessThan);
+  EXPECT_EQ(scan->right_column_id(), ColumnID{2});
+}
+
+TEST_F(OperatorsColumnComparisonScanTest, ScanDataSegments) {
+  for (const auto& chunk_encodings : {"vvv", "ddd", "dvd"}) {
+    const auto table_wrapper = get_table_op(chunk_encodings);
+    for (const auto& [scan_type, ids] : expected_ids) {
+      auto scan = std::make_shared<ColumnComparisonScan>(table_wrapper, ColumnID{1}, scan_type, ColumnID{2});
+      scan->execute();
+      EXPECT_EQ(get_ids(scan->get_output()), ids);
+    }
+  }
+}
+
+TEST_F(OperatorsColumnComparisonScanTest, ScanReferenceSegments) {
+  for (const auto& chunk_encodings : {"vvv", "ddd", "vdv"}) {
+    const auto table_wrapper = get_table_op(chunk_encodings);
+    auto pre_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 5);
+    pre_scan->execute();
+
+    for (auto [scan_type, ids] : expected_ids) {
+      ids.erase(std::remove(ids.begin(), ids.end(), 5), ids.end());
+      auto scan = std::make_shared<ColumnComparisonScan>(pre_scan, ColumnID{1}, scan_type, ColumnID{2});
+      scan->execute();
+      EXPECT_EQ(get_ids(scan->get_output()), ids);
+    }
+  }
+}
+
+TEST_F(OperatorsColumnComparisonScanTest, ScanMixedEncodings) {
+  // The same rows as in get_table_op, but with a dictionary segment and a value segment in each chunk.
+  const auto rows = std::vector<std::vector<AllTypeVariant>>{
+      {0, 1, 2}, {1, 2, 2}, {2, 3, 2}, {3, NULL_VALUE, 2}, {4, 5, NULL_VALUE}, {5, 7, 6}, {6, 7, 8}, {7, 9, 9}};
+  auto table = std::make_shared<Table>(4);
+  table->add_column_definition("id", "int", false);
+  table->add_column_definition("a", "int", true);
+  table->add_column_definition("b", "int", true);
+  for (auto chunk_index = size_t{0}; chunk_index < 2; ++chunk_index) {
+    auto segments = std::vector<std::shared_ptr<ValueSegment<int32_t>>>{
+        std::make_shared<ValueSegment<int32_t>>(false), std::make_shared<ValueSegment<int32_t>>(true),
+        std::make_shared<ValueSegment<int32_t>>(true)};
+    for (auto row_index = chunk_index * 4; row_index < chunk_index * 4 + 4; ++row_index) {
+      for (auto column_index = size_t{0}; column_index < 3; ++column_index) {
+        segments[column_index]->append(rows[row_index][column_index]);
+      }
+    }
+
+    // The first chunk encodes a, the second one b.
+    const auto encoded_column_index = chunk_index + 1;
+    const auto chunk = std::make_shared<Chunk>();
+    for (auto column_index = size_t{0}; column_index < 3; ++column_index) {
+      if (column_index == encoded_column_index) {
+        chunk->add_segment(std::make_shared<DictionarySegment<int32_t>>(segments[column_index]));
+      } else {
+        chunk->add_segment(segments[column_index]);
+      }
+    }
+    table->append_chunk(chunk);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto pre_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 5);
+  pre_scan->execute();
+
+  for (auto [scan_type, ids] : expected_ids) {
+    auto scan = std::make_shared<ColumnComparisonScan>(table_wrapper, ColumnID{1}, scan_type, ColumnID{2});
+    scan->execute();
+    EXPECT_EQ(get_ids(scan->get_output()), ids);
+
+    ids.erase(std::remove(ids.begin(), ids.end(), 5), ids.end());
+    auto reference_scan = std::make_shared<ColumnComparisonScan>(pre_scan, ColumnID{1}, scan_type, ColumnID{2});
+    reference_scan->execute();
+    EXPECT_EQ(get_ids(reference_scan->get_output()), ids);
+  }
+}
+
+TEST_F(OperatorsColumnComparisonScanTest, ScanJoinOutput) {
+  // The output's columns reference two tables. The compared columns come from the left input and share their position
+  // lists, the columns of the right input do not.
+  auto right_table = std::make_shared<Table>(2);
+  right_table->add_column("c", "int", false);
+  for (auto value = int32_t{7}; value >= 0; --value) {
+    right_table->append({value});
+  }
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+  auto join = std::make_shared<JoinHash>(get_table_op("dvd"), right, JoinMode::Inner, ColumnID{0}, ColumnID{0});
+  join->execute();
+
+  auto scan = std::make_shared<ColumnComparisonScan>(join, ColumnID{1}, ScanType::OpGreaterThan, ColumnID{2});
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), _create_table({{"id", "int"}, {"a", "int"}, {"b", "int"}, {"c", "int"}},
+                                                    {{2, 3, 2, 2}, {5, 7, 6, 5}}));
+}
+
+TEST_F(OperatorsColumnComparisonScanTest, BandJoin) {
+  // lo <= t AND t <= hi as a JoinSortMerge on the lower bound followed by a scan of the upper bound, which compares
+  // columns of different join inputs.
+  auto events_table = std::make_shared<Table>(2);
+  events_table->add_column("t", "int", true);
+  for (const auto& value : std::vector<AllTypeVariant>{1, 4, 6, NULL_VALUE, 9}) {
+    events_table->append({value});
+  }
+  events_table->compress_chunk(ChunkID{1});
+  auto windows_table = std::make_shared<Table>(2);
+  windows_table->add_column("lo", "int", false);
+  windows_table->add_column("hi", "int", false);
+  windows_table->append({0, 4});
+  windows_table->append({5, 9});
+  windows_table->append({3, 3});
+  windows_table->compress_chunk(ChunkID{0});
+
+  auto events = std::make_shared<TableWrapper>(events_table);
+  events->execute();
+  auto windows = std::make_shared<TableWrapper>(windows_table);
+  windows->execute();
+  auto join = std::make_shared<JoinSortMerge>(events, windows, JoinMode::Inner, ColumnID{0},
+                                              ScanType::OpGreaterThanEquals, ColumnID{0});
+  join->execute();
+
+  auto scan = std::make_shared<ColumnComparisonScan>(join, ColumnID{0}, ScanType::OpLessThanEquals, ColumnID{2});
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), _create_table({{"t", "int"}, {"lo", "int"}, {"hi", "int"}},
+                                                    {{1, 0, 4}, {4, 0, 4}, {6, 5, 9}, {9, 5, 9}}));
+}
+
+TEST_F(OperatorsColumnComparisonScanTest, ScanSharedDictionary) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("id", "int", false);
+  table->add_column("a", "string", false);
+  table->add_column("b", "string", false);
+  table->append({0, "Alpha", "Beta"});
+  table->append({1, "Beta", "Alpha"});
+  table->append({2, "Gamma", "Gamma"});
+  table->append({3, "Beta", "Gamma"});
+  table->compress_chunk(ChunkID{0});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto less_scan =
+      std::make_shared<ColumnComparisonScan>(table_wrapper, ColumnID{1}, ScanType::OpLessThan, ColumnID{2});
+  less_scan->execute();
+  EXPECT_EQ(get_ids(less_scan->get_output()), std::vector<int32_t>({0, 3}));
+
+  auto equals_scan =
+      std::make_shared<ColumnComparisonScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, ColumnID{2});
+  equals_scan->execute();
+  EXPECT_EQ(get_ids(equals_scan->get_output()), std::vector<int32_t>({2}));
+}
+
+TEST_F(OperatorsColumnComparisonScanTest, InvalidScans) {
+  const auto table_wrapper = get_table_op("vvv");
+  auto like_scan = std::make_shared<ColumnComparisonScan>(table_wrapper, ColumnID{1}, ScanType::OpLike, ColumnID{2});
+  EXPECT_THROW(like_scan->execute(), std::logic_error);
+
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int", false);
+  table->add_column("b", "float", false);
+  auto mixed_table_wrapper = std::make_shared<TableWrapper>(table);
+  mixed_table_wrapper->execute();
+  auto mixed_scan =
+      std::make_shared<ColumnComparisonScan>(mixed_table_wrapper, ColumnID{0}, ScanType::OpEquals, ColumnID{1});
+  EXPECT_THROW(mixed_scan->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,246 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  // Creates the left table with the columns "a" (nullable int) and "b" (string).
+  std::shared_ptr<TableWrapper> get_left_table_op(const bool compressed) {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int", true);
+    table->add_column("b", "string", false);
+    table->append({1, "a1"});
+    table->append({2, "a2"});
+    table->append({2, "a3"});
+    table->append({NULL_VALUE, "a4"});
+    table->append({4, "a5"});
+    table->append({5, "a6"});
+    return _wrap(table, compressed);
+  }
+
+  // Creates the right table with the columns "c" (nullable int) and "d" (string). The table has the given number of
+  // additional rows without a join partner, so that either input can be the smaller one.
+  std::shared_ptr<TableWrapper> get_right_table_op(const bool compressed, const int32_t unmatched_row_count) {
+    auto table = std::make_shared<Table>(2);
+    table->add_column("c", "int", true);
+    table->add_column("d", "string", false);
+    table->append({2, "b1"});
+    table->append({2, "b2"});
+    table->append({3, "b3"});
+    table->append({5, "b4"});
+    table->append({NULL_VALUE, "b5"});
+    for (auto value = int32_t{0}; value < unmatched_row_count; ++value) {
+      table->append({100 + value, "u" + std::to_string(value)});
+    }
+    return _wrap(table, compressed);
+  }
+
+  // Returns the expected output of a join of the left with the right table with the given rows.
+  static std::shared_ptr<Table> expected_table(const JoinMode mode,
+                                               const std::vector<std::vector<AllTypeVariant>>& rows) {
+    if (mode == JoinMode::Semi || mode == JoinMode::Anti) {
+      return _create_table({{"a", "int"}, {"b", "string"}}, rows);
+    }
+    return _create_table({{"a", "int"}, {"b", "string"}, {"c", "int"}, {"d", "string"}}, rows);
+  }
+
+  // Joins the left table with the right table on a = c for all combinations of encodings, build sides, and radix
+  // partitionings and checks the result. With 10 radix bits, the inputs are partitioned in two passes.
+  void check_join(const JoinMode mode, const std::vector<std::vector<AllTypeVariant>>& expected_rows) {
+    const auto expected_output = expected_table(mode, expected_rows);
+    for (const auto compressed : {false, true}) {
+      for (const auto unmatched_row_count : {0, 5}) {
+        for (const auto radix_bits : {std::optional<uint8_t>{}, std::optional<uint8_t>{1}, std::optional<uint8_t>{3},
+                                      std::optional<uint8_t>{10}}) {
+          const auto join = std::make_shared<JoinHash>(get_left_table_op(compressed),
+                                                       get_right_table_op(compressed, unmatched_row_count), mode,
+                                                       ColumnID{0}, ColumnID{0});
+          join->set_radix_bits(radix_bits);
+          join->execute();
+          SCOPED_TRACE("compressed: " + std::to_string(compressed) + ", unmatched rows: " +
+                       std::to_string(unmatched_row_count) +
+                       ", radix bits: " + (radix_bits ? std::to_string(*radix_bits) : "auto"));
+          EXPECT_TABLE_EQ(join->get_output(), expected_output);
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _wrap(const std::shared_ptr<Table>& table, const bool compressed) {
+    if (compressed) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+};
+
+TEST_F(OperatorsJoinHashTest, Getters) {
+  const auto join = std::make_shared<JoinHash>(get_left_table_op(false), get_right_table_op(false, 0),
+                                               JoinMode::Semi, ColumnID{0}, ColumnID{1});
+  EXPECT_EQ(join->mode(), JoinMode::Semi);
+  EXPECT_EQ(join->left_column_id(), ColumnID{0});
+  EXPECT_EQ(join->scan_type(), ScanType::OpEquals);
+  EXPECT_EQ(join->right_column_id(), ColumnID{1});
+  EXPECT_EQ(join->radix_bits(), std::nullopt);
+
+  join->set_radix_bits(4);
+  EXPECT_EQ(join->radix_bits(), 4);
+  EXPECT_THROW(join->set_radix_bits(JoinHash::MAX_RADIX_BITS + 1), std::logic_error);
+}
+
+TEST_F(OperatorsJoinHashTest, DetermineRadixBits) {
+  EXPECT_EQ(JoinHash::determine_radix_bits(1'000, 1'000'000'000), 0);
+  EXPECT_EQ(JoinHash::determine_radix_bits(1'000'000'000, 1'000), 0);
+
+  // 2^22 rows of 32 bytes each are split into 2^9 partitions of 256 KiB.
+  EXPECT_EQ(JoinHash::determine_radix_bits(uint64_t{1} << 22, uint64_t{1} << 24), 9);
+  EXPECT_EQ(JoinHash::determine_radix_bits(uint64_t{1} << 40, uint64_t{1} << 40), JoinHash::MAX_RADIX_BITS);
+}
+
+TEST_F(OperatorsJoinHashTest, InnerJoin) {
+  check_join(JoinMode::Inner, {{2, "a2", 2, "b1"}, {2, "a2", 2, "b2"}, {2, "a3", 2, "b1"}, {2, "a3", 2, "b2"},
+                               {5, "a6", 5, "b4"}});
+
+  const auto join = std::make_shared<JoinHash>(get_left_table_op(false), get_right_table_op(false, 0),
+                                               JoinMode::Inner, ColumnID{0}, ColumnID{0});
+  join->execute();
+  EXPECT_EQ(join->get_output()->column_names(), (std::vector<std::string>{"a", "b", "c", "d"}));
+}
+
+TEST_F(OperatorsJoinHashTest, LeftJoin) {
+  check_join(JoinMode::Left, {{1, "a1", NULL_VALUE, NULL_VALUE},
+                              {2, "a2", 2, "b1"},
+                              {2, "a2", 2, "b2"},
+                              {2, "a3", 2, "b1"},
+                              {2, "a3", 2, "b2"},
+                              {4, "a5", NULL_VALUE, NULL_VALUE},
+                              {5, "a6", 5, "b4"},
+                              {NULL_VALUE, "a4", NULL_VALUE, NULL_VALUE}});
+
+  const auto join = std::make_shared<JoinHash>(get_left_table_op(false), get_right_table_op(false, 0),
+                                               JoinMode::Left, ColumnID{0}, ColumnID{0});
+  join->execute();
+  EXPECT_TRUE(join->get_output()->column_nullable(ColumnID{3}));
+}
+
+TEST_F(OperatorsJoinHashTest, SemiJoin) {
+  check_join(JoinMode::Semi, {{2, "a2"}, {2, "a3"}, {5, "a6"}});
+}
+
+TEST_F(OperatorsJoinHashTest, AntiJoin) {
+  check_join(JoinMode::Anti, {{1, "a1"}, {4, "a5"}, {NULL_VALUE, "a4"}});
+}
+
+TEST_F(OperatorsJoinHashTest, StringJoin) {
+  // The right input holds the strings of the left table in a different order.
+  auto right_table = std::make_shared<Table>(2);
+  right_table->add_column("c", "int", true);
+  right_table->add_column("d", "string", false);
+  right_table->append({5, "a6"});
+  right_table->append({NULL_VALUE, "a4"});
+  right_table->append({2, "a3"});
+  right_table->append({1, "a1"});
+  const auto right_table_op = _wrap(right_table, false);
+
+  const auto join = std::make_shared<JoinHash>(get_left_table_op(true), right_table_op, JoinMode::Inner, ColumnID{1},
+                                               ColumnID{1});
+  join->execute();
+  const auto expected_output =
+      expected_table(JoinMode::Inner, {{1, "a1", 1, "a1"},
+                                       {2, "a3", 2, "a3"},
+                                       {NULL_VALUE, "a4", NULL_VALUE, "a4"},
+                                       {5, "a6", 5, "a6"}});
+  EXPECT_TABLE_EQ(join->get_output(), expected_output);
+
+  const auto radix_join = std::make_shared<JoinHash>(get_left_table_op(true), right_table_op, JoinMode::Inner,
+                                                     ColumnID{1}, ColumnID{1});
+  radix_join->set_radix_bits(2);
+  radix_join->execute();
+  EXPECT_TABLE_EQ(radix_join->get_output(), expected_output);
+}
+
+TEST_F(OperatorsJoinHashTest, JoinReferenceSegments) {
+  const auto left_table_op = get_left_table_op(true);
+  const auto right_table_op = get_right_table_op(false, 0);
+  const auto left_scan = std::make_shared<TableScan>(left_table_op, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  left_scan->execute();
+  const auto right_scan = std::make_shared<TableScan>(right_table_op, ColumnID{0}, ScanType::OpLessThan, 5);
+  right_scan->execute();
+
+  const auto join = std::make_shared<JoinHash>(left_scan, right_scan, JoinMode::Inner, ColumnID{0}, ColumnID{0});
+  join->execute();
+  const auto& output = join->get_output();
+  EXPECT_TABLE_EQ(output, expected_table(JoinMode::Inner, {{2, "a2", 2, "b1"},
+                                                            {2, "a2", 2, "b2"},
+                                                            {2, "a3", 2, "b1"},
+                                                            {2, "a3", 2, "b2"}}));
+
+  // The output references the data tables and not the scans' outputs.
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    const auto left_segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk->get_segment(ColumnID{1}));
+    const auto right_segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk->get_segment(ColumnID{3}));
+    ASSERT_TRUE(left_segment && right_segment);
+    EXPECT_EQ(left_segment->referenced_table(), left_table_op->get_output());
+    EXPECT_EQ(left_segment->referenced_column_id(), ColumnID{1});
+    EXPECT_EQ(right_segment->referenced_table(), right_table_op->get_output());
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, OutputChunksAreLimitedToTargetChunkSize) {
+  // Each of the 10 probe rows finds 10 build rows, but the chunks hold at most 7 rows, as the left input's chunks.
+  auto left_table = std::make_shared<Table>(7);
+  left_table->add_column("a", "int", false);
+  auto right_table = std::make_shared<Table>(100);
+  right_table->add_column("b", "int", false);
+  for (auto index = int32_t{0}; index < 10; ++index) {
+    left_table->append({1});
+    right_table->append({1});
+  }
+
+  for (const auto radix_bits : {uint8_t{0}, uint8_t{2}}) {
+    const auto join = std::make_shared<JoinHash>(_wrap(left_table, false), _wrap(right_table, false),
+                                                 JoinMode::Inner, ColumnID{0}, ColumnID{0});
+    join->set_radix_bits(radix_bits);
+    join->execute();
+
+    const auto& output = join->get_output();
+    EXPECT_EQ(output->row_count(), 100u);
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      EXPECT_LE(output->get_chunk(chunk_id)->size(), 7u);
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, EmptyResult) {
+  const auto left_scan = std::make_shared<TableScan>(get_left_table_op(false), ColumnID{0}, ScanType::OpEquals, 42);
+  left_scan->execute();
+
+  const auto join = std::make_shared<JoinHash>(left_scan, get_right_table_op(false, 0), JoinMode::Inner, ColumnID{0},
+                                               ColumnID{0});
+  join->execute();
+  const auto& output = join->get_output();
+  EXPECT_EQ(output->row_count(), 0);
+  EXPECT_EQ(output->chunk_count(), 1);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->column_count(), 4);
+}
+
+TEST_F(OperatorsJoinHashTest, DifferentColumnTypesFail) {
+  const auto join = std::make_shared<JoinHash>(get_left_table_op(false), get_right_table_op(false, 0),
+                                               JoinMode::Inner, ColumnID{0}, ColumnID{1});
+  EXPECT_THROW(join->execute(), std::logic_error);
+}
+
+}  // namespace opossum
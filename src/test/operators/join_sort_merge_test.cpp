@@ -0,0 +1,245 @@
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/join_hash.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class OperatorsJoinSortMergeTest : public BaseTest {
+ protected:
+  // Creates a table with the nullable join column "key" and the column "id", which holds the row number.
+  std::shared_ptr<TableWrapper> get_table_op(const std::vector<std::optional<int32_t>>& keys,
+                                             const ChunkOffset chunk_size, const bool compressed) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("key", "int", true);
+    table->add_column("id", "int", false);
+    for (auto row_index = size_t{0}; row_index < keys.size(); ++row_index) {
+      const auto& key = keys[row_index];
+      table->append({key ? AllTypeVariant{*key} : AllTypeVariant{NULL_VALUE}, static_cast<int32_t>(row_index)});
+    }
+
+    if (compressed) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Returns the expected output of joining the keys with a nested loop.
+  std::shared_ptr<Table> get_expected_table(const std::vector<std::optional<int32_t>>& left_keys,
+                                            const std::vector<std::optional<int32_t>>& right_keys,
+                                            const JoinMode mode, const ScanType scan_type) {
+    const auto to_variant = [](const std::optional<int32_t>& key) {
+      return key ? AllTypeVariant{*key} : AllTypeVariant{NULL_VALUE};
+    };
+    const auto matches = [&](const int32_t left_key, const int32_t right_key) {
+      switch (scan_type) {
+        case ScanType::OpEquals:
+          return left_key == right_key;
+        case ScanType::OpNotEquals:
+          return left_key != right_key;
+        case ScanType::OpLessThan:
+          return left_key < right_key;
+        case ScanType::OpLessThanEquals:
+          return left_key <= right_key;
+        case ScanType::OpGreaterThan:
+          return left_key > right_key;
+        case ScanType::OpGreaterThanEquals:
+          return left_key >= right_key;
+        default:
+          throw std::logic_error("Unexpected scan type.");
+      }
+    };
+
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (auto left_index = size_t{0}; left_index < left_keys.size(); ++left_index) {
+      const auto left_key = to_variant(left_keys[left_index]);
+      const auto left_id = AllTypeVariant{static_cast<int32_t>(left_index)};
+      auto match_count = size_t{0};
+      for (auto right_index = size_t{0}; right_index < right_keys.size(); ++right_index) {
+        if (!left_keys[left_index] || !right_keys[right_index] ||
+            !matches(*left_keys[left_index], *right_keys[right_index])) {
+          continue;
+        }
+        ++match_count;
+        if (mode == JoinMode::Inner || mode == JoinMode::Left) {
+          rows.push_back({left_key, left_id, to_variant(right_keys[right_index]), static_cast<int32_t>(right_index)});
+        }
+      }
+
+      if ((mode == JoinMode::Semi && match_count) || (mode == JoinMode::Anti && !match_count)) {
+        rows.push_back({left_key, left_id});
+      } else if (mode == JoinMode::Left && !match_count) {
+        rows.push_back({left_key, left_id, NULL_VALUE, NULL_VALUE});
+      }
+    }
+
+    if (mode == JoinMode::Semi || mode == JoinMode::Anti) {
+      return _create_table({{"key", "int"}, {"id", "int"}}, rows);
+    }
+    return _create_table({{"key", "int"}, {"id", "int"}, {"key", "int"}, {"id", "int"}}, rows);
+  }
+
+  // Returns count random keys in [0, 20), about a tenth of which are NULL.
+  std::vector<std::optional<int32_t>> get_random_keys(const size_t count, std::mt19937& generator) {
+    auto distribution = std::uniform_int_distribution<int32_t>{-2, 19};
+    auto keys = std::vector<std::optional<int32_t>>(count);
+    for (auto& key : keys) {
+      const auto value = distribution(generator);
+      if (value >= 0) {
+        key = value;
+      }
+    }
+    return keys;
+  }
+
+  void check_join(const std::vector<std::optional<int32_t>>& left_keys,
+                  const std::vector<std::optional<int32_t>>& right_keys, const ChunkOffset chunk_size) {
+    for (const auto compressed : {false, true}) {
+      const auto left_table_op = get_table_op(left_keys, chunk_size, compressed);
+      const auto right_table_op = get_table_op(right_keys, chunk_size, compressed);
+      for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::Anti}) {
+        for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                     ScanType::OpLessThanEquals, ScanType::OpGreaterThan,
+                                     ScanType::OpGreaterThanEquals}) {
+          const auto join = std::make_shared<JoinSortMerge>(left_table_op, right_table_op, mode, ColumnID{0},
+                                                            scan_type, ColumnID{0});
+          join->execute();
+          SCOPED_TRACE("compressed: " + std::to_string(compressed) + ", mode: " +
+                       std::to_string(static_cast<int>(mode)) +
+                       ", scan type: " + std::to_string(static_cast<int>(scan_type)));
+          EXPECT_TABLE_EQ(join->get_output(), get_expected_table(left_keys, right_keys, mode, scan_type));
+        }
+      }
+    }
+  }
+};
+
+TEST_F(OperatorsJoinSortMergeTest, Getters) {
+  const auto table_op = get_table_op({1, 2}, 2, false);
+  const auto join = std::make_shared<JoinSortMerge>(table_op, table_op, JoinMode::Left, ColumnID{0},
+                                                    ScanType::OpLessThan, ColumnID{1});
+  EXPECT_EQ(join->mode(), JoinMode::Left);
+  EXPECT_EQ(join->left_column_id(), ColumnID{0});
+  EXPECT_EQ(join->scan_type(), ScanType::OpLessThan);
+  EXPECT_EQ(join->right_column_id(), ColumnID{1});
+}
+
+TEST_F(OperatorsJoinSortMergeTest, SmallJoins) {
+  check_join({1, 2, 2, std::nullopt, 4, 5}, {2, 2, 3, 5, std::nullopt}, 3);
+  check_join({3, 1, 2}, {}, 2);
+  check_join({}, {3, 1, 2}, 2);
+  check_join({std::nullopt, std::nullopt}, {std::nullopt, 1}, 2);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, UnsortedInputs) {
+  // Many unsorted chunks of different sizes are merged in several rounds. More than MORSEL_ROW_COUNT left rows are
+  // merged in multiple morsels.
+  auto generator = std::mt19937{42};
+  check_join(get_random_keys(150, generator), get_random_keys(80, generator), 7);
+
+  const auto left_keys = get_random_keys(JoinSortMerge::MORSEL_ROW_COUNT + 100, generator);
+  const auto right_keys = get_random_keys(20, generator);
+  const auto left_table_op = get_table_op(left_keys, 1'000, false);
+  const auto right_table_op = get_table_op(right_keys, 3, true);
+  const auto join = std::make_shared<JoinSortMerge>(left_table_op, right_table_op, JoinMode::Inner, ColumnID{0},
+                                                    ScanType::OpEquals, ColumnID{0});
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(), get_expected_table(left_keys, right_keys, JoinMode::Inner, ScanType::OpEquals));
+}
+
+TEST_F(OperatorsJoinSortMergeTest, SortedInputs) {
+  // Chunks that are sorted individually but not in order, sorted chunks in order, and sorted values with NULLs.
+  check_join({4, 5, 6, 1, 2, 3, 7, 8, 9}, {1, 1, 2, 3, 5, 8, 13}, 3);
+  check_join({1, 2, 3, 3, 3, 4, 5, 5, 9}, {0, 3, 3, 6, 9, 12}, 3);
+  check_join({std::nullopt, 1, 2, std::nullopt, 4, 4}, {1, std::nullopt, 4}, 2);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, MatchesJoinHash) {
+  auto generator = std::mt19937{7};
+  const auto left_table_op = get_table_op(get_random_keys(200, generator), 16, true);
+  const auto right_table_op = get_table_op(get_random_keys(100, generator), 10, false);
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::Anti}) {
+    const auto sort_merge_join = std::make_shared<JoinSortMerge>(left_table_op, right_table_op, mode, ColumnID{0},
+                                                                 ScanType::OpEquals, ColumnID{0});
+    sort_merge_join->execute();
+    const auto hash_join = std::make_shared<JoinHash>(left_table_op, right_table_op, mode, ColumnID{0}, ColumnID{0});
+    hash_join->execute();
+    EXPECT_TABLE_EQ(sort_merge_join->get_output(), hash_join->get_output());
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, StringJoin) {
+  auto left_table = std::make_shared<Table>(2);
+  left_table->add_column("name", "string", false);
+  left_table->append({"carol"});
+  left_table->append({"alice"});
+  left_table->append({"bob"});
+  auto right_table = std::make_shared<Table>(2);
+  right_table->add_column("name", "string", false);
+  right_table->append({"bob"});
+  right_table->append({"alice"});
+  right_table->compress_chunk(ChunkID{0});
+
+  const auto left_table_op = std::make_shared<TableWrapper>(left_table);
+  left_table_op->execute();
+  const auto right_table_op = std::make_shared<TableWrapper>(right_table);
+  right_table_op->execute();
+
+  const auto join = std::make_shared<JoinSortMerge>(left_table_op, right_table_op, JoinMode::Inner, ColumnID{0},
+                                                    ScanType::OpGreaterThan, ColumnID{0});
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(), _create_table({{"name", "string"}, {"name", "string"}},
+                                                    {{"bob", "alice"}, {"carol", "alice"}, {"carol", "bob"}}));
+}
+
+TEST_F(OperatorsJoinSortMergeTest, JoinReferenceSegments) {
+  const auto left_table_op = get_table_op({5, 1, std::nullopt, 3, 4}, 2, true);
+  const auto right_table_op = get_table_op({2, 4, 6}, 2, false);
+  const auto left_scan = std::make_shared<TableScan>(left_table_op, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  left_scan->execute();
+
+  const auto join = std::make_shared<JoinSortMerge>(left_scan, right_table_op, JoinMode::Inner, ColumnID{0},
+                                                    ScanType::OpLessThanEquals, ColumnID{0});
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(),
+                  _create_table({{"key", "int"}, {"id", "int"}, {"key", "int"}, {"id", "int"}},
+                                {{3, 3, 4, 1}, {3, 3, 6, 2}, {4, 4, 4, 1}, {4, 4, 6, 2}, {5, 0, 6, 2}}));
+}
+
+TEST_F(OperatorsJoinSortMergeTest, OutputChunksAreLimitedToTargetChunkSize) {
+  // All 20 left rows match all 30 right rows. The single morsel is split into chunks of the left input's size.
+  const auto left_table_op = get_table_op(std::vector<std::optional<int32_t>>(20, 1), 8, false);
+  const auto right_table_op = get_table_op(std::vector<std::optional<int32_t>>(30, 1), 8, false);
+  const auto join = std::make_shared<JoinSortMerge>(left_table_op, right_table_op, JoinMode::Inner, ColumnID{0},
+                                                    ScanType::OpEquals, ColumnID{0});
+  join->execute();
+
+  const auto& output = join->get_output();
+  EXPECT_EQ(output->row_count(), 600u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_LE(output->get_chunk(chunk_id)->size(), 8u);
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, UnsupportedScanTypesFail) {
+  const auto table_op = get_table_op({1, 2}, 2, false);
+  for (const auto scan_type : {ScanType::OpLike, ScanType::OpNotLike, ScanType::OpIsNull, ScanType::OpIsNotNull}) {
+    const auto join =
+        std::make_shared<JoinSortMerge>(table_op, table_op, JoinMode::Inner, ColumnID{0}, scan_type, ColumnID{0});
+    EXPECT_THROW(join->execute(), std::logic_error);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,128 @@
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/join_hash.hpp"
+#include "operators/limit.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+
+namespace opossum {
+
+class OperatorsLimitTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int", false);
+    table->add_column("b", "string", true);
+    for (auto value = int32_t{0}; value < 10; ++value) {
+      table->append({value, value % 3 ? AllTypeVariant{std::to_string(value)} : NULL_VALUE});
+    }
+    table->compress_chunk(ChunkID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // Returns a table with the first row_count rows of the table in _table_wrapper.
+  std::shared_ptr<Table> get_expected_table(const int32_t row_count) {
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (auto value = int32_t{0}; value < row_count; ++value) {
+      rows.push_back({value, value % 3 ? AllTypeVariant{std::to_string(value)} : NULL_VALUE});
+    }
+    return _create_table({{"a", "int"}, {"b", "string"}}, rows);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsLimitTest, LimitDataTable) {
+  for (const auto row_count : {uint64_t{1}, uint64_t{3}, uint64_t{5}}) {
+    auto limit = std::make_shared<Limit>(_table_wrapper, row_count);
+    EXPECT_EQ(limit->row_count(), row_count);
+    limit->execute();
+
+    const auto output = limit->get_output();
+    EXPECT_EQ(output->row_count(), row_count);
+    EXPECT_EQ(output->column_count(), 2);
+    EXPECT_EQ(output->column_name(ColumnID{1}), "b");
+    EXPECT_TRUE(output->column_nullable(ColumnID{1}));
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto segment = output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+      EXPECT_TRUE(std::dynamic_pointer_cast<ReferenceSegment>(segment));
+    }
+    EXPECT_TABLE_EQ(output, get_expected_table(static_cast<int32_t>(row_count)), true);
+  }
+}
+
+TEST_F(OperatorsLimitTest, LimitReferenceTable) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  auto limit = std::make_shared<Limit>(scan, 5);
+  scan->execute();
+  limit->execute();
+
+  const auto output = limit->get_output();
+  EXPECT_TABLE_EQ(output, _create_table({{"a", "int"}, {"b", "string"}},
+                                        {{2, "2"}, {3, NULL_VALUE}, {4, "4"}, {5, "5"}, {6, NULL_VALUE}}),
+                  true);
+
+  // The output references the data table, not the scan's output.
+  const auto segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsLimitTest, LimitLargerThanInput) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 100);
+  limit->execute();
+  EXPECT_TABLE_EQ(limit->get_output(), get_expected_table(10), true);
+}
+
+TEST_F(OperatorsLimitTest, PropagateRowBudgets) {
+  // The Limit is the scan's only consumer, so the scan only needs to find five rows.
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  auto limit = std::make_shared<Limit>(scan, 5);
+  EXPECT_FALSE(scan->row_budget());
+  Limit::propagate_row_budgets(limit);
+  EXPECT_EQ(scan->row_budget(), uint64_t{5});
+
+  // Nested Limits keep the smaller budget.
+  auto other_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  Limit::propagate_row_budgets(std::make_shared<Limit>(std::make_shared<Limit>(other_scan, 3), 5));
+  EXPECT_EQ(other_scan->row_budget(), uint64_t{3});
+}
+
+TEST_F(OperatorsLimitTest, NoRowBudgetForSharedInputs) {
+  // The scan feeds both the Limit and the join, which needs all of the scan's rows.
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  auto limit = std::make_shared<Limit>(scan, 2);
+  auto join = std::make_shared<JoinHash>(limit, scan, JoinMode::Semi, ColumnID{0}, ColumnID{0});
+  Limit::propagate_row_budgets(join);
+  EXPECT_FALSE(scan->row_budget());
+
+  scan->execute();
+  limit->execute();
+  join->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 8);
+  EXPECT_TABLE_EQ(join->get_output(), _create_table({{"a", "int"}, {"b", "string"}}, {{2, "2"}, {3, NULL_VALUE}}),
+                  true);
+}
+
+TEST_F(OperatorsLimitTest, EmptyLimit) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 0);
+  limit->execute();
+  EXPECT_EQ(limit->get_output()->row_count(), 0);
+  EXPECT_EQ(limit->get_output()->chunk_count(), 1);
+  EXPECT_EQ(limit->get_output()->column_count(), 2);
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  auto limit_on_empty_input = std::make_shared<Limit>(scan, 3);
+  scan->execute();
+  limit_on_empty_input->execute();
+  EXPECT_EQ(limit_on_empty_input->get_output()->row_count(), 0);
+}
+
+}  // namespace opossum
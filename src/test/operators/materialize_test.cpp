@@ -0,0 +1,123 @@
+#include <string>
+
+#include "base_test.hpp"
+
+#include "operators/join_hash.hpp"
+#include "operators/materialize.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+
+namespace opossum {
+
+class OperatorsMaterializeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int", false);
+    table->add_column("b", "string", true);
+    table->add_column("c", "double", true);
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      table->append({value, value % 4 ? AllTypeVariant{"s" + std::to_string(value % 7)} : NULL_VALUE,
+                     value % 5 ? AllTypeVariant{value * 0.5} : NULL_VALUE});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 2) {
+      table->compress_chunk(chunk_id);
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // Materializes the output of the operator and checks that the values, the column definitions, and the chunk sizes
+  // are as expected.
+  void check_materialize(const std::shared_ptr<const AbstractOperator>& input, const bool dictionary_encode) {
+    auto materialize = std::make_shared<Materialize>(input, dictionary_encode);
+    materialize->set_max_parallelism(4);
+    materialize->execute();
+
+    const auto input_table = input->get_output();
+    const auto output = materialize->get_output();
+    EXPECT_TABLE_EQ(output, input_table, true);
+    EXPECT_EQ(output->target_chunk_size(), input_table->target_chunk_size());
+    for (auto column_id = ColumnID{0}; column_id < output->column_count(); ++column_id) {
+      EXPECT_EQ(output->column_name(column_id), input_table->column_name(column_id));
+      EXPECT_EQ(output->column_type(column_id), input_table->column_type(column_id));
+      EXPECT_EQ(output->column_nullable(column_id), input_table->column_nullable(column_id));
+    }
+
+    const auto chunk_count = output->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = output->get_chunk(chunk_id);
+      if (chunk_id + 1 < chunk_count) {
+        EXPECT_EQ(chunk->size(), output->target_chunk_size());
+      }
+      for (auto column_id = ColumnID{0}; column_id < output->column_count(); ++column_id) {
+        EXPECT_FALSE(std::dynamic_pointer_cast<ReferenceSegment>(chunk->get_segment(column_id)));
+      }
+      const auto first_segment = chunk->get_segment(ColumnID{0});
+      EXPECT_EQ(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(first_segment) != nullptr, dictionary_encode);
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsMaterializeTest, DataTable) {
+  check_materialize(_table_wrapper, false);
+  check_materialize(_table_wrapper, true);
+}
+
+TEST_F(OperatorsMaterializeTest, ScannedTableIsRechunked) {
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 15);
+  scan_a->execute();
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::OpNotEquals, "s3");
+  scan_b->execute();
+  check_materialize(scan_b, false);
+  check_materialize(scan_b, true);
+
+  auto materialize = std::make_shared<Materialize>(scan_b);
+  EXPECT_FALSE(materialize->dictionary_encode());
+  materialize->execute();
+  const auto output = materialize->get_output();
+  EXPECT_EQ(output->row_count(), scan_b->get_output()->row_count());
+  EXPECT_EQ(output->chunk_count(), (output->row_count() + 9) / 10);
+}
+
+TEST_F(OperatorsMaterializeTest, PositionsInRandomOrder) {
+  const auto sort_definitions = std::vector<SortColumnDefinition>{{ColumnID{2}, SortMode::Descending}};
+  auto sort = std::make_shared<Sort>(_table_wrapper, sort_definitions, 7);
+  sort->execute();
+  check_materialize(sort, false);
+}
+
+TEST_F(OperatorsMaterializeTest, NullRowIDs) {
+  auto right_table = std::make_shared<Table>(3);
+  right_table->add_column("x", "int", false);
+  right_table->add_column("y", "string", false);
+  right_table->append({2, "two"});
+  right_table->append({5, "five"});
+  right_table->append({5, "FIVE"});
+  right_table->append({42, "forty-two"});
+  auto right_table_wrapper = std::make_shared<TableWrapper>(right_table);
+  right_table_wrapper->execute();
+
+  auto join = std::make_shared<JoinHash>(_table_wrapper, right_table_wrapper, JoinMode::Left, ColumnID{0}, ColumnID{0});
+  join->execute();
+  check_materialize(join, false);
+}
+
+TEST_F(OperatorsMaterializeTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1'000);
+  scan->execute();
+  auto materialize = std::make_shared<Materialize>(scan, true);
+  EXPECT_TRUE(materialize->dictionary_encode());
+  EXPECT_THROW(materialize->set_max_parallelism(0), std::logic_error);
+  materialize->execute();
+  EXPECT_EQ(materialize->get_output()->row_count(), 0);
+  EXPECT_EQ(materialize->get_output()->column_count(), 3);
+}
+
+}  // namespace opossum
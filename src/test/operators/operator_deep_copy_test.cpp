@@ -0,0 +1,120 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/limit.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class OperatorsDeepCopyTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "int", false);
+    table->add_column("b", "string", true);
+    for (auto value = int32_t{0}; value < 20; ++value) {
+      table->append({value % 10, value % 4 ? AllTypeVariant{"s" + std::to_string(value)} : NULL_VALUE});
+    }
+    table->compress_chunk(ChunkID{1});
+    StorageManager::get().add_table("table", table);
+  }
+};
+
+TEST_F(OperatorsDeepCopyTest, CopiesExecutedPlans) {
+  const auto get_table = std::make_shared<GetTable>("table");
+  const auto scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpGreaterThan, 3);
+  scan->set_max_parallelism(2);
+  const auto sort = std::make_shared<Sort>(scan, std::vector<SortColumnDefinition>{{ColumnID{1}}}, ChunkOffset{5});
+  const auto limit = std::make_shared<Limit>(sort, 7);
+  Limit::propagate_row_budgets(limit);
+  get_table->execute();
+  scan->execute();
+  sort->execute();
+  limit->execute();
+
+  const auto copy = limit->deep_copy();
+  EXPECT_NE(copy, limit);
+  EXPECT_FALSE(copy->was_executed());
+  const auto& copied_sort = static_cast<const Sort&>(*copy->left_input());
+  EXPECT_EQ(copied_sort.output_chunk_size(), 5);
+  EXPECT_EQ(copied_sort.row_budget(), 7);
+  const auto& copied_scan = static_cast<const TableScan&>(*copied_sort.left_input());
+  EXPECT_EQ(copied_scan.max_parallelism(), 2);
+  EXPECT_EQ(copied_scan.search_value(), AllTypeVariant{3});
+  EXPECT_FALSE(copied_scan.left_input()->was_executed());
+
+  std::const_pointer_cast<AbstractOperator>(copied_scan.left_input())->execute();
+  std::const_pointer_cast<AbstractOperator>(copied_sort.left_input())->execute();
+  std::const_pointer_cast<AbstractOperator>(copy->left_input())->execute();
+  copy->execute();
+  EXPECT_TABLE_EQ(copy->get_output(), limit->get_output(), true);
+}
+
+TEST_F(OperatorsDeepCopyTest, CopiesSharedInputsOnce) {
+  const auto input = std::make_shared<GetTable>("table");
+  const auto join = std::make_shared<JoinHash>(input, input, JoinMode::Inner, ColumnID{0}, ColumnID{0});
+  join->set_radix_bits(2);
+
+  const auto copy = join->deep_copy();
+  EXPECT_NE(copy->left_input(), input);
+  EXPECT_EQ(copy->left_input(), copy->right_input());
+  EXPECT_EQ(static_cast<const JoinHash&>(*copy).radix_bits(), 2);
+}
+
+TEST_F(OperatorsDeepCopyTest, BindsParameters) {
+  const auto scan_a = std::make_shared<TableScan>(std::make_shared<GetTable>("table"), ColumnID{0},
+                                                  ScanType::OpLessThan, ParameterID{0});
+  const auto plan_template = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::OpIsNotNull, NULL_VALUE);
+  EXPECT_EQ(scan_a->parameter_id(), ParameterID{0});
+  EXPECT_EQ(plan_template->parameter_id(), std::nullopt);
+
+  const auto execute = [](const std::shared_ptr<AbstractOperator>& plan) {
+    const auto scan = std::const_pointer_cast<AbstractOperator>(plan->left_input());
+    std::const_pointer_cast<AbstractOperator>(scan->left_input())->execute();
+    scan->execute();
+    plan->execute();
+    return plan->get_output();
+  };
+
+  // Unbound placeholders cannot be executed.
+  EXPECT_THROW(execute(plan_template->deep_copy()), std::logic_error);
+
+  for (const auto upper_bound : {2, 5}) {
+    const auto plan = plan_template->deep_copy();
+    plan->set_parameters({{ParameterID{0}, upper_bound}, {ParameterID{1}, 100}});
+    const auto& bound_scan = static_cast<const TableScan&>(*plan->left_input());
+    EXPECT_EQ(bound_scan.parameter_id(), std::nullopt);
+    EXPECT_EQ(bound_scan.search_value(), AllTypeVariant{upper_bound});
+
+    // b is NULL in every fourth row, i.e., where a is 0, 4, or 8 in the first and 2 or 6 in the second ten rows.
+    const auto expected_row_count = upper_bound == 2 ? 3 : 7;
+    EXPECT_EQ(execute(plan)->row_count(), expected_row_count);
+  }
+
+  // The template keeps its placeholder.
+  EXPECT_EQ(scan_a->parameter_id(), ParameterID{0});
+}
+
+TEST_F(OperatorsDeepCopyTest, CopiesPipelines) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(StorageManager::get().get_table("table"));
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 3);
+  const auto pipeline = std::make_shared<Pipeline>(std::make_shared<Limit>(scan, 10));
+  table_wrapper->execute();
+  pipeline->execute();
+
+  const auto copy = std::static_pointer_cast<Pipeline>(pipeline->deep_copy());
+  EXPECT_EQ(copy->stage_count(), 2);
+  EXPECT_NE(copy->left_input(), table_wrapper);
+  std::const_pointer_cast<AbstractOperator>(copy->left_input())->execute();
+  copy->execute();
+  EXPECT_TABLE_EQ(copy->get_output(), pipeline->get_output(), true);
+}
+
+}  // namespace opossum
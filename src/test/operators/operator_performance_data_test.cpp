@@ -0,0 +1,150 @@
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "operators/join_hash.hpp"
+#include "operators/limit.hpp"
+#include "operators/operator_performance_data.hpp"
+#include "operators/print.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/worker_thread_recorder.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace opossum {
+
+class OperatorsPerformanceDataTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "int", false);
+    table->add_column("b", "string", true);
+    for (auto value = int32_t{0}; value < 20; ++value) {
+      table->append({value % 10, value % 4 ? AllTypeVariant{"s" + std::to_string(value)} : NULL_VALUE});
+    }
+    table->compress_chunk(ChunkID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  static std::vector<std::string> phase_names(const OperatorPerformanceData& performance_data) {
+    auto names = std::vector<std::string>{};
+    for (const auto& phase : performance_data.phases) {
+      names.push_back(phase.first);
+    }
+    return names;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsPerformanceDataTest, RecordsExecution) {
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  EXPECT_EQ(scan->performance_data().output_row_count, 0);
+  scan->execute();
+
+  const auto& performance_data = scan->performance_data();
+  EXPECT_GT(performance_data.walltime.count(), 0);
+  EXPECT_EQ(performance_data.input_row_count, 20);
+  EXPECT_EQ(performance_data.input_chunk_count, 5);
+  EXPECT_EQ(performance_data.output_row_count, 10);
+  EXPECT_EQ(performance_data.output_chunk_count, scan->get_output()->chunk_count());
+  EXPECT_EQ(performance_data.output_bytes, scan->get_output()->estimate_memory_usage());
+  EXPECT_EQ(performance_data.pruned_chunk_count, 0);
+  EXPECT_GE(performance_data.worker_thread_count, 1);
+  EXPECT_TRUE(performance_data.phases.empty());
+
+  // Asynchronous execution records the same data.
+  const auto async_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  async_scan->execute_async().get();
+  EXPECT_EQ(async_scan->performance_data().output_row_count, 10);
+  EXPECT_EQ(async_scan->performance_data().input_chunk_count, 5);
+  EXPECT_GE(async_scan->performance_data().worker_thread_count, 1);
+
+  // Stored tables and inputs that are passed on are not counted as output memory.
+  EXPECT_EQ(_table_wrapper->performance_data().output_row_count, 20);
+  EXPECT_EQ(_table_wrapper->performance_data().output_bytes, 0);
+  auto print_output = std::stringstream{};
+  const auto print = std::make_shared<Print>(scan, print_output);
+  print->execute();
+  EXPECT_EQ(print->performance_data().output_row_count, 10);
+  EXPECT_EQ(print->performance_data().output_bytes, 0);
+}
+
+TEST_F(OperatorsPerformanceDataTest, Phases) {
+  const auto join = std::make_shared<JoinHash>(_table_wrapper, _table_wrapper, JoinMode::Inner, ColumnID{0},
+                                               ColumnID{0});
+  join->set_radix_bits(0);
+  join->execute();
+  EXPECT_EQ(phase_names(join->performance_data()), (std::vector<std::string>{"Build", "Probe", "Output"}));
+  EXPECT_EQ(join->performance_data().input_row_count, 40);
+
+  const auto partitioned_join = std::make_shared<JoinHash>(_table_wrapper, _table_wrapper, JoinMode::Inner,
+                                                           ColumnID{0}, ColumnID{0});
+  partitioned_join->set_radix_bits(2);
+  partitioned_join->execute();
+  EXPECT_EQ(phase_names(partitioned_join->performance_data()),
+            (std::vector<std::string>{"Partition", "Build and probe", "Output"}));
+
+  const auto sort = std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{1}}});
+  sort->execute();
+  const auto& performance_data = sort->performance_data();
+  EXPECT_EQ(phase_names(performance_data), (std::vector<std::string>{"Preparation", "Sort", "Merge", "Output"}));
+  auto phase_sum = std::chrono::nanoseconds{0};
+  for (const auto& phase : performance_data.phases) {
+    phase_sum += phase.second;
+  }
+  EXPECT_LE(phase_sum, performance_data.walltime);
+}
+
+TEST_F(OperatorsPerformanceDataTest, PrunedChunks) {
+  const auto limit = std::make_shared<Limit>(_table_wrapper, 6);
+  limit->execute();
+  EXPECT_EQ(limit->performance_data().pruned_chunk_count, 3);
+
+  // Sequential scans with a row budget stop after the chunk that fills the budget.
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  scan->set_max_parallelism(1);
+  scan->set_row_budget(5);
+  scan->execute();
+  EXPECT_EQ(scan->performance_data().pruned_chunk_count, 3);
+}
+
+TEST_F(OperatorsPerformanceDataTest, AggregatesPlans) {
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  scan->execute();
+  // The scan is the input of both sides of the join, but counted once.
+  const auto join = std::make_shared<JoinHash>(scan, scan, JoinMode::Semi, ColumnID{0}, ColumnID{0});
+  join->execute();
+
+  const auto performance_data = aggregate_performance_data(*join);
+  EXPECT_EQ(performance_data.walltime, _table_wrapper->performance_data().walltime +
+                                           scan->performance_data().walltime + join->performance_data().walltime);
+  EXPECT_EQ(performance_data.output_row_count, 20 + 10 + 10);
+  EXPECT_EQ(performance_data.input_row_count, 20 + 2 * 10);
+  EXPECT_EQ(performance_data.phases.size(), join->performance_data().phases.size());
+
+  auto stream = std::stringstream{};
+  stream << performance_data;
+  EXPECT_NE(stream.str().find("output: 40 rows"), std::string::npos);
+  EXPECT_NE(stream.str().find("Probe: "), std::string::npos);
+}
+
+TEST_F(OperatorsPerformanceDataTest, RecordsWorkerThreads) {
+  auto recorder = WorkerThreadRecorder{};
+  {
+    const auto scope = WorkerThreadRecorder::Scope{recorder};
+    EXPECT_EQ(WorkerThreadRecorder::current(), &recorder);
+    parallel_for(8, 4, [](const size_t /*index*/) { std::this_thread::sleep_for(std::chrono::milliseconds{1}); });
+  }
+  EXPECT_EQ(WorkerThreadRecorder::current(), nullptr);
+  EXPECT_GE(recorder.thread_count(), 1);
+  EXPECT_LE(recorder.thread_count(), 4);
+}
+
+}  // namespace opossum
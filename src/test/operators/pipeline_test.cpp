@@ -0,0 +1,124 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "operators/limit.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks hold multiple batches, the last one is only partially filled.
+    auto table = std::make_shared<Table>(5'000);
+    table->add_column("a", "int", false);
+    table->add_column("b", "string", true);
+    table->add_column("c", "double", false);
+    for (auto value = int32_t{0}; value < 12'000; ++value) {
+      const auto b = value % 7 ? AllTypeVariant{"s" + std::to_string(value % 10)} : NULL_VALUE;
+      table->append({value, b, value / 2.0});
+    }
+    table->compress_chunk(ChunkID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  static std::shared_ptr<TableScan> scan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                                         const ScanType scan_type, const AllTypeVariant& search_value) {
+    return std::make_shared<TableScan>(in, column_id, scan_type, search_value);
+  }
+
+  // Executes the operators from the lowest to the root one.
+  static void execute_all(const std::vector<std::shared_ptr<AbstractOperator>>& operators) {
+    for (const auto& op : operators) {
+      op->execute();
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsPipelineTest, ScanChain) {
+  const auto scan_a = scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 100);
+  const auto scan_b = scan(scan_a, ColumnID{1}, ScanType::OpNotEquals, "s3");
+  const auto scan_c = scan(scan_b, ColumnID{2}, ScanType::OpLessThan, 5'500.0f);
+  execute_all({scan_a, scan_b, scan_c});
+
+  const auto pipeline = std::make_shared<Pipeline>(
+      scan(scan(scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 100), ColumnID{1},
+                ScanType::OpNotEquals, "s3"),
+           ColumnID{2}, ScanType::OpLessThan, 5'500.0f));
+  EXPECT_EQ(pipeline->stage_count(), 3);
+  EXPECT_EQ(pipeline->left_input(), _table_wrapper);
+  pipeline->execute();
+
+  EXPECT_GT(pipeline->get_output()->row_count(), 0);
+  EXPECT_TABLE_EQ(pipeline->get_output(), scan_c->get_output(), true);
+}
+
+TEST_F(OperatorsPipelineTest, ReferenceInput) {
+  // The pipeline's input outputs reference segments.
+  const auto input_scan = scan(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 11'000);
+  input_scan->execute();
+  const auto input = std::make_shared<TableWrapper>(input_scan->get_output());
+  input->execute();
+
+  const auto scan_b = scan(input, ColumnID{1}, ScanType::OpEquals, "s4");
+  scan_b->execute();
+
+  const auto pipeline = std::make_shared<Pipeline>(scan(input, ColumnID{1}, ScanType::OpEquals, "s4"));
+  EXPECT_EQ(pipeline->stage_count(), 1);
+  pipeline->execute();
+
+  EXPECT_TABLE_EQ(pipeline->get_output(), scan_b->get_output(), true);
+  const auto segment = pipeline->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto& reference_segment = static_cast<const ReferenceSegment&>(*segment);
+  EXPECT_EQ(reference_segment.referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsPipelineTest, NullAndLikeScans) {
+  for (const auto scan_type : {ScanType::OpIsNull, ScanType::OpIsNotNull, ScanType::OpLike, ScanType::OpNotLike}) {
+    const auto search_value = AllTypeVariant{"%1"};
+    const auto table_scan = scan(_table_wrapper, ColumnID{1}, scan_type, search_value);
+    table_scan->execute();
+
+    const auto pipeline = std::make_shared<Pipeline>(scan(_table_wrapper, ColumnID{1}, scan_type, search_value));
+    pipeline->execute();
+    EXPECT_TABLE_EQ(pipeline->get_output(), table_scan->get_output(), true);
+  }
+
+  // Comparisons with NULL never match.
+  const auto pipeline = std::make_shared<Pipeline>(scan(_table_wrapper, ColumnID{0}, ScanType::OpEquals, NULL_VALUE));
+  pipeline->execute();
+  EXPECT_EQ(pipeline->get_output()->row_count(), 0);
+  EXPECT_EQ(pipeline->get_output()->column_count(), 3);
+}
+
+TEST_F(OperatorsPipelineTest, Limit) {
+  const auto scan_a = scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 4'990);
+  const auto limit = std::make_shared<Limit>(scan_a, 20);
+  const auto scan_b = scan(limit, ColumnID{1}, ScanType::OpIsNotNull, NULL_VALUE);
+  execute_all({scan_a, limit, scan_b});
+
+  const auto pipeline_scan = scan(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 4'990);
+  const auto pipeline = std::make_shared<Pipeline>(
+      scan(std::make_shared<Limit>(pipeline_scan, 20), ColumnID{1}, ScanType::OpIsNotNull, NULL_VALUE));
+  EXPECT_EQ(pipeline->stage_count(), 3);
+  pipeline->execute();
+
+  // The limited rows span two chunks.
+  EXPECT_EQ(limit->get_output()->row_count(), 20);
+  EXPECT_EQ(pipeline->get_output()->chunk_count(), 2);
+  EXPECT_TABLE_EQ(pipeline->get_output(), scan_b->get_output(), true);
+}
+
+TEST_F(OperatorsPipelineTest, RequiresPipelineableRoot) {
+  EXPECT_THROW(Pipeline{_table_wrapper}, std::logic_error);
+}
+
+}  // namespace opossum
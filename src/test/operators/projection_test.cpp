@@ -0,0 +1,309 @@
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  std::shared_ptr<TableWrapper> get_table_op(const bool compressed) {
+    auto table = std::make_shared<Table>(2);
+    table->add_column("price", "double", false);
+    table->add_column("discount", "float", true);
+    table->add_column("quantity", "int", false);
+    table->add_column("name", "string", true);
+    table->append({10.0, 0.5f, 1, "apple"});
+    table->append({20.5, 0.25f, 3, NULL_VALUE});
+    table->append({8.0, NULL_VALUE, 4, "pear"});
+    table->append({4.0, 0.0f, 6, "fig"});
+    table->append({100.0, 1.0f, 3, "apple"});
+
+    if (compressed) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Projects the input on the expression and checks the values for all inputs, i.e., for value segments,
+  // dictionary segments, and reference segments.
+  void check_expression(const std::shared_ptr<const AbstractExpression>& expression,
+                        const std::vector<AllTypeVariant>& expected_values) {
+    const auto table = get_table_op(false)->get_output();
+    auto expected_rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (const auto& value : expected_values) {
+      expected_rows.push_back({value});
+    }
+    const auto expected_table =
+        _create_table({{expression->description(*table), expression->data_type(*table)}}, expected_rows);
+
+    for (const auto compressed : {false, true}) {
+      const auto table_wrapper = get_table_op(compressed);
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{2}, ScanType::OpGreaterThan, 0);
+      scan->execute();
+      for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{table_wrapper, scan}) {
+        auto projection = std::make_shared<Projection>(input, std::vector{expression});
+        projection->execute();
+        SCOPED_TRACE(expression->description(*table) + ", compressed: " + std::to_string(compressed));
+        EXPECT_TABLE_EQ(projection->get_output(), expected_table, true);
+      }
+    }
+  }
+
+  std::shared_ptr<const AbstractExpression> column(const ColumnID column_id) {
+    return std::make_shared<ColumnExpression>(column_id);
+  }
+
+  std::shared_ptr<const AbstractExpression> value(const AllTypeVariant& value) {
+    return std::make_shared<ValueExpression>(value);
+  }
+
+  std::shared_ptr<const AbstractExpression> arithmetic(const ArithmeticOperator arithmetic_operator,
+                                                       const std::shared_ptr<const AbstractExpression>& left,
+                                                       const std::shared_ptr<const AbstractExpression>& right) {
+    return std::make_shared<ArithmeticExpression>(arithmetic_operator, left, right);
+  }
+
+  std::shared_ptr<const AbstractExpression> compare(const ScanType scan_type,
+                                                    const std::shared_ptr<const AbstractExpression>& left,
+                                                    const std::shared_ptr<const AbstractExpression>& right) {
+    return std::make_shared<ComparisonExpression>(scan_type, left, right);
+  }
+
+  const ColumnID _price{0};
+  const ColumnID _discount{1};
+  const ColumnID _quantity{2};
+  const ColumnID _name{3};
+};
+
+TEST_F(OperatorsProjectionTest, ColumnSelectionReferencesInput) {
+  const auto table_wrapper = get_table_op(false);
+  auto projection = std::make_shared<Projection>(table_wrapper, std::vector{column(_name), column(_price)});
+  projection->execute();
+
+  const auto output = projection->get_output();
+  EXPECT_EQ(output->column_count(), 2);
+  EXPECT_EQ(output->column_name(ColumnID{0}), "name");
+  EXPECT_EQ(output->column_type(ColumnID{0}), "string");
+  EXPECT_TRUE(output->column_nullable(ColumnID{0}));
+  EXPECT_EQ(output->column_name(ColumnID{1}), "price");
+  EXPECT_EQ(output->chunk_count(), 3);
+  EXPECT_TABLE_EQ(output,
+                  _create_table({{"name", "string"}, {"price", "double"}},
+                                {{"apple", 10.0}, {NULL_VALUE, 20.5}, {"pear", 8.0}, {"fig", 4.0}, {"apple", 100.0}}),
+                  true);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment =
+        std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(chunk_id)->get_segment(ColumnID{1}));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->referenced_table(), table_wrapper->get_output());
+    EXPECT_EQ(segment->referenced_column_id(), _price);
+  }
+
+  // Reference segments of reference tables are passed on.
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{2}, ScanType::OpEquals, 3);
+  scan->execute();
+  auto scan_projection = std::make_shared<Projection>(scan, std::vector{column(_name)});
+  scan_projection->execute();
+  const auto scan_output = scan_projection->get_output();
+  EXPECT_TABLE_EQ(scan_output, _create_table({{"name", "string"}}, {{NULL_VALUE}, {"apple"}}), true);
+  EXPECT_EQ(scan_output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}),
+            scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{3}));
+}
+
+TEST_F(OperatorsProjectionTest, ScanReorderedColumns) {
+  auto projection = std::make_shared<Projection>(get_table_op(false), std::vector{column(_quantity), column(_price)});
+  projection->execute();
+  auto scan = std::make_shared<TableScan>(projection, ColumnID{0}, ScanType::OpGreaterThanEquals, 4);
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), _create_table({{"quantity", "int"}, {"price", "double"}}, {{4, 8.0}, {6, 4.0}}),
+                  true);
+}
+
+TEST_F(OperatorsProjectionTest, Arithmetic) {
+  // price * (1 - discount)
+  const auto discounted_price = arithmetic(ArithmeticOperator::Multiplication, column(_price),
+                                           arithmetic(ArithmeticOperator::Subtraction, value(1), column(_discount)));
+  check_expression(discounted_price, {5.0, 15.375, NULL_VALUE, 4.0, 0.0});
+  check_expression(arithmetic(ArithmeticOperator::Addition, column(_quantity), value(1)), {2, 4, 5, 7, 4});
+  check_expression(arithmetic(ArithmeticOperator::Subtraction, value(10), value(4)), {6, 6, 6, 6, 6});
+
+  const auto table = get_table_op(false)->get_output();
+  EXPECT_EQ(discounted_price->description(*table), "price * (1 - discount)");
+  EXPECT_EQ(discounted_price->data_type(*table), "double");
+  EXPECT_TRUE(discounted_price->is_nullable(*table));
+
+  const auto nested = arithmetic(ArithmeticOperator::Subtraction,
+                                 arithmetic(ArithmeticOperator::Subtraction, column(_quantity), value(1)),
+                                 arithmetic(ArithmeticOperator::Addition, column(_quantity), value(2)));
+  EXPECT_EQ(nested->description(*table), "quantity - 1 - (quantity + 2)");
+  EXPECT_FALSE(nested->is_nullable(*table));
+}
+
+TEST_F(OperatorsProjectionTest, TypePromotion) {
+  const auto table = get_table_op(false)->get_output();
+  EXPECT_EQ(arithmetic(ArithmeticOperator::Addition, column(_quantity), value(1))->data_type(*table), "int");
+  EXPECT_EQ(arithmetic(ArithmeticOperator::Addition, column(_quantity), value(int64_t{1}))->data_type(*table), "long");
+  EXPECT_EQ(arithmetic(ArithmeticOperator::Addition, column(_quantity), column(_discount))->data_type(*table), "float");
+  EXPECT_EQ(arithmetic(ArithmeticOperator::Addition, column(_discount), column(_price))->data_type(*table), "double");
+
+  check_expression(arithmetic(ArithmeticOperator::Multiplication, column(_quantity), value(int64_t{3'000'000'000})),
+                   {int64_t{3'000'000'000}, int64_t{9'000'000'000}, int64_t{12'000'000'000},
+                    int64_t{18'000'000'000}, int64_t{9'000'000'000}});
+  check_expression(arithmetic(ArithmeticOperator::Division, column(_quantity), value(2.0f)),
+                   {0.5f, 1.5f, 2.0f, 3.0f, 1.5f});
+}
+
+TEST_F(OperatorsProjectionTest, DivisionByZeroIsNull) {
+  // quantity / (quantity - 3)
+  check_expression(arithmetic(ArithmeticOperator::Division, column(_quantity),
+                              arithmetic(ArithmeticOperator::Subtraction, column(_quantity), value(3))),
+                   {0, NULL_VALUE, 4, 2, NULL_VALUE});
+  check_expression(arithmetic(ArithmeticOperator::Division, column(_price), value(0.0)),
+                   {NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE});
+
+  // The minimum value divided by -1 overflows. min / (quantity - 4)
+  constexpr auto min = std::numeric_limits<int32_t>::min();
+  check_expression(arithmetic(ArithmeticOperator::Division, value(min),
+                              arithmetic(ArithmeticOperator::Subtraction, column(_quantity), value(4))),
+                   {min / -3, NULL_VALUE, NULL_VALUE, min / 2, NULL_VALUE});
+}
+
+TEST_F(OperatorsProjectionTest, Comparisons) {
+  check_expression(compare(ScanType::OpGreaterThanEquals, column(_quantity), value(3)), {0, 1, 1, 1, 1});
+  check_expression(compare(ScanType::OpGreaterThan, column(_discount), value(0.3)), {1, 0, NULL_VALUE, 0, 1});
+  check_expression(compare(ScanType::OpEquals, column(_name), value("apple")), {1, NULL_VALUE, 0, 0, 1});
+  check_expression(compare(ScanType::OpNotEquals, value(2), column(_quantity)), {1, 1, 1, 1, 1});
+  check_expression(compare(ScanType::OpLessThan, column(_price), column(_quantity)), {0, 0, 0, 1, 0});
+  check_expression(compare(ScanType::OpLessThanEquals, column(_quantity), value(int64_t{3})), {1, 1, 0, 0, 1});
+
+  const auto table = get_table_op(false)->get_output();
+  const auto comparison = compare(ScanType::OpLessThanEquals, column(_name), value("b"));
+  EXPECT_EQ(comparison->description(*table), "name <= 'b'");
+  EXPECT_EQ(comparison->data_type(*table), "int");
+}
+
+TEST_F(OperatorsProjectionTest, Case) {
+  const auto branches = std::vector<CaseExpression::Branch>{
+      {compare(ScanType::OpLessThan, column(_quantity), value(3)), value("small")},
+      {compare(ScanType::OpLessThan, column(_quantity), value(5)), value("medium")}};
+  const auto size = std::make_shared<CaseExpression>(branches, value("large"));
+  check_expression(size, {"small", "medium", "medium", "large", "medium"});
+
+  const auto discounted = std::make_shared<CaseExpression>(std::vector<CaseExpression::Branch>{
+      {compare(ScanType::OpGreaterThan, column(_discount), value(0.3)), column(_price)}});
+  check_expression(discounted, {10.0, NULL_VALUE, NULL_VALUE, NULL_VALUE, 100.0});
+
+  // Branches of different numeric types are converted to the widest type.
+  const auto mixed = std::make_shared<CaseExpression>(
+      std::vector<CaseExpression::Branch>{{column(_quantity), column(_discount)}}, value(int64_t{7}));
+  check_expression(mixed, {0.5f, 0.25f, NULL_VALUE, 0.0f, 1.0f});
+
+  const auto table = get_table_op(false)->get_output();
+  EXPECT_EQ(discounted->description(*table), "CASE WHEN discount > 0.3 THEN price END");
+  EXPECT_EQ(discounted->data_type(*table), "double");
+  EXPECT_TRUE(discounted->is_nullable(*table));
+  EXPECT_FALSE(size->is_nullable(*table));
+  EXPECT_EQ(mixed->data_type(*table), "float");
+}
+
+TEST_F(OperatorsProjectionTest, ColumnsAndComputedValues) {
+  for (const auto compressed : {false, true}) {
+    const auto table_wrapper = get_table_op(compressed);
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{2}, ScanType::OpGreaterThan, 1);
+    scan->execute();
+    for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{table_wrapper, scan}) {
+      const auto doubled_quantity = arithmetic(ArithmeticOperator::Multiplication, column(_quantity), value(2));
+      auto projection = std::make_shared<Projection>(input, std::vector{column(_name), doubled_quantity});
+      projection->set_max_parallelism(2);
+      EXPECT_EQ(projection->max_parallelism(), 2);
+      projection->execute();
+
+      // The output consists of data segments only, so columns of reference tables are materialized.
+      const auto output = projection->get_output();
+      EXPECT_EQ(output->column_name(ColumnID{1}), "quantity * 2");
+      EXPECT_FALSE(output->column_nullable(ColumnID{1}));
+      for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+        const auto segment = output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+        EXPECT_FALSE(std::dynamic_pointer_cast<ReferenceSegment>(segment));
+      }
+
+      auto expected_rows =
+          std::vector<std::vector<AllTypeVariant>>{{NULL_VALUE, 6}, {"pear", 8}, {"fig", 12}, {"apple", 6}};
+      if (input == table_wrapper) {
+        expected_rows.insert(expected_rows.begin(), {"apple", 2});
+      }
+      EXPECT_TABLE_EQ(output, _create_table({{"name", "string"}, {"quantity * 2", "int"}}, expected_rows), true);
+    }
+  }
+}
+
+TEST_F(OperatorsProjectionTest, ValueSegmentsAreCopied) {
+  for (const auto compressed : {false, true}) {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int", false);
+    table->append({1});
+    table->append({2});
+    if (compressed) {
+      table->compress_chunk(ChunkID{0});
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    const auto incremented = arithmetic(ArithmeticOperator::Addition, column(ColumnID{0}), value(1));
+    auto projection = std::make_shared<Projection>(table_wrapper, std::vector{column(ColumnID{0}), incremented});
+    projection->execute();
+
+    // Rows appended to the input later are not part of the output.
+    table->append({3});
+    const auto output = projection->get_output();
+    EXPECT_TABLE_EQ(output, _create_table({{"a", "int"}, {"a + 1", "int"}}, {{1, 2}, {2, 3}}), true);
+    EXPECT_EQ(output->get_chunk(ChunkID{0})->size(), 2);
+
+    // Dictionary segments are passed on.
+    const auto input_segment = table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+    EXPECT_EQ(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}) == input_segment, compressed);
+  }
+}
+
+TEST_F(OperatorsProjectionTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(get_table_op(true), ColumnID{2}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+  auto projection = std::make_shared<Projection>(
+      scan, std::vector{arithmetic(ArithmeticOperator::Addition, column(_quantity), value(1))});
+  projection->execute();
+  EXPECT_EQ(projection->get_output()->row_count(), 0);
+  EXPECT_EQ(projection->get_output()->column_count(), 1);
+}
+
+TEST_F(OperatorsProjectionTest, InvalidExpressions) {
+  const auto table_wrapper = get_table_op(false);
+  const auto table = table_wrapper->get_output();
+  EXPECT_THROW(ValueExpression{NULL_VALUE}, std::logic_error);
+  EXPECT_THROW(ComparisonExpression(ScanType::OpLike, column(_name), value("a%")), std::logic_error);
+  const auto string_arithmetic = arithmetic(ArithmeticOperator::Addition, column(_name), value("a"));
+  EXPECT_THROW(string_arithmetic->data_type(*table), std::logic_error);
+  EXPECT_THROW(compare(ScanType::OpEquals, column(_name), value(1))->data_type(*table), std::logic_error);
+
+  const auto invalid_case =
+      std::make_shared<CaseExpression>(std::vector<CaseExpression::Branch>{{column(_price), value(1)}});
+  EXPECT_THROW(invalid_case->data_type(*table), std::logic_error);
+
+  auto projection = std::make_shared<Projection>(
+      table_wrapper, std::vector{arithmetic(ArithmeticOperator::Addition, column(_name), value(1))});
+  EXPECT_THROW(projection->execute(), std::logic_error);
+  EXPECT_THROW(projection->set_max_parallelism(0), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/reference_output.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsReferenceOutputTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Two chunks with the values 0 to 19.
+    const auto data_table = std::make_shared<Table>(10);
+    data_table->add_column("a", "int", false);
+    for (auto value = int32_t{0}; value < 20; ++value) {
+      data_table->append({value});
+    }
+
+    const auto other_data_table = std::make_shared<Table>();
+    other_data_table->add_column("b", "int", false);
+    for (auto value = int32_t{100}; value < 105; ++value) {
+      other_data_table->append({value});
+    }
+
+    // The columns reference different tables with different position lists, like the output of a join. a holds the
+    // odd values of the second chunk (11, 13, 15, 17, 19), b holds 104 to 100.
+    _reference_table = std::make_shared<Table>();
+    _reference_table->add_column_definition("a", "int", false);
+    _reference_table->add_column_definition("b", "int", false);
+    const auto chunk = std::make_shared<Chunk>();
+    chunk->add_segment(std::make_shared<ReferenceSegment>(
+        data_table, ColumnID{0}, std::make_shared<BitmapPosList>(ChunkID{1}, std::vector<uint64_t>{0b1010101010})));
+    chunk->add_segment(std::make_shared<ReferenceSegment>(
+        other_data_table, ColumnID{0},
+        std::make_shared<PosList>(std::initializer_list<RowID>{RowID{ChunkID{0}, 4}, RowID{ChunkID{0}, 3},
+                                                               RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 1},
+                                                               RowID{ChunkID{0}, 0}})));
+    _reference_table->append_chunk(chunk);
+  }
+
+  // Returns the values of the column of the chunk, using std::nullopt for NULLs (as NULLs never compare equal).
+  static std::vector<std::optional<int32_t>> _values(const Chunk& chunk, const ColumnID column_id) {
+    const auto& segment = *chunk.get_segment(column_id);
+    auto values = std::vector<std::optional<int32_t>>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      const auto value = segment[chunk_offset];
+      values.push_back(variant_is_null(value) ? std::nullopt : std::optional{std::get<int32_t>(value)});
+    }
+    return values;
+  }
+
+  std::shared_ptr<Table> _reference_table;
+};
+
+TEST_F(OperatorsReferenceOutputTest, ResolvesAscendingPositions) {
+  auto output_chunk = Chunk{};
+  add_reference_segments(output_chunk, _reference_table,
+                         std::make_shared<SingleChunkPosList>(ChunkID{0}, std::vector<ChunkOffset>{0, 2, 3}),
+                         pos_lists_by_column(*_reference_table));
+  ASSERT_EQ(output_chunk.column_count(), 2);
+  EXPECT_EQ(_values(output_chunk, ColumnID{0}), (std::vector<std::optional<int32_t>>{11, 15, 17}));
+  EXPECT_EQ(_values(output_chunk, ColumnID{1}), (std::vector<std::optional<int32_t>>{104, 102, 101}));
+
+  // The positions of a reference the same data chunk, so they are stored compactly.
+  const auto& a_segment = static_cast<const ReferenceSegment&>(*output_chunk.get_segment(ColumnID{0}));
+  EXPECT_EQ(a_segment.pos_list()->common_chunk_id(), ChunkID{1});
+  EXPECT_EQ(a_segment.referenced_column_id(), ColumnID{0});
+}
+
+TEST_F(OperatorsReferenceOutputTest, ResolvesUnorderedAndNullPositions) {
+  auto output_chunk = Chunk{};
+  add_reference_segments(output_chunk, _reference_table,
+                         std::make_shared<PosList>(std::initializer_list<RowID>{
+                             RowID{ChunkID{0}, 4}, NULL_ROW_ID, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}}),
+                         pos_lists_by_column(*_reference_table));
+  EXPECT_EQ(_values(output_chunk, ColumnID{0}), (std::vector<std::optional<int32_t>>{19, std::nullopt, 13, 15}));
+  EXPECT_EQ(_values(output_chunk, ColumnID{1}), (std::vector<std::optional<int32_t>>{100, std::nullopt, 103, 102}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,215 @@
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  // Creates a table with the nullable columns "a" (int), "b" (string), and "c" (double) and the column "id", which
+  // holds the row number.
+  std::shared_ptr<TableWrapper> get_table_op(const ChunkOffset chunk_size, const bool compressed) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("a", "int", true);
+    table->add_column("b", "string", true);
+    table->add_column("c", "double", true);
+    table->add_column("id", "int", false);
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+
+    if (compressed) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Returns a table with the rows of the table created by get_table_op in the order of the given ids.
+  std::shared_ptr<Table> get_expected_table(const std::vector<int32_t>& ids) {
+    auto expected_rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (const auto id : ids) {
+      expected_rows.push_back(rows[id]);
+    }
+    return _create_table({{"a", "int"}, {"b", "string"}, {"c", "double"}, {"id", "int"}}, expected_rows);
+  }
+
+  // Sorts the table for all combinations of chunk sizes, compression, and output modes and checks that the output
+  // holds the rows with the given ids in this order.
+  void check_sort(const std::vector<SortColumnDefinition>& sort_definitions, const std::vector<int32_t>& expected_ids) {
+    const auto expected_table = get_expected_table(expected_ids);
+    for (const auto chunk_size : {ChunkOffset{2}, ChunkOffset{3}, ChunkOffset{100}}) {
+      for (const auto compressed : {false, true}) {
+        for (const auto output_mode : {Sort::OutputMode::ReferenceSegments, Sort::OutputMode::ValueSegments}) {
+          const auto sort = std::make_shared<Sort>(get_table_op(chunk_size, compressed), sort_definitions,
+                                                   Sort::DEFAULT_OUTPUT_CHUNK_SIZE, output_mode);
+          sort->execute();
+          SCOPED_TRACE("chunk size: " + std::to_string(chunk_size) + ", compressed: " + std::to_string(compressed) +
+                       ", output mode: " + std::to_string(static_cast<int>(output_mode)));
+          EXPECT_TABLE_EQ(sort->get_output(), expected_table, true);
+        }
+      }
+    }
+  }
+
+  // The rows of the table created by get_table_op. The column "id" holds the row number.
+  const std::vector<std::vector<AllTypeVariant>> rows{{3, "pear", 1.5, 0},
+                                                      {-1, NULL_VALUE, -2.0, 1},
+                                                      {NULL_VALUE, "apple", 0.0, 2},
+                                                      {3, "apple", NULL_VALUE, 3},
+                                                      {0, "fig", -0.0, 4},
+                                                      {-1, "pear", 100.25, 5},
+                                                      {NULL_VALUE, NULL_VALUE, -2.5, 6}};
+};
+
+TEST_F(OperatorsSortTest, Getters) {
+  const auto sort = std::make_shared<Sort>(get_table_op(2, false),
+                                           std::vector{SortColumnDefinition{ColumnID{1}, SortMode::Descending}}, 10,
+                                           Sort::OutputMode::ValueSegments);
+  EXPECT_EQ(sort->sort_definitions().size(), 1);
+  EXPECT_EQ(sort->sort_definitions()[0].column_id, ColumnID{1});
+  EXPECT_EQ(sort->sort_definitions()[0].sort_mode, SortMode::Descending);
+  EXPECT_EQ(sort->sort_definitions()[0].nulls_position, NullsPosition::First);
+  EXPECT_EQ(sort->output_chunk_size(), 10);
+  EXPECT_EQ(sort->output_mode(), Sort::OutputMode::ValueSegments);
+
+  sort->set_max_parallelism(3);
+  EXPECT_EQ(sort->max_parallelism(), 3);
+  EXPECT_THROW(sort->set_max_parallelism(0), std::logic_error);
+  EXPECT_THROW(std::make_shared<Sort>(get_table_op(2, false), std::vector<SortColumnDefinition>{}, 0),
+               std::logic_error);
+}
+
+TEST_F(OperatorsSortTest, SingleIntColumn) {
+  // Rows with equal values keep their input order.
+  check_sort({{ColumnID{0}}}, {2, 6, 1, 5, 4, 0, 3});
+  check_sort({{ColumnID{0}, SortMode::Ascending, NullsPosition::Last}}, {1, 5, 4, 0, 3, 2, 6});
+  check_sort({{ColumnID{0}, SortMode::Descending}}, {2, 6, 0, 3, 4, 1, 5});
+  check_sort({{ColumnID{0}, SortMode::Descending, NullsPosition::Last}}, {0, 3, 4, 1, 5, 2, 6});
+}
+
+TEST_F(OperatorsSortTest, StringColumn) {
+  // The distinct strings of all chunks are ranked together, even if some chunks are dictionary-encoded.
+  check_sort({{ColumnID{1}}}, {1, 6, 2, 3, 4, 0, 5});
+  check_sort({{ColumnID{1}, SortMode::Descending, NullsPosition::Last}}, {0, 5, 4, 2, 3, 1, 6});
+}
+
+TEST_F(OperatorsSortTest, DoubleColumn) {
+  // -0.0 and 0.0 are equal.
+  check_sort({{ColumnID{2}, SortMode::Ascending, NullsPosition::Last}}, {6, 1, 2, 4, 0, 5, 3});
+  check_sort({{ColumnID{2}, SortMode::Descending}}, {3, 5, 0, 2, 4, 1, 6});
+}
+
+TEST_F(OperatorsSortTest, MultipleColumns) {
+  check_sort({{ColumnID{0}, SortMode::Ascending, NullsPosition::Last}, {ColumnID{1}, SortMode::Descending}},
+             {1, 5, 4, 0, 3, 6, 2});
+  check_sort({{ColumnID{1}}, {ColumnID{0}, SortMode::Descending, NullsPosition::Last}}, {1, 6, 3, 2, 4, 0, 5});
+}
+
+TEST_F(OperatorsSortTest, NoSortColumns) {
+  check_sort({}, {0, 1, 2, 3, 4, 5, 6});
+}
+
+TEST_F(OperatorsSortTest, OutputChunks) {
+  const auto table_op = get_table_op(2, true);
+  for (const auto output_mode : {Sort::OutputMode::ReferenceSegments, Sort::OutputMode::ValueSegments}) {
+    const auto sort = std::make_shared<Sort>(table_op, std::vector{SortColumnDefinition{ColumnID{3}}}, 3, output_mode);
+    sort->execute();
+    const auto output = sort->get_output();
+    EXPECT_EQ(output->target_chunk_size(), 3);
+    EXPECT_EQ(output->chunk_count(), 3);
+    EXPECT_EQ(output->get_chunk(ChunkID{2})->size(), 1);
+    EXPECT_TABLE_EQ(output, table_op->get_output(), true);
+
+    const auto segment = output->get_chunk(ChunkID{0})->get_segment(ColumnID{1});
+    if (output_mode == Sort::OutputMode::ReferenceSegments) {
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+      ASSERT_TRUE(reference_segment);
+      EXPECT_EQ(reference_segment->referenced_table(), table_op->get_output());
+    } else {
+      EXPECT_TRUE(std::dynamic_pointer_cast<const ValueSegment<std::string>>(segment));
+    }
+  }
+}
+
+TEST_F(OperatorsSortTest, SortReferenceSegments) {
+  const auto table_op = get_table_op(3, true);
+  const auto scan = std::make_shared<TableScan>(table_op, ColumnID{3}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+  const auto sort = std::make_shared<Sort>(scan, std::vector{SortColumnDefinition{ColumnID{1}, SortMode::Descending}});
+  sort->execute();
+
+  const auto output = sort->get_output();
+  EXPECT_TABLE_EQ(output, get_expected_table({6, 5, 4, 2, 3}), true);
+  // The output references the data table instead of the scan's output.
+  const auto reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(reference_segment);
+  EXPECT_EQ(reference_segment->referenced_table(), table_op->get_output());
+}
+
+TEST_F(OperatorsSortTest, EmptyInput) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "long", false);
+  const auto table_op = std::make_shared<TableWrapper>(table);
+  table_op->execute();
+
+  for (const auto output_mode : {Sort::OutputMode::ReferenceSegments, Sort::OutputMode::ValueSegments}) {
+    const auto sort = std::make_shared<Sort>(table_op, std::vector{SortColumnDefinition{ColumnID{0}}}, 2, output_mode);
+    sort->execute();
+    EXPECT_EQ(sort->get_output()->row_count(), 0);
+    EXPECT_EQ(sort->get_output()->chunk_count(), 1);
+    EXPECT_EQ(sort->get_output()->column_type(ColumnID{0}), "long");
+  }
+}
+
+TEST_F(OperatorsSortTest, MatchesStableSort) {
+  // Many chunks of random values are sorted and merged in several rounds.
+  auto generator = std::mt19937{17};
+  auto distribution = std::uniform_int_distribution<int64_t>{-50, 50};
+  auto values = std::vector<std::pair<int64_t, float>>(1'000);
+  auto table = std::make_shared<Table>(37);
+  table->add_column("a", "long", false);
+  table->add_column("b", "float", false);
+  table->add_column("id", "int", false);
+  for (auto row_index = size_t{0}; row_index < values.size(); ++row_index) {
+    values[row_index] = {distribution(generator) * 1'000'000'000, static_cast<float>(distribution(generator)) / 4};
+    table->append({values[row_index].first, values[row_index].second, static_cast<int32_t>(row_index)});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 2) {
+    table->compress_chunk(chunk_id);
+  }
+  const auto table_op = std::make_shared<TableWrapper>(table);
+  table_op->execute();
+
+  auto expected_ids = std::vector<size_t>(values.size());
+  std::iota(expected_ids.begin(), expected_ids.end(), 0);
+  std::stable_sort(expected_ids.begin(), expected_ids.end(), [&](const size_t lhs, const size_t rhs) {
+    return values[lhs].second > values[rhs].second ||
+           (values[lhs].second == values[rhs].second && values[lhs].first < values[rhs].first);
+  });
+
+  const auto sort = std::make_shared<Sort>(
+      table_op, std::vector{SortColumnDefinition{ColumnID{1}, SortMode::Descending}, SortColumnDefinition{ColumnID{0}}},
+      100);
+  sort->execute();
+  auto expected_rows = std::vector<std::vector<AllTypeVariant>>{};
+  for (const auto id : expected_ids) {
+    expected_rows.push_back({values[id].first, values[id].second, static_cast<int32_t>(id)});
+  }
+  EXPECT_TABLE_EQ(sort->get_output(), _create_table({{"a", "long"}, {"b", "float"}, {"id", "int"}}, expected_rows),
+                  true);
+}
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "base_test.hpp"
 
+#include "operators/join_hash.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
@@ -47,6 +48,28 @@ class OperatorsTableScanTest : public BaseTest {
     return table_wrapper;
   }
 
+  std::shared_ptr<TableWrapper> get_table_op_with_strings(const bool compressed) {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "string", true);
+    table->add_column("b", "int", false);
+
+    const auto values = std::vector<AllTypeVariant>{"Hasso", "Hans",  "hasso", "Plattner", NULL_VALUE, "Hamburg",
+                                                    "Ha",    "Bremen", "Haus", "Hasso"};
+    for (auto index = size_t{0}; index < values.size(); ++index) {
+      table->append({values[index], static_cast<int32_t>(index)});
+    }
+
+    if (compressed) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
   std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int32_t num_entries) {
     // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
     auto table = std::make_shared<opossum::Table>(0);
@@ -287,6 +310,259 @@ TEST_F(OperatorsTableScanTest, ScanOnReferenceSegmentWithNullValue) {
   }
 }
 
+TEST_F(OperatorsTableScanTest, ScanLike) {
+  auto tests = std::map<std::pair<ScanType, std::string>, std::vector<AllTypeVariant>>{};
+  tests[{ScanType::OpLike, "Ha%"}] = {0, 1, 5, 6, 8, 9};
+  tests[{ScanType::OpLike, "Has%"}] = {0, 9};
+  tests[{ScanType::OpLike, "Z%"}] = {};
+  tests[{ScanType::OpLike, "%"}] = {0, 1, 2, 3, 5, 6, 7, 8, 9};
+  tests[{ScanType::OpLike, "%ss%"}] = {0, 2, 9};
+  tests[{ScanType::OpLike, "%n"}] = {7};
+  tests[{ScanType::OpLike, "H_s%"}] = {0, 9};
+  tests[{ScanType::OpLike, "Hans"}] = {1};
+  tests[{ScanType::OpNotLike, "Ha%"}] = {2, 3, 7};
+  tests[{ScanType::OpNotLike, "%ss%"}] = {1, 3, 5, 6, 7, 8};
+
+  for (const auto compressed : {false, true}) {
+    const auto table_wrapper = get_table_op_with_strings(compressed);
+    for (const auto& [scan, expected] : tests) {
+      auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan.first, scan.second);
+      table_scan->execute();
+      ASSERT_COLUMN_EQ(table_scan->get_output(), ColumnID{1}, expected);
+
+      // Scanning the reference segments of a previous scan has to yield the same result.
+      auto pre_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpGreaterThanEquals, 0);
+      pre_scan->execute();
+      auto reference_scan = std::make_shared<TableScan>(pre_scan, ColumnID{0}, scan.first, scan.second);
+      reference_scan->execute();
+      ASSERT_COLUMN_EQ(reference_scan->get_output(), ColumnID{1}, expected);
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanLikeOnInterleavedDictionaryReferences) {
+  // The pattern is evaluated once per dictionary entry of a referenced chunk, also if the position list returns to the
+  // chunk later.
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "string", true);
+  for (const auto& value : std::vector<AllTypeVariant>{"Hasso", "Hans", "hasso", "Plattner", NULL_VALUE, "Hamburg"}) {
+    table->append({value});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->compress_chunk(chunk_id);
+  }
+
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{
+      RowID{ChunkID{1}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{2}, ChunkOffset{0}},
+      RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{1}}, RowID{ChunkID{2}, ChunkOffset{1}},
+      RowID{ChunkID{1}, ChunkOffset{0}}});
+  const auto reference_segments =
+      std::vector<std::shared_ptr<ReferenceSegment>>{std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list)};
+  auto table_wrapper = std::make_shared<TableWrapper>(std::make_shared<Table>(*table, reference_segments));
+  table_wrapper->execute();
+
+  auto like_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLike, "%ss%");
+  like_scan->execute();
+  ASSERT_COLUMN_EQ(like_scan->get_output(), ColumnID{0}, {"hasso", "Hasso", "hasso"});
+
+  auto not_like_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotLike, "%ss%");
+  not_like_scan->execute();
+  ASSERT_COLUMN_EQ(not_like_scan->get_output(), ColumnID{0}, {"Hans", "Plattner", "Hamburg"});
+}
+
+TEST_F(OperatorsTableScanTest, ScanLikeOnNonStringColumnFails) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLike, "1%");
+  EXPECT_THROW(scan->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsTableScanTest, ScanIsNull) {
+  for (const auto compressed : {false, true}) {
+    const auto table_wrapper = get_table_op_with_strings(compressed);
+
+    auto is_null_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpIsNull, NULL_VALUE);
+    is_null_scan->execute();
+    ASSERT_COLUMN_EQ(is_null_scan->get_output(), ColumnID{1}, {4});
+
+    auto is_not_null_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpIsNotNull, NULL_VALUE);
+    is_not_null_scan->execute();
+    ASSERT_COLUMN_EQ(is_not_null_scan->get_output(), ColumnID{1}, {0, 1, 2, 3, 5, 6, 7, 8, 9});
+
+    // Segments that are not nullable.
+    auto no_nulls_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpIsNull, NULL_VALUE);
+    no_nulls_scan->execute();
+    EXPECT_EQ(no_nulls_scan->get_output()->row_count(), 0);
+
+    auto all_rows_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpIsNotNull, NULL_VALUE);
+    all_rows_scan->execute();
+    EXPECT_EQ(all_rows_scan->get_output()->row_count(), 10);
+
+    // Scans on reference segments.
+    auto pre_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpGreaterThan, 2);
+    pre_scan->execute();
+    auto reference_is_null_scan = std::make_shared<TableScan>(pre_scan, ColumnID{0}, ScanType::OpIsNull, NULL_VALUE);
+    reference_is_null_scan->execute();
+    ASSERT_COLUMN_EQ(reference_is_null_scan->get_output(), ColumnID{1}, {4});
+
+    auto reference_is_not_null_scan =
+        std::make_shared<TableScan>(pre_scan, ColumnID{0}, ScanType::OpIsNotNull, NULL_VALUE);
+    reference_is_not_null_scan->execute();
+    ASSERT_COLUMN_EQ(reference_is_not_null_scan->get_output(), ColumnID{1}, {3, 5, 6, 7, 8, 9});
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanIsNullOnNullRowIDs) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  const auto pos_list = std::make_shared<PosList>(
+      std::initializer_list<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}, NULL_ROW_ID, RowID{ChunkID{1}, ChunkOffset{0}}});
+  const auto reference_segments =
+      std::vector<std::shared_ptr<ReferenceSegment>>{std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list)};
+  auto reference_table = std::make_shared<Table>(*table, reference_segments);
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto is_null_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpIsNull, NULL_VALUE);
+  is_null_scan->execute();
+  EXPECT_EQ(is_null_scan->get_output()->row_count(), 1);
+
+  auto is_not_null_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpIsNotNull, NULL_VALUE);
+  is_not_null_scan->execute();
+  EXPECT_EQ(is_not_null_scan->get_output()->row_count(), 2);
+}
+
+TEST_F(OperatorsTableScanTest, ScanReferenceSegmentWithInterleavedChunks) {
+  // Chunk 0 is dictionary-encoded, chunk 1 is not. The position list switches between the chunks several times.
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int", true);
+  for (const auto& value : std::vector<AllTypeVariant>{1, 2, NULL_VALUE, 4, 5, NULL_VALUE}) {
+    table->append({value});
+  }
+  table->compress_chunk(ChunkID{0});
+
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{
+      RowID{ChunkID{1}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{2}},
+      NULL_ROW_ID, RowID{ChunkID{1}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{2}},
+      RowID{ChunkID{0}, ChunkOffset{1}}});
+  const auto reference_segments =
+      std::vector<std::shared_ptr<ReferenceSegment>>{std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list)};
+  auto table_wrapper = std::make_shared<TableWrapper>(std::make_shared<Table>(*table, reference_segments));
+  table_wrapper->execute();
+
+  auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
+  tests[ScanType::OpEquals] = {4};
+  tests[ScanType::OpNotEquals] = {5, 1, 2};
+  tests[ScanType::OpLessThan] = {1, 2};
+  tests[ScanType::OpGreaterThanEquals] = {5, 4};
+  tests[ScanType::OpIsNull] = {NULL_VALUE, NULL_VALUE, NULL_VALUE};
+  tests[ScanType::OpIsNotNull] = {5, 1, 4, 2};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 4);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanJoinOutput) {
+  // The columns of a join's output reference two tables with different position lists.
+  auto left_table = std::make_shared<Table>(2);
+  left_table->add_column("a", "int", false);
+  left_table->add_column("b", "string", false);
+  for (const auto& [a, b] : std::vector<std::pair<int32_t, std::string>>{{1, "x"}, {2, "y"}, {3, "z"}, {4, "w"}}) {
+    left_table->append({a, b});
+  }
+  left_table->compress_chunk(ChunkID{0});
+
+  auto right_table = std::make_shared<Table>(3);
+  right_table->add_column("c", "int", false);
+  right_table->add_column("d", "int", false);
+  for (const auto& [c, d] : std::vector<std::pair<int32_t, int32_t>>{{4, 40}, {3, 30}, {2, 20}, {1, 10}, {3, 31}}) {
+    right_table->append({c, d});
+  }
+  right_table->compress_chunk(ChunkID{1});
+
+  const auto left = std::make_shared<TableWrapper>(left_table);
+  const auto right = std::make_shared<TableWrapper>(right_table);
+  left->execute();
+  right->execute();
+  const auto join = std::make_shared<JoinHash>(left, right, JoinMode::Inner, ColumnID{0}, ColumnID{0});
+  join->execute();
+
+  const auto right_scan = std::make_shared<TableScan>(join, ColumnID{3}, ScanType::OpGreaterThanEquals, 30);
+  right_scan->execute();
+  EXPECT_TABLE_EQ(right_scan->get_output(), _create_table({{"a", "int"}, {"b", "string"}, {"c", "int"}, {"d", "int"}},
+                                                          {{3, "z", 3, 30}, {3, "z", 3, 31}, {4, "w", 4, 40}}));
+
+  const auto left_scan = std::make_shared<TableScan>(right_scan, ColumnID{1}, ScanType::OpNotEquals, "w");
+  left_scan->execute();
+  EXPECT_TABLE_EQ(left_scan->get_output(), _create_table({{"a", "int"}, {"b", "string"}, {"c", "int"}, {"d", "int"}},
+                                                         {{3, "z", 3, 30}, {3, "z", 3, 31}}));
+}
+
+TEST_F(OperatorsTableScanTest, ParallelScanKeepsChunkOrder) {
+  // Many chunks with more rows than a single morsel in total.
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", "int", false);
+  const auto row_count = int32_t{TableScan::MORSEL_ROW_COUNT * 3};
+  for (auto value = int32_t{0}; value < row_count; ++value) {
+    table->append({value});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 2) {
+    table->compress_chunk(chunk_id);
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto max_parallelism : {size_t{1}, size_t{4}}) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 0);
+    scan->set_max_parallelism(max_parallelism);
+    EXPECT_EQ(scan->max_parallelism(), max_parallelism);
+    scan->execute();
+
+    const auto output = scan->get_output();
+    EXPECT_EQ(output->row_count(), row_count - 1);
+    auto expected_value = int32_t{1};
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto chunk = output->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        ASSERT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{expected_value});
+        ++expected_value;
+      }
+    }
+  }
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 0);
+  EXPECT_THROW(scan->set_max_parallelism(0), std::logic_error);
+}
+
+TEST_F(OperatorsTableScanTest, RowBudgetSkipsRemainingChunks) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int", false);
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    table->append({value});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 95);
+  EXPECT_FALSE(scan->row_budget());
+  scan->set_row_budget(12);
+  EXPECT_EQ(scan->row_budget(), uint64_t{12});
+  scan->set_max_parallelism(1);
+  scan->execute();
+
+  // The chunks are scanned until they produced enough rows, the first rows are those of an unbounded scan.
+  const auto output = scan->get_output();
+  EXPECT_EQ(output->row_count(), 15);
+  auto expected_value = int32_t{95};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      ASSERT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{expected_value});
+      ++expected_value;
+    }
+  }
+}
+
 TEST_F(OperatorsTableScanTest, ScanWithNullAsSearchValue) {
   auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
   tests[ScanType::OpEquals] = {};
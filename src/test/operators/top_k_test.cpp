@@ -0,0 +1,138 @@
+#include <random>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  // Creates a table with the nullable columns "a" (int), "b" (string), and "c" (double) and the column "id", which
+  // holds the row number. The values of "a" repeat, so that ties are broken by the row order.
+  std::shared_ptr<TableWrapper> get_table_op(const ChunkOffset chunk_size, const bool compressed) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("a", "int", true);
+    table->add_column("b", "string", true);
+    table->add_column("c", "double", true);
+    table->add_column("id", "int", false);
+
+    auto generator = std::mt19937{17};
+    auto distribution = std::uniform_int_distribution<int32_t>{-20, 20};
+    for (auto id = int32_t{0}; id < 200; ++id) {
+      const auto value = distribution(generator);
+      const auto a = value % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value};
+      const auto b = value % 5 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{"s" + std::to_string(value * value)};
+      const auto c = value % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value * 0.5 + id * 0.001};
+      table->append({a, b, c, id});
+    }
+
+    if (compressed) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Checks that TopK returns the first k rows of the sorted input.
+  void check_top_k(const std::shared_ptr<AbstractOperator>& input, const SortColumnDefinition& sort_definition,
+                   const uint64_t k, const size_t max_parallelism) {
+    auto sort = std::make_shared<Sort>(input, std::vector<SortColumnDefinition>{sort_definition});
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, k);
+    limit->execute();
+
+    auto top_k = std::make_shared<TopK>(input, sort_definition, k);
+    top_k->set_max_parallelism(max_parallelism);
+    top_k->execute();
+    SCOPED_TRACE("column: " + std::to_string(sort_definition.column_id) +
+                 ", mode: " + std::to_string(static_cast<int>(sort_definition.sort_mode)) +
+                 ", nulls: " + std::to_string(static_cast<int>(sort_definition.nulls_position)) +
+                 ", k: " + std::to_string(k));
+    EXPECT_TABLE_EQ(top_k->get_output(), limit->get_output(), true);
+  }
+};
+
+TEST_F(OperatorsTopKTest, EqualsSortAndLimit) {
+  for (const auto chunk_size : {ChunkOffset{7}, ChunkOffset{1'000}}) {
+    for (const auto compressed : {false, true}) {
+      const auto table_wrapper = get_table_op(chunk_size, compressed);
+      for (const auto column_id : {ColumnID{0}, ColumnID{1}, ColumnID{2}}) {
+        for (const auto sort_mode : {SortMode::Ascending, SortMode::Descending}) {
+          for (const auto nulls_position : {NullsPosition::First, NullsPosition::Last}) {
+            for (const auto k : {uint64_t{1}, uint64_t{10}, uint64_t{50}, uint64_t{500}}) {
+              for (const auto max_parallelism : {size_t{1}, size_t{4}}) {
+                check_top_k(table_wrapper, SortColumnDefinition{column_id, sort_mode, nulls_position}, k,
+                            max_parallelism);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, ReferenceInput) {
+  const auto scan = std::make_shared<TableScan>(get_table_op(7, true), ColumnID{0}, ScanType::OpGreaterThan, -10);
+  scan->execute();
+  check_top_k(scan, SortColumnDefinition{ColumnID{0}, SortMode::Descending, NullsPosition::First}, 20, 4);
+  check_top_k(scan, SortColumnDefinition{ColumnID{1}}, 20, 4);
+}
+
+TEST_F(OperatorsTopKTest, OutputColumns) {
+  auto top_k = std::make_shared<TopK>(get_table_op(7, false), SortColumnDefinition{ColumnID{2}}, 3);
+  EXPECT_EQ(top_k->k(), 3);
+  EXPECT_EQ(top_k->sort_definition().column_id, ColumnID{2});
+  top_k->execute();
+
+  const auto output = top_k->get_output();
+  EXPECT_EQ(output->row_count(), 3);
+  EXPECT_EQ(output->chunk_count(), 1);
+  EXPECT_EQ(output->column_count(), 4);
+  EXPECT_EQ(output->column_name(ColumnID{1}), "b");
+  EXPECT_EQ(output->column_type(ColumnID{2}), "double");
+  EXPECT_TRUE(output->column_nullable(ColumnID{2}));
+}
+
+TEST_F(OperatorsTopKTest, OutputChunksAreLimitedToTargetChunkSize) {
+  auto top_k = std::make_shared<TopK>(get_table_op(7, false), SortColumnDefinition{ColumnID{3}}, 50);
+  top_k->execute();
+
+  const auto output = top_k->get_output();
+  EXPECT_EQ(output->row_count(), 50);
+  EXPECT_EQ(output->chunk_count(), 8);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_LE(output->get_chunk(chunk_id)->size(), 7);
+  }
+}
+
+TEST_F(OperatorsTopKTest, EmptyResult) {
+  auto top_k = std::make_shared<TopK>(get_table_op(7, true), SortColumnDefinition{ColumnID{0}}, 0);
+  top_k->execute();
+  EXPECT_EQ(top_k->get_output()->row_count(), 0);
+  EXPECT_EQ(top_k->get_output()->column_count(), 4);
+
+  const auto scan = std::make_shared<TableScan>(get_table_op(7, true), ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+  auto top_k_on_empty_input = std::make_shared<TopK>(scan, SortColumnDefinition{ColumnID{0}}, 5);
+  top_k_on_empty_input->execute();
+  EXPECT_EQ(top_k_on_empty_input->get_output()->row_count(), 0);
+}
+
+TEST_F(OperatorsTopKTest, InvalidParameters) {
+  auto top_k = std::make_shared<TopK>(get_table_op(7, true), SortColumnDefinition{ColumnID{4}}, 5);
+  EXPECT_THROW(top_k->set_max_parallelism(0), std::logic_error);
+  EXPECT_THROW(top_k->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/async_task.hpp"
+#include "scheduler/cancellation_token.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Awaits the outputs of both operators and returns their total row count.
+AsyncTask<uint64_t> count_rows(const std::shared_ptr<AbstractOperator> left,
+                               const std::shared_ptr<AbstractOperator> right) {
+  const auto left_output = co_await left->execute_async();
+  const auto right_output = co_await right->execute_async();
+  co_return left_output->row_count() + right_output->row_count();
+}
+
+// Yields iteration_count times and cancels the token before the given iteration. Returns the number of iterations.
+AsyncTask<int32_t> yield_repeatedly(const CancellationToken token, const int32_t iteration_count,
+                                    const int32_t cancelled_iteration, std::shared_ptr<int32_t> completed_iterations) {
+  for (auto iteration = int32_t{0}; iteration < iteration_count; ++iteration) {
+    if (iteration == cancelled_iteration) {
+      token.cancel();
+    }
+    co_await yield_to_scheduler(token);
+    ++*completed_iterations;
+  }
+  co_return *completed_iterations;
+}
+
+}  // namespace
+
+namespace opossum {
+
+class AsyncTaskTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Many small chunks, so that scans yield often.
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int", false);
+    table->add_column("b", "string", false);
+    for (auto value = int32_t{0}; value < 1'000; ++value) {
+      table->append({value, "v" + std::to_string(value % 3)});
+    }
+    table->compress_chunk(ChunkID{0});
+    _table = table;
+  }
+
+  std::shared_ptr<TableScan> make_plan(const int32_t upper_bound) const {
+    const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+    const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, upper_bound);
+    return std::make_shared<TableScan>(scan, ColumnID{1}, ScanType::OpEquals, "v1");
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(AsyncTaskTest, ExecutesPlans) {
+  const auto plan = make_plan(500);
+  const auto output = plan->execute_async().get();
+  EXPECT_TRUE(plan->was_executed());
+  EXPECT_EQ(output, plan->get_output());
+
+  EXPECT_TRUE(plan->left_input()->was_executed());
+
+  // Every third value of [0, 500) is "v1", starting at 1.
+  EXPECT_EQ(output->row_count(), 167);
+  EXPECT_EQ(type_cast<int32_t>((*output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[0]), 1);
+}
+
+TEST_F(AsyncTaskTest, InterleavesConcurrentQueries) {
+  auto plans = std::vector<std::shared_ptr<TableScan>>{};
+  auto outputs = std::vector<AsyncTask<std::shared_ptr<const Table>>>{};
+  for (auto query_id = int32_t{0}; query_id < 16; ++query_id) {
+    plans.push_back(make_plan(query_id * 60));
+    outputs.push_back(plans.back()->execute_async());
+  }
+
+  for (auto query_id = int32_t{0}; query_id < 16; ++query_id) {
+    // Every third value of [0, query_id * 60) is "v1".
+    EXPECT_EQ(outputs[query_id].get()->row_count(), query_id * 20);
+  }
+}
+
+TEST_F(AsyncTaskTest, CoroutinesAwaitOperators) {
+  const auto row_count = count_rows(make_plan(300), make_plan(600));
+  EXPECT_EQ(row_count.get(), 300);
+  EXPECT_TRUE(row_count.is_done());
+}
+
+TEST_F(AsyncTaskTest, Cancellation) {
+  const auto token = CancellationToken{};
+  token.cancel();
+  const auto plan = make_plan(500);
+  const auto output = plan->execute_async(token);
+  EXPECT_THROW(output.get(), OperationCancelled);
+  EXPECT_FALSE(plan->was_executed());
+  EXPECT_FALSE(plan->left_input()->was_executed());
+
+  // Cancelling is noticed the next time the coroutine yields.
+  const auto completed_iterations = std::make_shared<int32_t>(0);
+  EXPECT_THROW(yield_repeatedly(CancellationToken{}, 10, 3, completed_iterations).get(), OperationCancelled);
+  EXPECT_EQ(*completed_iterations, 3);
+  EXPECT_EQ(yield_repeatedly(CancellationToken{}, 10, 10, std::make_shared<int32_t>(0)).get(), 10);
+}
+
+TEST_F(AsyncTaskTest, RethrowsExceptions) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLike, "%1");
+  EXPECT_THROW(scan->execute_async().get(), std::logic_error);
+}
+
+}  // namespace opossum
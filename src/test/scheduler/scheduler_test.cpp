@@ -0,0 +1,163 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/scheduler.hpp"
+
+namespace opossum {
+
+class SchedulerTest : public BaseTest {
+ protected:
+  static std::shared_ptr<TableWrapper> make_table_wrapper(const int32_t row_count) {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int", false);
+    table->add_column("b", "int", false);
+    for (auto value = int32_t{0}; value < row_count; ++value) {
+      table->append({value, value % 5});
+    }
+    return std::make_shared<TableWrapper>(table);
+  }
+};
+
+TEST_F(SchedulerTest, RespectsDependencies) {
+  auto scheduler = Scheduler{4};
+  auto order = std::vector<int32_t>{};
+  auto order_mutex = std::mutex{};
+  const auto make_task = [&](const int32_t id) {
+    return std::make_shared<JobTask>([&, id]() {
+      const auto lock = std::lock_guard<std::mutex>{order_mutex};
+      order.push_back(id);
+    });
+  };
+
+  // 0 -> {1, 2} -> 3
+  const auto tasks = std::vector<std::shared_ptr<AbstractTask>>{make_task(0), make_task(1), make_task(2), make_task(3)};
+  tasks[0]->set_as_predecessor_of(tasks[1]);
+  tasks[0]->set_as_predecessor_of(tasks[2]);
+  tasks[1]->set_as_predecessor_of(tasks[3]);
+  tasks[2]->set_as_predecessor_of(tasks[3]);
+
+  // The successors are scheduled first and wait for their predecessors anyway.
+  scheduler.schedule_tasks({tasks[3], tasks[2], tasks[1]});
+  scheduler.schedule_and_wait_for_tasks({tasks[0]});
+  scheduler.wait_for_tasks(tasks);
+
+  ASSERT_EQ(order.size(), 4);
+  EXPECT_EQ(order.front(), 0);
+  EXPECT_EQ(order.back(), 3);
+  EXPECT_THROW(scheduler.schedule_tasks({tasks[0]}), std::logic_error);
+  EXPECT_THROW(tasks[3]->set_as_predecessor_of(tasks[0]), std::logic_error);
+}
+
+TEST_F(SchedulerTest, ExecutesOperatorTasks) {
+  const auto left_scan = std::make_shared<TableScan>(make_table_wrapper(100), ColumnID{0}, ScanType::OpLessThan, 50);
+  const auto right_input = make_table_wrapper(20);
+  const auto join = std::make_shared<JoinHash>(left_scan, right_input, JoinMode::Inner, ColumnID{1}, ColumnID{0});
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(join);
+  ASSERT_EQ(tasks.size(), 4);
+  EXPECT_EQ(static_cast<const OperatorTask&>(*tasks.back()).get_operator(), join);
+  Scheduler::get().schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(join->get_output()->row_count(), 50);
+
+  // Executed inputs get no tasks and inputs that are used twice get one.
+  const auto self_join = std::make_shared<JoinHash>(left_scan, left_scan, JoinMode::Inner, ColumnID{0}, ColumnID{0});
+  const auto scan = std::make_shared<TableScan>(self_join, ColumnID{1}, ScanType::OpEquals, 2);
+  EXPECT_EQ(OperatorTask::make_tasks_from_operator(scan).size(), 2);
+
+  const auto input = make_table_wrapper(10);
+  const auto input_self_join = std::make_shared<JoinHash>(input, input, JoinMode::Inner, ColumnID{0}, ColumnID{0});
+  const auto self_join_tasks = OperatorTask::make_tasks_from_operator(input_self_join);
+  ASSERT_EQ(self_join_tasks.size(), 2);
+  Scheduler::get().schedule_and_wait_for_tasks(self_join_tasks);
+  EXPECT_EQ(input_self_join->get_output()->row_count(), 10);
+}
+
+TEST_F(SchedulerTest, PropagatesExceptions) {
+  auto scheduler = Scheduler{2};
+  auto successor_was_executed = false;
+  const auto failing_task = std::make_shared<JobTask>([]() { throw std::logic_error("Task failed."); });
+  const auto successor = std::make_shared<JobTask>([&]() { successor_was_executed = true; });
+  failing_task->set_as_predecessor_of(successor);
+
+  EXPECT_THROW(scheduler.schedule_and_wait_for_tasks({failing_task, successor}), std::logic_error);
+  EXPECT_TRUE(successor->is_done());
+  EXPECT_FALSE(successor_was_executed);
+  EXPECT_TRUE(successor->exception());
+}
+
+TEST_F(SchedulerTest, TasksWaitForSubtasks) {
+  // With a single worker, the waiting task has to execute its subtasks itself.
+  auto scheduler = Scheduler{1};
+  auto sum = std::atomic<int32_t>{0};
+  const auto task = std::make_shared<JobTask>([&]() {
+    auto subtasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto value = int32_t{1}; value <= 4; ++value) {
+      subtasks.push_back(std::make_shared<JobTask>([&, value]() { sum += value; }));
+    }
+    scheduler.schedule_and_wait_for_tasks(subtasks);
+  });
+
+  scheduler.schedule_and_wait_for_tasks({task});
+  EXPECT_EQ(sum, 10);
+}
+
+TEST_F(SchedulerTest, IdleWorkersStealTasks) {
+  // The subtasks are both queued at the first worker and can only finish if they run at the same time, i.e., if the
+  // second worker steals one of them. Waiting is bounded so that the test fails instead of hanging.
+  auto scheduler = Scheduler{2};
+  auto running_count = std::atomic<int32_t>{0};
+  auto did_run_concurrently = std::atomic<bool>{true};
+  const auto subtask_function = [&]() {
+    ++running_count;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (running_count < 2) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        did_run_concurrently = false;
+        return;
+      }
+      std::this_thread::yield();
+    }
+  };
+
+  const auto task = std::make_shared<JobTask>([&]() {
+    scheduler.schedule_and_wait_for_tasks(
+        {std::make_shared<JobTask>(subtask_function), std::make_shared<JobTask>(subtask_function)});
+  });
+  scheduler.schedule_and_wait_for_tasks({task});
+  EXPECT_TRUE(did_run_concurrently);
+}
+
+TEST_F(SchedulerTest, WakesSleepingWorkers) {
+  // The workers fall asleep between the rounds, so each round's tasks have to wake them up. Tasks that wait for
+  // subtasks executed by other workers wait for them instead of spinning.
+  auto scheduler = Scheduler{4};
+  auto executed_count = std::atomic<int32_t>{0};
+  for (auto round = int32_t{0}; round < 20; ++round) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto task_index = int32_t{0}; task_index < 4; ++task_index) {
+      tasks.push_back(std::make_shared<JobTask>([&]() {
+        scheduler.schedule_and_wait_for_tasks({std::make_shared<JobTask>([&]() {
+          std::this_thread::sleep_for(std::chrono::microseconds{200});
+          ++executed_count;
+        })});
+      }));
+    }
+    scheduler.schedule_and_wait_for_tasks(tasks);
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  EXPECT_EQ(executed_count, 80);
+}
+
+}  // namespace opossum
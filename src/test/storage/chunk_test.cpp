@@ -3,6 +3,7 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
 
 namespace opossum {
 
@@ -54,4 +55,20 @@ TEST_F(StorageChunkTest, RetrieveSegment) {
   EXPECT_EQ(segment->size(), 4);
 }
 
+TEST_F(StorageChunkTest, Immutability) {
+  chunk.add_segment(int_value_segment);
+  EXPECT_FALSE(chunk.is_immutable());
+  chunk.append({2});
+  chunk.set_immutable();
+  EXPECT_TRUE(chunk.is_immutable());
+  EXPECT_THROW(chunk.append({3}), std::logic_error);
+
+  // Encoded segments cannot be appended to.
+  auto dictionary_chunk = Chunk{};
+  dictionary_chunk.add_segment(std::make_shared<DictionarySegment<int32_t>>(int_value_segment));
+  EXPECT_TRUE(dictionary_chunk.is_immutable());
+  EXPECT_THROW(dictionary_chunk.append({3}), std::logic_error);
+  EXPECT_EQ(dictionary_chunk.size(), 4);
+}
+
 }  // namespace opossum
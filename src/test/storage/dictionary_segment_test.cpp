@@ -80,6 +80,45 @@ TEST_F(StorageDictionarySegmentTest, NullValues) {
   EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant{"Alexander"}), INVALID_VALUE_ID);
 }
 
+TEST_F(StorageDictionarySegmentTest, NullValuesAndDefaultValues) {
+  // NULLs are stored as T{} in the value segment, which must not be confused with actual occurrences of T{}.
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  value_segment->append(3);
+  value_segment->append(NULL_VALUE);
+  value_segment->append(0);
+  value_segment->append(-1);
+
+  const auto dict_segment = std::make_shared<DictionarySegment<int32_t>>(value_segment);
+  EXPECT_EQ(dict_segment->dictionary(), (std::vector<int32_t>{-1, 0, 3}));
+  EXPECT_EQ(dict_segment->get_typed_value(0), 3);
+  EXPECT_EQ(dict_segment->get_typed_value(1), std::nullopt);
+  EXPECT_EQ(dict_segment->get_typed_value(2), 0);
+  EXPECT_EQ(dict_segment->get_typed_value(3), -1);
+}
+
+TEST_F(StorageDictionarySegmentTest, AggregateKernels) {
+  value_segment_str->append("Steve");
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append("Bill");
+  value_segment_str->append("Steve");
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append("Alexander");
+
+  const auto dict_segment = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
+  EXPECT_EQ(dict_segment->min(), "Alexander");
+  EXPECT_EQ(dict_segment->max(), "Steve");
+  EXPECT_EQ(dict_segment->null_count(), 2);
+  EXPECT_EQ(dict_segment->value_id_counts(), (std::vector<ChunkOffset>{1, 1, 2, 2}));
+
+  auto null_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  null_segment->append(NULL_VALUE);
+  const auto null_dict_segment = std::make_shared<DictionarySegment<int32_t>>(null_segment);
+  EXPECT_EQ(null_dict_segment->min(), std::nullopt);
+  EXPECT_EQ(null_dict_segment->max(), std::nullopt);
+  EXPECT_EQ(null_dict_segment->null_count(), 1);
+  EXPECT_EQ(null_dict_segment->value_id_counts(), (std::vector<ChunkOffset>{1}));
+}
+
 TEST_F(StorageDictionarySegmentTest, CompressSegmentDuplicateValues) {
   value_segment_int->append(1);
   value_segment_int->append(1);
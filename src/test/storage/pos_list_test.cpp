@@ -0,0 +1,154 @@
+#include "base_test.hpp"
+
+#include "storage/pos_list.hpp"
+
+namespace opossum {
+
+class StoragePosListTest : public BaseTest {
+ protected:
+  // Collects the positions via iteration (using for_each_chunk_run) and via operator[] and checks that both match.
+  std::vector<RowID> _positions(const AbstractPosList& pos_list) {
+    auto iterated_positions = std::vector<RowID>{};
+    for_each_chunk_run(pos_list, [&](const ChunkID chunk_id, const auto begin, const auto end,
+                                     const size_t first_index) {
+      EXPECT_EQ(first_index, iterated_positions.size());
+      for (auto it = begin; it != end; ++it) {
+        EXPECT_EQ(RowID{*it}.chunk_id, chunk_id);
+        iterated_positions.push_back(*it);
+      }
+    });
+
+    auto indexed_positions = std::vector<RowID>{};
+    for (auto index = size_t{0}; index < pos_list.size(); ++index) {
+      indexed_positions.push_back(pos_list[index]);
+    }
+
+    EXPECT_EQ(iterated_positions, indexed_positions);
+    return iterated_positions;
+  }
+};
+
+TEST_F(StoragePosListTest, PosList) {
+  const auto pos_list = PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}, NULL_ROW_ID, RowID{ChunkID{1}, 0}};
+  EXPECT_EQ(pos_list.size(), 4);
+  EXPECT_EQ(pos_list.common_chunk_id(), INVALID_CHUNK_ID);
+  EXPECT_EQ(pos_list.memory_usage(), 4 * sizeof(RowID));
+
+  const auto positions = _positions(pos_list);
+  EXPECT_EQ(positions,
+            (std::vector<RowID>{RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}, NULL_ROW_ID, RowID{ChunkID{1}, 0}}));
+}
+
+TEST_F(StoragePosListTest, SingleChunkPosList) {
+  const auto pos_list = SingleChunkPosList{ChunkID{3}, {5, 1, 7}};
+  EXPECT_EQ(pos_list.size(), 3);
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{3});
+  EXPECT_EQ(pos_list.memory_usage(), 3 * sizeof(ChunkOffset));
+
+  const auto positions = _positions(pos_list);
+  EXPECT_EQ(positions, (std::vector<RowID>{RowID{ChunkID{3}, 5}, RowID{ChunkID{3}, 1}, RowID{ChunkID{3}, 7}}));
+}
+
+TEST_F(StoragePosListTest, ChunkRangePosList) {
+  const auto pos_list = ChunkRangePosList{ChunkID{2}, 4, 7};
+  EXPECT_EQ(pos_list.size(), 3);
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{2});
+  EXPECT_EQ(pos_list.memory_usage(), 0);
+
+  const auto positions = _positions(pos_list);
+  EXPECT_EQ(positions, (std::vector<RowID>{RowID{ChunkID{2}, 4}, RowID{ChunkID{2}, 5}, RowID{ChunkID{2}, 6}}));
+
+  EXPECT_TRUE((ChunkRangePosList{ChunkID{2}, 4, 4}.empty()));
+  EXPECT_THROW((ChunkRangePosList{ChunkID{2}, 4, 3}), std::logic_error);
+}
+
+TEST_F(StoragePosListTest, BitmapPosList) {
+  // Offsets 0, 3, 63, 64, and 254. The third word is empty.
+  auto words = std::vector<uint64_t>{(uint64_t{1} << 63) | 0b1001, 1, 0, uint64_t{1} << 62};
+  const auto pos_list = BitmapPosList{ChunkID{1}, std::move(words)};
+  EXPECT_EQ(pos_list.size(), 5);
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{1});
+
+  const auto positions = _positions(pos_list);
+  EXPECT_EQ(positions, (std::vector<RowID>{RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 3}, RowID{ChunkID{1}, 63},
+                                           RowID{ChunkID{1}, 64}, RowID{ChunkID{1}, 254}}));
+
+  EXPECT_TRUE((BitmapPosList{ChunkID{1}, std::vector<uint64_t>(3)}.empty()));
+}
+
+TEST_F(StoragePosListTest, ForEachChunkRun) {
+  const auto pos_list = PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 0}, NULL_ROW_ID, NULL_ROW_ID,
+                                RowID{ChunkID{1}, 2}, RowID{ChunkID{0}, 3}};
+
+  auto runs = std::vector<std::tuple<ChunkID, size_t, size_t>>{};
+  for_each_chunk_run(pos_list, [&](const ChunkID chunk_id, const auto begin, const auto end, const size_t first_index) {
+    runs.emplace_back(chunk_id, first_index, std::distance(begin, end));
+  });
+
+  const auto expected_runs = std::vector<std::tuple<ChunkID, size_t, size_t>>{
+      {ChunkID{0}, 0, 2}, {INVALID_CHUNK_ID, 2, 2}, {ChunkID{1}, 4, 1}, {ChunkID{0}, 5, 1}};
+  EXPECT_EQ(runs, expected_runs);
+}
+
+TEST_F(StoragePosListTest, ForEachChunkRunInRange) {
+  auto words = std::vector<uint64_t>{(uint64_t{1} << 63) | 0b1001, 1, 0, uint64_t{1} << 62};
+  const auto bitmap = BitmapPosList{ChunkID{1}, std::move(words)};
+  const auto single_chunk = SingleChunkPosList{ChunkID{1}, {0, 3, 63, 64, 254}};
+  const auto range = ChunkRangePosList{ChunkID{1}, 10, 15};
+
+  for (const auto* pos_list : std::vector<const AbstractPosList*>{&bitmap, &single_chunk, &range}) {
+    for (auto begin_index = size_t{0}; begin_index <= 5; ++begin_index) {
+      for (auto end_index = begin_index; end_index <= 5; ++end_index) {
+        auto positions = std::vector<RowID>{};
+        for_each_chunk_run(*pos_list, begin_index, end_index,
+                           [&](const ChunkID /*chunk_id*/, const auto begin, const auto end, const size_t first_index) {
+                             EXPECT_EQ(first_index, begin_index);
+                             positions.insert(positions.end(), begin, end);
+                           });
+
+        ASSERT_EQ(positions.size(), end_index - begin_index);
+        for (auto index = begin_index; index < end_index; ++index) {
+          EXPECT_EQ(positions[index - begin_index], (*pos_list)[index]);
+        }
+      }
+    }
+  }
+
+  // The offset and range lists have random access iterators.
+  EXPECT_EQ(single_chunk.end() - single_chunk.begin(), 5);
+  EXPECT_EQ(single_chunk.begin()[3], (RowID{ChunkID{1}, 64}));
+  EXPECT_EQ(*(range.end() - 2), (RowID{ChunkID{1}, 13}));
+  EXPECT_LT(range.begin(), range.iterator_at(1));
+  EXPECT_EQ(bitmap.iterator_at(5), bitmap.end());
+}
+
+TEST_F(StoragePosListTest, MakeSingleChunkPosList) {
+  // Contiguous offsets are stored as a range.
+  const auto range = make_single_chunk_pos_list(ChunkID{0}, {3, 4, 5, 6}, 100);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const ChunkRangePosList>(range));
+  EXPECT_EQ(_positions(*range).front(), (RowID{ChunkID{0}, 3}));
+
+  // Few qualifying rows are stored as offsets.
+  const auto sparse = make_single_chunk_pos_list(ChunkID{0}, {3, 50, 99}, 100);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const SingleChunkPosList>(sparse));
+
+  // Many qualifying rows are stored as a bitmap.
+  auto offsets = std::vector<ChunkOffset>{};
+  for (auto offset = ChunkOffset{0}; offset < 1000; offset += 2) {
+    offsets.push_back(offset);
+  }
+  const auto dense = make_single_chunk_pos_list(ChunkID{2}, std::vector<ChunkOffset>{offsets}, 1000);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(dense));
+  EXPECT_LT(dense->memory_usage(), offsets.size() * sizeof(ChunkOffset));
+
+  const auto positions = _positions(*dense);
+  ASSERT_EQ(positions.size(), offsets.size());
+  for (auto index = size_t{0}; index < offsets.size(); ++index) {
+    EXPECT_EQ(positions[index], (RowID{ChunkID{2}, offsets[index]}));
+  }
+
+  // Empty offsets are stored as offsets as well.
+  EXPECT_TRUE(make_single_chunk_pos_list(ChunkID{0}, {}, 100)->empty());
+}
+
+}  // namespace opossum
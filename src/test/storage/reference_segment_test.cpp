@@ -4,6 +4,7 @@
 #include "operators/get_table.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
+#include "resolve_type.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -105,4 +106,49 @@ TEST_F(ReferenceSegmentTest, RetrieveNullValueFromNullRowID) {
   EXPECT_EQ(ref_segment[ChunkOffset{3}], segment[ChunkOffset{2}]);
 }
 
+TEST_F(ReferenceSegmentTest, ResolveSegmentType) {
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}});
+  const auto reference_segment = ReferenceSegment(_test_table_dict, ColumnID{1}, pos_list);
+  const auto& dictionary_segment = *_test_table_dict->get_chunk(ChunkID{0})->get_segment(ColumnID{1});
+  const auto& value_segment = *_test_table_dict->get_chunk(ChunkID{2})->get_segment(ColumnID{1});
+
+  EXPECT_EQ(reference_segment.encoding(), SegmentEncoding::Reference);
+  EXPECT_EQ(reference_segment.data_type(), DataType::Int);
+  EXPECT_EQ(dictionary_segment.encoding(), SegmentEncoding::Dictionary);
+  EXPECT_EQ(value_segment.encoding(), SegmentEncoding::Unencoded);
+  EXPECT_EQ(value_segment.data_type(), DataType::Int);
+  EXPECT_EQ(_test_table->get_chunk(ChunkID{0})->get_segment(ColumnID{1})->data_type(), DataType::Float);
+
+  auto resolved_encodings = std::vector<SegmentEncoding>{};
+  for (const auto* segment : {static_cast<const AbstractSegment*>(&reference_segment), &dictionary_segment,
+                              &value_segment}) {
+    resolve_segment_type<int32_t>(*segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+      if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+        resolved_encodings.push_back(SegmentEncoding::Reference);
+      } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<int32_t>>) {
+        resolved_encodings.push_back(SegmentEncoding::Dictionary);
+      } else {
+        resolved_encodings.push_back(SegmentEncoding::Unencoded);
+      }
+    });
+  }
+  EXPECT_EQ(resolved_encodings, std::vector<SegmentEncoding>({SegmentEncoding::Reference, SegmentEncoding::Dictionary,
+                                                              SegmentEncoding::Unencoded}));
+
+  // Resolving a segment with a different data type would use it as a segment of the wrong type.
+  const auto do_nothing = [](const auto& /*typed_segment*/) {};
+  EXPECT_THROW(resolve_segment_type<float>(value_segment, do_nothing), std::logic_error);
+  EXPECT_THROW(resolve_segment_type<std::string>(reference_segment, do_nothing), std::logic_error);
+
+  EXPECT_EQ(segment_cast<ReferenceSegment>(&reference_segment), &reference_segment);
+  EXPECT_EQ(segment_cast<DictionarySegment<int32_t>>(&reference_segment), nullptr);
+  EXPECT_EQ(segment_cast<DictionarySegment<int32_t>>(&dictionary_segment), &dictionary_segment);
+  EXPECT_EQ(segment_cast<ValueSegment<int32_t>>(&dictionary_segment), nullptr);
+  EXPECT_EQ(segment_cast<ValueSegment<int32_t>>(&value_segment), &value_segment);
+  EXPECT_EQ(segment_cast<ValueSegment<int32_t>>(nullptr), nullptr);
+  EXPECT_EQ(segment_cast<ValueSegment<int64_t>>(&value_segment), nullptr);
+  EXPECT_EQ(segment_cast<DictionarySegment<std::string>>(&dictionary_segment), nullptr);
+}
+
 }  // namespace opossum
@@ -0,0 +1,85 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/segment_iterables.hpp"
+
+namespace opossum {
+
+class SegmentIterablesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "string", true);
+    for (const auto& value : std::vector<AllTypeVariant>{"b", NULL_VALUE, "a", "c", "a", NULL_VALUE, "d"}) {
+      _table->append({value});
+    }
+    _table->compress_chunk(ChunkID{1});
+  }
+
+  // Returns the visited rows as "chunk_offset:value" strings.
+  template <typename Iterate>
+  std::vector<std::string> visit(const Iterate& iterate) {
+    auto rows = std::vector<std::string>{};
+    iterate([&](const SegmentPosition<std::string>& position) {
+      rows.push_back(std::to_string(position.chunk_offset) + ":" + (position.is_null ? "NULL" : position.value));
+    });
+    return rows;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(SegmentIterablesTest, IterateDataSegments) {
+  const auto& value_segment = *_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto& dictionary_segment = *_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0});
+
+  EXPECT_EQ(visit([&](const auto& functor) { segment_iterate<std::string>(value_segment, functor); }),
+            std::vector<std::string>({"0:b", "1:NULL", "2:a", "3:c"}));
+  EXPECT_EQ(visit([&](const auto& functor) { segment_iterate<std::string>(dictionary_segment, functor); }),
+            std::vector<std::string>({"0:a", "1:NULL", "2:d"}));
+  EXPECT_EQ(visit([&](const auto& functor) { segment_iterate<std::string>(value_segment, 1, 3, functor); }),
+            std::vector<std::string>({"1:NULL", "2:a"}));
+  EXPECT_EQ(visit([&](const auto& functor) { segment_iterate<std::string>(dictionary_segment, 1, 3, functor); }),
+            std::vector<std::string>({"1:NULL", "2:d"}));
+}
+
+TEST_F(SegmentIterablesTest, IterateAtRows) {
+  const auto rows = std::vector<RowID>{RowID{ChunkID{5}, 2}, RowID{ChunkID{5}, 0}, RowID{ChunkID{5}, 1}};
+  for (const auto chunk_id : {ChunkID{0}, ChunkID{1}}) {
+    resolve_data_segment_iterable<std::string>(
+        *_table->get_chunk(chunk_id)->get_segment(ColumnID{0}), [&](const auto& iterable) {
+          const auto visited_rows = visit([&](const auto& functor) {
+            iterable.for_each_at_rows(rows.cbegin(), rows.cend(), 10, functor);
+          });
+          EXPECT_EQ(visited_rows, chunk_id == ChunkID{0} ? std::vector<std::string>({"10:a", "11:b", "12:NULL"})
+                                                         : std::vector<std::string>({"10:d", "11:a", "12:NULL"}));
+        });
+  }
+
+  // Reference segments cannot be resolved as data segments.
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{RowID{ChunkID{0}, 0}});
+  const auto reference_segment = ReferenceSegment{_table, ColumnID{0}, pos_list};
+  EXPECT_THROW(resolve_data_segment_iterable<std::string>(reference_segment, [](const auto&) {}), std::logic_error);
+}
+
+TEST_F(SegmentIterablesTest, IterateReferenceSegment) {
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{
+      RowID{ChunkID{1}, 2}, RowID{ChunkID{0}, 0}, NULL_ROW_ID, RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}});
+  const auto reference_segment = ReferenceSegment{_table, ColumnID{0}, pos_list};
+  EXPECT_EQ(visit([&](const auto& functor) { segment_iterate<std::string>(reference_segment, functor); }),
+            std::vector<std::string>({"0:d", "1:b", "2:NULL", "3:NULL", "4:a"}));
+  EXPECT_EQ(visit([&](const auto& functor) { segment_iterate<std::string>(reference_segment, 1, 4, functor); }),
+            std::vector<std::string>({"1:b", "2:NULL", "3:NULL"}));
+
+  const auto range_segment =
+      ReferenceSegment{_table, ColumnID{0}, std::make_shared<ChunkRangePosList>(ChunkID{1}, 1, 3)};
+  EXPECT_EQ(visit([&](const auto& functor) { segment_iterate<std::string>(range_segment, functor); }),
+            std::vector<std::string>({"0:NULL", "1:d"}));
+  EXPECT_EQ(visit([&](const auto& functor) { segment_iterate<std::string>(range_segment, 1, 2, functor); }),
+            std::vector<std::string>({"1:d"}));
+}
+
+}  // namespace opossum
@@ -67,6 +67,17 @@ TEST_F(StorageTableTest, GetColumnType) {
   EXPECT_THROW(table.column_type(ColumnID{7}), std::logic_error);
 }
 
+TEST_F(StorageTableTest, GetColumnDataType) {
+  EXPECT_EQ(table.column_data_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(table.column_data_type(ColumnID{1}), DataType::String);
+  EXPECT_THROW(table.column_data_type(ColumnID{2}), std::logic_error);
+
+  auto other_table = Table{};
+  other_table.add_column_definition("a", "double", false);
+  EXPECT_EQ(other_table.column_data_type(ColumnID{0}), DataType::Double);
+  EXPECT_THROW(other_table.add_column_definition("b", "integer", false), std::logic_error);
+}
+
 TEST_F(StorageTableTest, ColumnNullable) {
   EXPECT_FALSE(table.column_nullable(ColumnID{0}));
   EXPECT_TRUE(table.column_nullable(ColumnID{1}));
@@ -170,4 +181,25 @@ TEST_F(StorageTableTest, AppendWithEncodedSegments) {
   EXPECT_EQ(table.chunk_count(), 2);
 }
 
+TEST_F(StorageTableTest, Version) {
+  const auto initial_version = table.version();
+  table.append({4, "Hello,"});
+  const auto appended_version = table.version();
+  EXPECT_GT(appended_version, initial_version);
+
+  table.compress_chunk(ChunkID{0});
+  EXPECT_GT(table.version(), appended_version);
+
+  // Ids are unique across tables, versions are not.
+  const auto other_table = Table{};
+  EXPECT_NE(other_table.id(), table.id());
+  EXPECT_EQ(other_table.version(), 0u);
+}
+
+TEST_F(StorageTableTest, EstimateMemoryUsage) {
+  table.append({4, "Hello,"});
+  table.append({6, "world"});
+  EXPECT_GT(table.estimate_memory_usage(), 2 * sizeof(int32_t));
+}
+
 }  // namespace opossum